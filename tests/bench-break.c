@@ -0,0 +1,137 @@
+/* Vogue
+ * bench-break.c: Log attribute throughput benchmark
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.	 See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+#include "config.h"
+
+#include <glib.h>
+#include <string.h>
+
+#include <vogue/vogue.h>
+#include "bench-common.h"
+
+/* Thread counts to measure; 0 means the serial function */
+static const int thread_counts[] = { 0, 1, 2, 4, 8 };
+
+static int text_size = 4 * 1024 * 1024;
+
+static GOptionEntry entries[] = {
+  { "text-size", 0, 0, G_OPTION_ARG_INT, &text_size, "Size of the text to break, in bytes", "BYTES" },
+  { NULL }
+};
+
+typedef struct {
+  const char *text;
+  gsize length;
+  VogueLogAttr *attrs;
+  int n_attrs;
+  GThreadPool *pool;
+} BreakRun;
+
+static void
+run_break (gpointer data)
+{
+  BreakRun *run = data;
+
+  if (run->pool)
+    vogue_get_log_attrs_parallel (run->text, run->length, -1, NULL,
+                                  PANGO_LOG_ATTR_ALL,
+                                  run->attrs, run->n_attrs, run->pool);
+  else
+    vogue_get_log_attrs (run->text, run->length, -1, NULL, run->attrs, run->n_attrs);
+}
+
+static void
+bench_threads (const char *name,
+               const char *text,
+               gsize       length,
+               int         n_threads,
+               GString    *out)
+{
+  BreakRun run;
+  guint64 calls;
+  guint64 n_allocs;
+  double seconds;
+
+  run.text = text;
+  run.length = length;
+  run.n_attrs = g_utf8_strlen (text, length) + 1;
+  run.attrs = g_new (VogueLogAttr, run.n_attrs);
+  run.pool = NULL;
+
+  if (n_threads > 0)
+    run.pool = vogue_log_attrs_thread_pool_new (n_threads);
+
+  seconds = bench_time (run_break, &run, &calls, &n_allocs);
+
+  if (bench_json)
+    bench_json_add_result (out,
+                           "corpus", "%s", name,
+                           "threads", "%d", n_threads,
+                           "calls", "%" G_GUINT64_FORMAT, calls,
+                           "seconds", "%f", seconds,
+                           "bytes-per-second", "%f", calls * length / seconds,
+                           "chars-per-second", "%f", calls * (run.n_attrs - 1) / seconds,
+                           NULL);
+  else
+    g_string_append_printf (out, "%-22s %7d %12.1f %14.0f\n",
+                            name, n_threads,
+                            calls * length / seconds / (1024 * 1024),
+                            calls * (run.n_attrs - 1) / seconds);
+
+  if (run.pool)
+    g_thread_pool_free (run.pool, FALSE, TRUE);
+  g_free (run.attrs);
+}
+
+static void
+bench_corpus (const char *name,
+              const char *text,
+              gsize       length,
+              gpointer    user_data,
+              GString    *out)
+{
+  GString *big;
+  guint i;
+
+  /* Repeat the corpus to get a text of a size worth splitting */
+  big = g_string_sized_new (text_size + length);
+  while (big->len < (gsize) text_size)
+    g_string_append_len (big, text, length);
+
+  for (i = 0; i < G_N_ELEMENTS (thread_counts); i++)
+    bench_threads (name, big->str, big->len, thread_counts[i], out);
+
+  g_string_free (big, TRUE);
+}
+
+int
+main (int argc, char *argv[])
+{
+  char *header;
+
+  if (!bench_init (&argc, &argv, "Measure how log attribute computation scales with threads.", entries))
+    return 1;
+
+  header = g_strdup_printf ("%-22s %7s %12s %14s\n",
+                            "corpus", "threads", "MB/s", "chars/s");
+  bench_run_corpora ("break", header, bench_corpus, NULL);
+  g_free (header);
+
+  return 0;
+}
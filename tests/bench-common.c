@@ -0,0 +1,373 @@
+/* Vogue
+ * bench-common.c: Common benchmark code
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.	 See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+#include "config.h"
+
+#include <glib.h>
+#include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
+#include <locale.h>
+
+#include <vogue/vogue.h>
+
+#include "bench-common.h"
+
+static const char *corpora[] = {
+  "test-latin.txt",
+  "test-arabic.txt",
+  "test-devanagari.txt",
+  "test-thai.txt",
+  "test-chinese.txt",
+  "test-mixed.txt",
+  "EMOJI-MODIFIERS.txt",
+};
+
+gboolean bench_json = FALSE;
+double bench_min_time = 0.25;
+static char *corpus_dir = NULL;
+
+static GOptionEntry entries[] = {
+  { "json", 0, 0, G_OPTION_ARG_NONE, &bench_json, "Print results as JSON", NULL },
+  { "min-time", 0, 0, G_OPTION_ARG_DOUBLE, &bench_min_time, "Minimum time to run each case, in seconds", "SECONDS" },
+  { "corpus-dir", 0, 0, G_OPTION_ARG_FILENAME, &corpus_dir, "Directory containing the text corpora", "DIR" },
+  { NULL }
+};
+
+/* Allocation counting.
+ *
+ * g_mem_set_vtable() is a no-op in current GLib, so we count at the
+ * malloc level instead. With glibc, the definitions below interpose
+ * the allocator for the whole process (GLib, HarfBuzz and Vogue
+ * included) and forward to the real implementation. Elsewhere,
+ * counting is reported as unsupported.
+ */
+
+static volatile gint counting;
+static gsize alloc_count; /* atomic, pointer-sized so that it does not wrap */
+
+#ifdef __GLIBC__
+
+extern void *__libc_malloc  (size_t size);
+extern void *__libc_calloc  (size_t nmemb, size_t size);
+extern void *__libc_realloc (void *ptr, size_t size);
+
+void *
+malloc (size_t size)
+{
+  if (counting)
+    g_atomic_pointer_add (&alloc_count, 1);
+
+  return __libc_malloc (size);
+}
+
+void *
+calloc (size_t nmemb,
+        size_t size)
+{
+  if (counting)
+    g_atomic_pointer_add (&alloc_count, 1);
+
+  return __libc_calloc (nmemb, size);
+}
+
+void *
+realloc (void   *ptr,
+         size_t  size)
+{
+  if (counting)
+    g_atomic_pointer_add (&alloc_count, 1);
+
+  return __libc_realloc (ptr, size);
+}
+
+gboolean
+bench_alloc_counting_supported (void)
+{
+  return TRUE;
+}
+
+#else
+
+gboolean
+bench_alloc_counting_supported (void)
+{
+  return FALSE;
+}
+
+#endif
+
+static void
+bench_alloc_start (void)
+{
+  g_atomic_pointer_set (&alloc_count, 0);
+  counting = TRUE;
+}
+
+/* Returns the number of allocations since bench_alloc_start() */
+static guint64
+bench_alloc_stop (void)
+{
+  counting = FALSE;
+
+  return (guint64) (gsize) g_atomic_pointer_get (&alloc_count);
+}
+
+/* Calls @func with @data repeatedly, until at least --min-time
+ * has passed. Returns the elapsed time in seconds, and stores
+ * the number of calls and of allocations made during them in
+ * @calls and @allocs.
+ */
+double
+bench_time (BenchFunc  func,
+            gpointer   data,
+            guint64   *calls,
+            guint64   *allocs)
+{
+  gint64 start, elapsed;
+
+  *calls = 0;
+  *allocs = 0;
+
+  start = g_get_monotonic_time ();
+  do
+    {
+      bench_alloc_start ();
+      func (data);
+      *allocs += bench_alloc_stop ();
+
+      (*calls)++;
+      elapsed = g_get_monotonic_time () - start;
+    }
+  while (elapsed < bench_min_time * G_USEC_PER_SEC);
+
+  return elapsed / (double) G_USEC_PER_SEC;
+}
+
+static char *
+bench_load_corpus (const char *dir,
+                   const char *name,
+                   gsize      *length)
+{
+  char *path;
+  char *contents;
+  GError *error = NULL;
+
+  path = g_build_filename (dir, name, NULL);
+  if (!g_file_get_contents (path, &contents, length, &error))
+    {
+      g_printerr ("%s\n", error->message);
+      g_error_free (error);
+      contents = NULL;
+    }
+  g_free (path);
+
+  return contents;
+}
+
+/* Appends @str as a JSON string literal. Invalid UTF-8 is
+ * replaced, since JSON text must be valid Unicode.
+ */
+static void
+bench_json_append_string (GString    *json,
+                          const char *str)
+{
+  char *valid;
+  const char *p;
+
+  valid = g_utf8_make_valid (str, -1);
+
+  g_string_append_c (json, '"');
+  for (p = valid; *p; p++)
+    {
+      guchar c = *p;
+
+      switch (c)
+        {
+        case '"':
+          g_string_append (json, "\\\"");
+          break;
+        case '\\':
+          g_string_append (json, "\\\\");
+          break;
+        case '\b':
+          g_string_append (json, "\\b");
+          break;
+        case '\f':
+          g_string_append (json, "\\f");
+          break;
+        case '\n':
+          g_string_append (json, "\\n");
+          break;
+        case '\r':
+          g_string_append (json, "\\r");
+          break;
+        case '\t':
+          g_string_append (json, "\\t");
+          break;
+        default:
+          if (c < 0x20)
+            g_string_append_printf (json, "\\u%04x", c);
+          else
+            g_string_append_c (json, c);
+          break;
+        }
+    }
+  g_string_append_c (json, '"');
+
+  g_free (valid);
+}
+
+static void
+bench_json_begin (GString    *json,
+                  const char *benchmark)
+{
+  g_string_append (json, "{\n  \"benchmark\": ");
+  bench_json_append_string (json, benchmark);
+  g_string_append (json, ",\n  \"vogue-version\": ");
+  bench_json_append_string (json, vogue_version_string ());
+  g_string_append (json, ",\n  \"results\": [");
+}
+
+/* Appends one result object. The variable arguments are
+ * key/format pairs, each followed by one argument matching
+ * the format, terminated by %NULL. Supported formats are "%s",
+ * "%d", G_GUINT64_FORMAT and "%f" (a double).
+ */
+void
+bench_json_add_result (GString    *json,
+                       const char *first_key,
+                       ...)
+{
+  va_list args;
+  const char *key;
+  const char *sep = "";
+
+  if (json->str[json->len - 1] == '}')
+    g_string_append_c (json, ',');
+  g_string_append (json, "\n    {");
+
+  va_start (args, first_key);
+  for (key = first_key; key; key = va_arg (args, const char *))
+    {
+      const char *format = va_arg (args, const char *);
+
+      g_string_append (json, sep);
+      bench_json_append_string (json, key);
+      g_string_append (json, ": ");
+      if (strcmp (format, "%s") == 0)
+        bench_json_append_string (json, va_arg (args, const char *));
+      else if (strcmp (format, "%d") == 0)
+        g_string_append_printf (json, "%d", va_arg (args, int));
+      else if (strcmp (format, "%" G_GUINT64_FORMAT) == 0)
+        g_string_append_printf (json, "%" G_GUINT64_FORMAT, va_arg (args, guint64));
+      else
+        g_string_append_printf (json, "%.3f", va_arg (args, double));
+
+      sep = ", ";
+    }
+  va_end (args);
+
+  g_string_append_c (json, '}');
+}
+
+static void
+bench_json_end (GString *json)
+{
+  g_string_append (json, "\n  ]\n}\n");
+}
+
+/* Sets up the locale and parses the options common to all
+ * benchmarks, plus @extra_entries if not %NULL. Returns
+ * %FALSE if the command line could not be parsed.
+ */
+gboolean
+bench_init (int                *argc,
+            char             ***argv,
+            const char         *summary,
+            const GOptionEntry *extra_entries)
+{
+  GOptionContext *option_context;
+  GError *error = NULL;
+  gboolean ret;
+
+  g_setenv ("LC_ALL", "en_US.UTF-8", TRUE);
+  setlocale (LC_ALL, "");
+
+  option_context = g_option_context_new ("");
+  g_option_context_set_summary (option_context, summary);
+  g_option_context_add_main_entries (option_context, entries, NULL);
+  if (extra_entries)
+    g_option_context_add_main_entries (option_context, extra_entries, NULL);
+
+  ret = g_option_context_parse (option_context, argc, argv, &error);
+  if (!ret)
+    {
+      g_printerr ("%s\n", error->message);
+      g_error_free (error);
+    }
+  g_option_context_free (option_context);
+
+  if (!corpus_dir)
+    corpus_dir = g_strdup (CORPUSDIR);
+
+  return ret;
+}
+
+/* Loads each of the bundled corpora and calls @func on it, then
+ * prints what @func appended to the output. In text mode, @header
+ * is printed first; with --json, the results are wrapped in a
+ * report for @benchmark.
+ */
+void
+bench_run_corpora (const char      *benchmark,
+                   const char      *header,
+                   BenchCorpusFunc  func,
+                   gpointer         user_data)
+{
+  GString *out;
+  guint i;
+
+  out = g_string_new ("");
+  if (bench_json)
+    bench_json_begin (out, benchmark);
+  else
+    g_string_append (out, header);
+
+  for (i = 0; i < G_N_ELEMENTS (corpora); i++)
+    {
+      char *text;
+      gsize length;
+
+      text = bench_load_corpus (corpus_dir, corpora[i], &length);
+      if (!text)
+        continue;
+
+      func (corpora[i], text, length, user_data, out);
+
+      g_free (text);
+    }
+
+  if (bench_json)
+    bench_json_end (out);
+
+  g_print ("%s", out->str);
+
+  g_string_free (out, TRUE);
+}
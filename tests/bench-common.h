@@ -0,0 +1,36 @@
+#ifndef __BENCH_COMMON_H__
+#define __BENCH_COMMON_H__
+
+#include <glib.h>
+
+extern gboolean bench_json;
+extern double   bench_min_time;
+
+typedef void (* BenchFunc)       (gpointer     data);
+typedef void (* BenchCorpusFunc) (const char  *name,
+                                  const char  *text,
+                                  gsize        length,
+                                  gpointer     user_data,
+                                  GString     *out);
+
+gboolean bench_init           (int                 *argc,
+                               char              ***argv,
+                               const char          *summary,
+                               const GOptionEntry  *extra_entries);
+void     bench_run_corpora    (const char          *benchmark,
+                               const char          *header,
+                               BenchCorpusFunc      func,
+                               gpointer             user_data);
+
+double   bench_time           (BenchFunc    func,
+                               gpointer     data,
+                               guint64     *calls,
+                               guint64     *allocs);
+
+gboolean bench_alloc_counting_supported (void);
+
+void     bench_json_add_result (GString    *json,
+                                const char *first_key,
+                                ...) G_GNUC_NULL_TERMINATED;
+
+#endif
@@ -0,0 +1,190 @@
+/* Vogue
+ * bench-layout.c: Per-phase layout benchmark
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.	 See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+#include "config.h"
+
+#include <glib.h>
+#include <string.h>
+
+#include <vogue/voguecairo.h>
+#include "bench-common.h"
+
+/* Layout widths, in points. -1 means no wrapping */
+static const int widths[] = { -1, 100, 300, 1000 };
+
+typedef struct {
+  VogueContext *context;
+  const char *text;
+  int length;
+  int n_chars;
+  VogueLogAttr *log_attrs;
+  GList *items;
+  VogueGlyphString *glyphs;
+  int width;
+} Corpus;
+
+static void
+run_break (gpointer data)
+{
+  Corpus *corpus = data;
+  vogue_get_log_attrs (corpus->text, corpus->length, -1, NULL,
+                       corpus->log_attrs, corpus->n_chars + 1);
+}
+
+static void
+run_itemize (gpointer data)
+{
+  Corpus *corpus = data;
+  GList *items;
+
+  items = vogue_itemize (corpus->context, corpus->text, 0, corpus->length, NULL, NULL);
+  g_list_free_full (items, (GDestroyNotify) vogue_item_free);
+}
+
+static void
+run_shape (gpointer data)
+{
+  Corpus *corpus = data;
+  GList *l;
+
+  for (l = corpus->items; l; l = l->next)
+    {
+      VogueItem *item = l->data;
+
+      vogue_shape_full (corpus->text + item->offset, item->length,
+                        corpus->text, corpus->length,
+                        &item->analysis, corpus->glyphs);
+    }
+}
+
+static void
+run_layout (gpointer data)
+{
+  Corpus *corpus = data;
+  VogueLayout *layout;
+  VogueRectangle ink, logical;
+
+  layout = vogue_layout_new (corpus->context);
+  vogue_layout_set_text (layout, corpus->text, corpus->length);
+  if (corpus->width > 0)
+    vogue_layout_set_width (layout, corpus->width * PANGO_SCALE);
+  vogue_layout_get_extents (layout, &ink, &logical);
+  g_object_unref (layout);
+}
+
+static void
+bench_phase (Corpus     *corpus,
+             const char *name,
+             const char *phase,
+             BenchFunc   func,
+             GString    *out)
+{
+  guint64 calls;
+  guint64 n_allocs;
+  double seconds;
+  double ns_per_char;
+  double allocs_per_char;
+
+  /* Warm up fonts and caches */
+  func (corpus);
+
+  seconds = bench_time (func, corpus, &calls, &n_allocs);
+
+  ns_per_char = seconds * 1e9 / ((double) calls * corpus->n_chars);
+  if (bench_alloc_counting_supported ())
+    allocs_per_char = n_allocs / ((double) calls * corpus->n_chars);
+  else
+    allocs_per_char = -1.0;
+
+  if (bench_json)
+    bench_json_add_result (out,
+                           "corpus", "%s", name,
+                           "phase", "%s", phase,
+                           "width", "%d", corpus->width,
+                           "chars", "%d", corpus->n_chars,
+                           "calls", "%" G_GUINT64_FORMAT, calls,
+                           "seconds", "%f", seconds,
+                           "ns-per-char", "%f", ns_per_char,
+                           "allocs-per-char", "%f", allocs_per_char,
+                           NULL);
+  else
+    g_string_append_printf (out, "%-22s %-8s %6d %12.1f %12.3f\n",
+                            name, phase, corpus->width,
+                            ns_per_char, allocs_per_char);
+}
+
+static void
+bench_corpus (const char *name,
+              const char *text,
+              gsize       length,
+              gpointer    user_data,
+              GString    *out)
+{
+  VogueContext *context = user_data;
+  Corpus corpus;
+  guint i;
+
+  corpus.context = context;
+  corpus.text = text;
+  corpus.length = length;
+  corpus.n_chars = g_utf8_strlen (text, length);
+  corpus.log_attrs = g_new (VogueLogAttr, corpus.n_chars + 1);
+  corpus.items = vogue_itemize (context, text, 0, length, NULL, NULL);
+  corpus.glyphs = vogue_glyph_string_new ();
+  corpus.width = -1;
+
+  if (corpus.n_chars == 0)
+    goto out;
+
+  bench_phase (&corpus, name, "break", run_break, out);
+  bench_phase (&corpus, name, "itemize", run_itemize, out);
+  bench_phase (&corpus, name, "shape", run_shape, out);
+
+  for (i = 0; i < G_N_ELEMENTS (widths); i++)
+    {
+      corpus.width = widths[i];
+      bench_phase (&corpus, name, "layout", run_layout, out);
+    }
+
+out:
+  vogue_glyph_string_free (corpus.glyphs);
+  g_list_free_full (corpus.items, (GDestroyNotify) vogue_item_free);
+  g_free (corpus.log_attrs);
+}
+
+int
+main (int argc, char *argv[])
+{
+  VogueContext *context;
+  char *header;
+
+  if (!bench_init (&argc, &argv, "Measure the time and allocations of each layout phase over the bundled text corpora.", NULL))
+    return 1;
+
+  context = vogue_font_map_create_context (vogue_cairo_font_map_get_default ());
+
+  header = g_strdup_printf ("%-22s %-8s %6s %12s %12s\n",
+                            "corpus", "phase", "width", "ns/char", "allocs/char");
+  bench_run_corpora ("layout", header, bench_corpus, context);
+  g_free (header);
+
+  g_object_unref (context);
+
+  return 0;
+}
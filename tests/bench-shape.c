@@ -0,0 +1,212 @@
+/* Vogue
+ * bench-shape.c: Shaping throughput benchmark
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.	 See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+#include "config.h"
+
+#include <glib.h>
+#include <string.h>
+
+#include <vogue/voguecairo.h>
+#include "bench-common.h"
+
+/* Approximate item lengths, in bytes. 0 means whole paragraphs */
+static const int chunk_lengths[] = { 16, 64, 256, 0 };
+
+typedef struct {
+  const char *chunk;
+  int chunk_length;
+  VogueItem *item;
+} ShapeJob;
+
+typedef struct {
+  GArray *jobs;
+  VogueGlyphString *glyphs;
+  guint64 n_glyphs;
+} ShapeRun;
+
+/* Splits @text into paragraphs, and the paragraphs into
+ * chunks of about @chunk_length bytes, and itemizes them.
+ * Each item is added to @jobs, each chunk to @chunks.
+ */
+static void
+itemize_corpus (VogueContext *context,
+                const char   *text,
+                int           chunk_length,
+                GPtrArray    *chunks,
+                GArray       *jobs)
+{
+  const char *p = text;
+
+  while (*p)
+    {
+      const char *end = strchr (p, '\n');
+      const char *q;
+
+      if (!end)
+        end = p + strlen (p);
+
+      for (q = p; q < end; )
+        {
+          const char *chunk_end;
+          char *chunk;
+          GList *list, *l;
+
+          if (chunk_length == 0 || end - q <= chunk_length)
+            chunk_end = end;
+          else
+            chunk_end = g_utf8_find_prev_char (q, q + chunk_length + 1);
+
+          if (chunk_end <= q)
+            chunk_end = g_utf8_next_char (q);
+
+          chunk = g_strndup (q, chunk_end - q);
+          g_ptr_array_add (chunks, chunk);
+
+          list = vogue_itemize (context, chunk, 0, chunk_end - q, NULL, NULL);
+          for (l = list; l; l = l->next)
+            {
+              ShapeJob job;
+
+              job.chunk = chunk;
+              job.chunk_length = chunk_end - q;
+              job.item = l->data;
+              g_array_append_val (jobs, job);
+            }
+          g_list_free (list);
+
+          q = chunk_end;
+        }
+
+      p = *end ? end + 1 : end;
+    }
+}
+
+static void
+run_shape (gpointer data)
+{
+  ShapeRun *run = data;
+  guint i;
+
+  for (i = 0; i < run->jobs->len; i++)
+    {
+      ShapeJob *job = &g_array_index (run->jobs, ShapeJob, i);
+      VogueItem *item = job->item;
+
+      vogue_shape_full (job->chunk + item->offset, item->length, job->chunk, job->chunk_length, &item->analysis, run->glyphs);
+
+      run->n_glyphs += run->glyphs->num_glyphs;
+    }
+}
+
+static void
+bench_chunks (VogueContext *context,
+              const char   *name,
+              const char   *text,
+              int           chunk_length,
+              GString      *out)
+{
+  GPtrArray *chunks;
+  ShapeRun run;
+  guint64 runs;
+  guint64 calls;
+  guint64 n_allocs;
+  guint plan_hits, plan_misses, plan_hits_before, plan_misses_before;
+  double seconds;
+  guint i;
+
+  chunks = g_ptr_array_new_with_free_func (g_free);
+  run.jobs = g_array_new (FALSE, FALSE, sizeof (ShapeJob));
+  itemize_corpus (context, text, chunk_length, chunks, run.jobs);
+
+  run.glyphs = vogue_glyph_string_new ();
+
+  /* Warm up fonts and caches */
+  run_shape (&run);
+  run.n_glyphs = 0;
+
+  vogue_shape_plan_cache_get_stats (&plan_hits_before, &plan_misses_before, NULL);
+
+  seconds = bench_time (run_shape, &run, &runs, &n_allocs);
+  calls = runs * run.jobs->len;
+
+  vogue_shape_plan_cache_get_stats (&plan_hits, &plan_misses, NULL);
+  plan_hits -= plan_hits_before;
+  plan_misses -= plan_misses_before;
+
+  if (bench_json)
+    bench_json_add_result (out,
+                           "corpus", "%s", name,
+                           "chunk-length", "%d", chunk_length,
+                           "calls", "%" G_GUINT64_FORMAT, calls,
+                           "glyphs", "%" G_GUINT64_FORMAT, run.n_glyphs,
+                           "seconds", "%f", seconds,
+                           "glyphs-per-second", "%f", run.n_glyphs / seconds,
+                           "calls-per-second", "%f", calls / seconds,
+                           "allocs-per-call", "%f", bench_alloc_counting_supported () ? n_allocs / (double) calls : -1.0,
+                           "plan-cache-hit-rate", "%f", plan_hits + plan_misses ? plan_hits / (double) (plan_hits + plan_misses) : 1.0,
+                           NULL);
+  else
+    g_string_append_printf (out, "%-22s %6d %12.0f %12.0f %10.2f %8.1f%%\n",
+                            name, chunk_length,
+                            run.n_glyphs / seconds,
+                            calls / seconds,
+                            bench_alloc_counting_supported () ? n_allocs / (double) calls : -1.0,
+                            plan_hits + plan_misses ? 100.0 * plan_hits / (plan_hits + plan_misses) : 100.0);
+
+  vogue_glyph_string_free (run.glyphs);
+  for (i = 0; i < run.jobs->len; i++)
+    vogue_item_free (g_array_index (run.jobs, ShapeJob, i).item);
+  g_array_unref (run.jobs);
+  g_ptr_array_unref (chunks);
+}
+
+static void
+bench_corpus (const char *name,
+              const char *text,
+              gsize       length,
+              gpointer    user_data,
+              GString    *out)
+{
+  VogueContext *context = user_data;
+  guint i;
+
+  for (i = 0; i < G_N_ELEMENTS (chunk_lengths); i++)
+    bench_chunks (context, name, text, chunk_lengths[i], out);
+}
+
+int
+main (int argc, char *argv[])
+{
+  VogueContext *context;
+  char *header;
+
+  if (!bench_init (&argc, &argv, "Measure shaping throughput over the bundled text corpora.", NULL))
+    return 1;
+
+  context = vogue_font_map_create_context (vogue_cairo_font_map_get_default ());
+
+  header = g_strdup_printf ("%-22s %6s %12s %12s %10s %9s\n",
+                            "corpus", "chunk", "glyphs/s", "calls/s", "allocs", "plan-hit");
+  bench_run_corpora ("shape", header, bench_corpus, context);
+  g_free (header);
+
+  g_object_unref (context);
+
+  return 0;
+}
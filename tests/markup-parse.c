@@ -132,6 +132,268 @@ test_parse (gconstpointer d)
   g_free (expected_file);
 }
 
+static void
+test_cache (void)
+{
+  const char *markup = "<b>_Bold</b> and <i>italic</i>";
+  VogueAttrList *attrs1, *attrs2;
+  char *text1, *text2;
+  gunichar accel1, accel2;
+  GString *str1, *str2;
+  guint hits, misses, hits_before, misses_before;
+  gboolean ret;
+
+  vogue_markup_cache_get_stats (&hits_before, &misses_before, NULL);
+
+  ret = vogue_parse_markup (markup, -1, '_', &attrs1, &text1, &accel1, NULL);
+  g_assert_true (ret);
+  ret = vogue_parse_markup (markup, -1, '_', &attrs2, &text2, &accel2, NULL);
+  g_assert_true (ret);
+
+  vogue_markup_cache_get_stats (&hits, &misses, NULL);
+  g_assert_cmpuint (hits - hits_before, ==, 1);
+  g_assert_cmpuint (misses - misses_before, ==, 1);
+
+  g_assert_cmpstr (text1, ==, text2);
+  g_assert_cmpuint (accel1, ==, 'B');
+  g_assert_cmpuint (accel2, ==, 'B');
+  g_assert_true (attrs1 != attrs2);
+
+  str1 = g_string_new ("");
+  str2 = g_string_new ("");
+  print_attr_list (attrs1, str1);
+  print_attr_list (attrs2, str2);
+  g_assert_cmpstr (str1->str, ==, str2->str);
+
+  /* Changing a result must not affect the cached one */
+  vogue_attr_list_insert (attrs2, vogue_attr_size_new (10 * PANGO_SCALE));
+  vogue_attr_list_unref (attrs2);
+  g_free (text2);
+
+  ret = vogue_parse_markup (markup, -1, '_', &attrs2, &text2, NULL, NULL);
+  g_assert_true (ret);
+  g_string_truncate (str2, 0);
+  print_attr_list (attrs2, str2);
+  g_assert_cmpstr (str1->str, ==, str2->str);
+  vogue_attr_list_unref (attrs2);
+  g_free (text2);
+
+  /* The accel marker is part of the key */
+  ret = vogue_parse_markup (markup, -1, 0, NULL, &text2, NULL, NULL);
+  g_assert_true (ret);
+  g_assert_cmpstr (text2, ==, "_Bold and italic");
+  g_free (text2);
+
+  vogue_markup_cache_get_stats (&hits, &misses, NULL);
+  g_assert_cmpuint (hits - hits_before, ==, 2);
+  g_assert_cmpuint (misses - misses_before, ==, 2);
+
+  /* Disabling the cache bypasses it */
+  vogue_markup_cache_set_max_entries (0);
+  ret = vogue_parse_markup (markup, -1, '_', NULL, NULL, NULL, NULL);
+  g_assert_true (ret);
+  vogue_markup_cache_get_stats (&hits, &misses, NULL);
+  g_assert_cmpuint (hits - hits_before, ==, 2);
+  g_assert_cmpuint (misses - misses_before, ==, 2);
+  vogue_markup_cache_set_max_entries (128);
+
+  g_string_free (str1, TRUE);
+  g_string_free (str2, TRUE);
+  vogue_attr_list_unref (attrs1);
+  g_free (text1);
+}
+
+static void
+collect_paragraph (const char    *text,
+                   int            length,
+                   VogueAttrList *attr_list,
+                   gpointer       user_data)
+{
+  GString *string = user_data;
+
+  g_string_append_len (string, text, length);
+  g_string_append (string, "---\n");
+  print_attr_list (attr_list, string);
+}
+
+static void
+test_streaming (void)
+{
+  GMarkupParseContext *context;
+  GString *string;
+  VogueAttrList *attrs;
+  char *text;
+  GError *error = NULL;
+  gboolean ret;
+
+  string = g_string_new ("");
+  context = vogue_markup_parser_new_streaming (0, collect_paragraph, string, NULL);
+
+  /* Paragraphs are emitted as soon as their text is complete,
+   * with the tags that are still open applying up to their end.
+   */
+  ret = g_markup_parse_context_parse (context, "<b>one</b>\n<i>two\n", -1, &error);
+  g_assert_no_error (error);
+  g_assert_true (ret);
+  g_assert_cmpstr (string->str, ==,
+                   "one\n---\n"
+                   "range 0 3\n"
+                   "[0,3]weight=700\n"
+                   "range 3 2147483647\n"
+                   "two\n---\n"
+                   "range 0 4\n"
+                   "[0,4]style=2\n"
+                   "range 4 2147483647\n");
+  g_string_truncate (string, 0);
+
+  ret = g_markup_parse_context_parse (context, "three</i>\n<b>four</b>", -1, &error);
+  g_assert_no_error (error);
+  g_assert_true (ret);
+  g_assert_cmpstr (string->str, ==,
+                   "three\n---\n"
+                   "range 0 5\n"
+                   "[0,5]style=2\n"
+                   "range 5 2147483647\n");
+  g_string_truncate (string, 0);
+
+  ret = vogue_markup_parser_finish (context, &attrs, &text, NULL, &error);
+  g_assert_no_error (error);
+  g_assert_true (ret);
+  g_assert_cmpstr (string->str, ==,
+                   "four---\n"
+                   "range 0 4\n"
+                   "[0,4]weight=700\n"
+                   "range 4 2147483647\n");
+  g_assert_cmpstr (text, ==, "");
+
+  g_markup_parse_context_free (context);
+  vogue_attr_list_unref (attrs);
+  g_free (text);
+  g_string_free (string, TRUE);
+}
+
+static void
+collect_paragraph_list (const char    *text,
+                        int            length,
+                        VogueAttrList *attr_list,
+                        gpointer       user_data)
+{
+  GPtrArray *paragraphs = user_data;
+
+  g_ptr_array_add (paragraphs, g_strndup (text, length));
+  g_ptr_array_add (paragraphs, vogue_attr_list_ref (attr_list));
+}
+
+/* Returns the attributes of @list in [@start, @end), relative to @start */
+static VogueAttrList *
+clip_attr_list (VogueAttrList *list,
+                guint          start,
+                guint          end)
+{
+  VogueAttrList *result;
+  GSList *attrs, *l;
+
+  result = vogue_attr_list_new ();
+  attrs = vogue_attr_list_get_attributes (list);
+  for (l = attrs; l; l = l->next)
+    {
+      VogueAttribute *attr = l->data;
+
+      if (attr->start_index >= end || attr->end_index <= start)
+        {
+          vogue_attribute_destroy (attr);
+          continue;
+        }
+
+      attr->start_index = MAX (attr->start_index, start) - start;
+      attr->end_index = MIN (attr->end_index, end) - start;
+      vogue_attr_list_insert (result, attr);
+    }
+  g_slist_free (attrs);
+
+  return result;
+}
+
+static void
+test_streaming_open_tags (void)
+{
+  const char *markup = "<span foreground=\"red\">one\n"
+                       "<b>two\nthree</b>\n"
+                       "<big>four\n<i>five</i>\nsix</big>"
+                       "</span>\nseven";
+  GMarkupParseContext *context;
+  GPtrArray *paragraphs;
+  VogueAttrList *attrs, *clipped;
+  GString *str1, *str2;
+  char *text;
+  GError *error = NULL;
+  gboolean ret;
+  guint start, span_end, i, n;
+
+  ret = vogue_parse_markup (markup, -1, 0, &attrs, &text, NULL, &error);
+  g_assert_no_error (error);
+  g_assert_true (ret);
+
+  paragraphs = g_ptr_array_new ();
+  context = vogue_markup_parser_new_streaming (0, collect_paragraph_list, paragraphs, NULL);
+
+  /* Feed the markup in small pieces. The paragraphs inside the
+   * outer span come out before it is closed.
+   */
+  span_end = strstr (markup, "</span>") - markup;
+  for (i = 0; markup[i]; i += n)
+    {
+      n = MIN (strlen (markup + i), 5);
+      if (i < span_end)
+        n = MIN (n, span_end - i);
+      else if (i == span_end)
+        g_assert_cmpuint (paragraphs->len, ==, 2 * 5);
+
+      ret = g_markup_parse_context_parse (context, markup + i, n, &error);
+      g_assert_no_error (error);
+      g_assert_true (ret);
+    }
+
+  ret = vogue_markup_parser_finish (context, NULL, NULL, NULL, &error);
+  g_assert_no_error (error);
+  g_assert_true (ret);
+  g_assert_cmpuint (paragraphs->len, ==, 2 * 7);
+
+  /* Each paragraph gets the attributes of vogue_parse_markup(),
+   * clipped to the paragraph.
+   */
+  str1 = g_string_new ("");
+  str2 = g_string_new ("");
+  start = 0;
+  for (i = 0; i < paragraphs->len; i += 2)
+    {
+      const char *paragraph = g_ptr_array_index (paragraphs, i);
+      guint end = start + strlen (paragraph);
+
+      g_assert_true (strncmp (text + start, paragraph, end - start) == 0);
+
+      clipped = clip_attr_list (attrs, start, end);
+      g_string_truncate (str1, 0);
+      g_string_truncate (str2, 0);
+      print_attr_list (clipped, str1);
+      print_attr_list (g_ptr_array_index (paragraphs, i + 1), str2);
+      g_assert_cmpstr (str1->str, ==, str2->str);
+      vogue_attr_list_unref (clipped);
+
+      g_free (g_ptr_array_index (paragraphs, i));
+      vogue_attr_list_unref (g_ptr_array_index (paragraphs, i + 1));
+      start = end;
+    }
+  g_assert_cmpuint (start, ==, strlen (text));
+
+  g_string_free (str1, TRUE);
+  g_string_free (str2, TRUE);
+  g_ptr_array_free (paragraphs, TRUE);
+  g_markup_parse_context_free (context);
+  vogue_attr_list_unref (attrs);
+  g_free (text);
+}
+
 int
 main (int argc, char *argv[])
 {
@@ -173,5 +435,9 @@ main (int argc, char *argv[])
     }
   g_dir_close (dir);
 
+  g_test_add_func ("/markup/cache", test_cache);
+  g_test_add_func ("/markup/streaming", test_streaming);
+  g_test_add_func ("/markup/streaming/open-tags", test_streaming_open_tags);
+
   return g_test_run ();
 }
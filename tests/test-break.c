@@ -269,6 +269,368 @@ test_break (gconstpointer d)
   g_free (expected_file);
 }
 
+static gboolean
+log_attrs_equal (const VogueLogAttr *a,
+                 const VogueLogAttr *b)
+{
+  return a->is_line_break == b->is_line_break &&
+         a->is_mandatory_break == b->is_mandatory_break &&
+         a->is_char_break == b->is_char_break &&
+         a->is_white == b->is_white &&
+         a->is_cursor_position == b->is_cursor_position &&
+         a->is_word_start == b->is_word_start &&
+         a->is_word_end == b->is_word_end &&
+         a->is_sentence_boundary == b->is_sentence_boundary &&
+         a->is_sentence_start == b->is_sentence_start &&
+         a->is_sentence_end == b->is_sentence_end &&
+         a->backspace_deletes_character == b->backspace_deletes_character &&
+         a->is_expandable_space == b->is_expandable_space &&
+         a->is_word_boundary == b->is_word_boundary;
+}
+
+/* Check that computing a subset of the attributes gives the
+ * same values for that subset as computing all of them
+ */
+static void
+test_log_attr_flags (void)
+{
+  const char *text = "Hello, world. This is  a test!\nשלום עולם. नमस्ते दुनिया 123.45\r\n";
+  VogueLogAttr *all, *some;
+  int len, i;
+
+  len = g_utf8_strlen (text, -1) + 1;
+  all = g_new0 (VogueLogAttr, len);
+  some = g_new0 (VogueLogAttr, len);
+
+  vogue_get_log_attrs (text, -1, -1, vogue_language_from_string ("C"), all, len);
+
+  vogue_get_log_attrs_with_flags (text, -1, -1, vogue_language_from_string ("C"),
+                                  PANGO_LOG_ATTR_LINE_BREAKS, some, len);
+  for (i = 0; i < len; i++)
+    {
+      g_assert_cmpint (some[i].is_line_break, ==, all[i].is_line_break);
+      g_assert_cmpint (some[i].is_mandatory_break, ==, all[i].is_mandatory_break);
+      g_assert_cmpint (some[i].is_char_break, ==, all[i].is_char_break);
+      g_assert_cmpint (some[i].is_white, ==, all[i].is_white);
+      g_assert_cmpint (some[i].is_cursor_position, ==, all[i].is_cursor_position);
+      g_assert_cmpint (some[i].is_expandable_space, ==, all[i].is_expandable_space);
+      g_assert_false (some[i].is_word_start);
+      g_assert_false (some[i].is_sentence_boundary);
+    }
+
+  vogue_get_log_attrs_with_flags (text, -1, -1, vogue_language_from_string ("C"),
+                                  PANGO_LOG_ATTR_WORDS, some, len);
+  for (i = 0; i < len; i++)
+    {
+      g_assert_cmpint (some[i].is_line_break, ==, all[i].is_line_break);
+      g_assert_cmpint (some[i].is_word_start, ==, all[i].is_word_start);
+      g_assert_cmpint (some[i].is_word_end, ==, all[i].is_word_end);
+      g_assert_cmpint (some[i].is_word_boundary, ==, all[i].is_word_boundary);
+    }
+
+  vogue_get_log_attrs_with_flags (text, -1, -1, vogue_language_from_string ("C"),
+                                  PANGO_LOG_ATTR_ALL, some, len);
+  g_assert_true (memcmp (some, all, sizeof (VogueLogAttr) * len) == 0);
+
+  g_free (all);
+  g_free (some);
+}
+
+/* Check that updating the attributes after an edit gives
+ * the same result as computing them from scratch
+ */
+static void
+test_log_attrs_update (void)
+{
+  const char *lines[] = {
+    "Hello, world. This is  a test!\n",
+    "שלום עולם. नमस्ते दुनिया 123.45\r\n",
+    "ภาษาไทยเป็นภาษาที่ไม่มีการเว้นวรรค\n",
+    "🇩🇪🇫🇷 👩‍👩‍👧 e\xcc\x81 mañana\xe2\x80\xa9",
+    "Mr. Smith went to Washington. He didn't.\n",
+    "A mark after CR LF\r\n\xcc\x81 looks back past it.\n",
+  };
+  struct {
+    int line;
+    int offset;
+    int old_length;
+    const char *insert;
+  } edits[] = {
+    { 0, 5, 0, "!" },
+    { 1, 0, 4, "" },
+    { 4, 3, 1, "\n" },
+    { 2, 6, 0, "ไทย" },
+    { 3, 0, 0, "\n\n" },
+    { 4, 40, 1, "" },
+    { 4, 17, 0, "x" },
+  };
+  GString *text;
+  VogueLogAttr *attrs, *expected;
+  int attrs_len, n_attrs, n_expected;
+  int i, j;
+
+  text = g_string_new ("");
+  for (i = 0; i < 20; i++)
+    g_string_append (text, lines[i % G_N_ELEMENTS (lines)]);
+
+  attrs_len = g_utf8_strlen (text->str, -1) + 64;
+  attrs = g_new0 (VogueLogAttr, attrs_len);
+  expected = g_new0 (VogueLogAttr, attrs_len);
+
+  n_attrs = g_utf8_strlen (text->str, -1) + 1;
+  vogue_get_log_attrs (text->str, text->len, -1, NULL, attrs, n_attrs);
+
+  for (i = 0; i < (int) G_N_ELEMENTS (edits); i++)
+    {
+      const char *p = text->str;
+      int edit_start, edit_offset, old_bytes;
+
+      /* Edit somewhere in the middle of the text */
+      for (j = 0; j < 7 + edits[i].line; j++)
+        p = strchr (p, '\n') + 1;
+      p = g_utf8_offset_to_pointer (p, edits[i].offset);
+      edit_start = p - text->str;
+      edit_offset = g_utf8_pointer_to_offset (text->str, p);
+      old_bytes = g_utf8_offset_to_pointer (p, edits[i].old_length) - p;
+
+      g_string_erase (text, edit_start, old_bytes);
+      g_string_insert (text, edit_start, edits[i].insert);
+
+      vogue_log_attrs_update (text->str, text->len, -1, NULL,
+                              edit_start, edit_offset,
+                              edits[i].old_length,
+                              strlen (edits[i].insert),
+                              attrs, attrs_len, &n_attrs);
+
+      n_expected = g_utf8_strlen (text->str, -1) + 1;
+      vogue_get_log_attrs (text->str, text->len, -1, NULL, expected, n_expected);
+
+      g_assert_cmpint (n_attrs, ==, n_expected);
+      for (j = 0; j < n_expected; j++)
+        {
+          if (!log_attrs_equal (&attrs[j], &expected[j]))
+            {
+              g_test_message ("edit %d: log attrs differ at position %d", i, j);
+              g_test_fail ();
+              break;
+            }
+        }
+    }
+
+  g_free (attrs);
+  g_free (expected);
+  g_string_free (text, TRUE);
+}
+
+/* Check that allow-breaks attributes suppress breaks inside
+ * their ranges, and leave everything before and after alone.
+ * The position at the very end of a range is not checked.
+ */
+static void
+test_allow_breaks (void)
+{
+  const char *text = "one two thrée four five six";
+  struct {
+    int start;
+    int end;
+  } spans[] = { { 4, 14 }, { 20, 28 } };
+  VogueLayout *layout;
+  VogueAttrList *attrs;
+  const VogueLogAttr *ref_attrs;
+  const VogueLogAttr *log_attrs;
+  VogueLogAttr *expected;
+  int end_pos[G_N_ELEMENTS (spans)];
+  int n_attrs, i, j;
+
+  layout = vogue_layout_new (context);
+  vogue_layout_set_text (layout, text, -1);
+  ref_attrs = vogue_layout_get_log_attrs_readonly (layout, &n_attrs);
+  expected = g_memdup (ref_attrs, n_attrs * sizeof (VogueLogAttr));
+  g_object_unref (layout);
+
+  attrs = vogue_attr_list_new ();
+  for (j = 0; j < (int) G_N_ELEMENTS (spans); j++)
+    {
+      VogueAttribute *attr = vogue_attr_allow_breaks_new (FALSE);
+      int start_pos = g_utf8_pointer_to_offset (text, text + spans[j].start);
+
+      end_pos[j] = g_utf8_pointer_to_offset (text, text + spans[j].end);
+
+      attr->start_index = spans[j].start;
+      attr->end_index = spans[j].end;
+      vogue_attr_list_insert (attrs, attr);
+
+      for (i = start_pos + 1; i < end_pos[j]; i++)
+        {
+          expected[i].is_line_break = FALSE;
+          expected[i].is_mandatory_break = FALSE;
+          expected[i].is_char_break = FALSE;
+        }
+    }
+
+  layout = vogue_layout_new (context);
+  vogue_layout_set_text (layout, text, -1);
+  vogue_layout_set_attributes (layout, attrs);
+  log_attrs = vogue_layout_get_log_attrs_readonly (layout, &n_attrs);
+
+  for (i = 0; i < n_attrs; i++)
+    {
+      if (i == end_pos[0] || i == end_pos[1])
+        continue;
+
+      g_assert_cmpint (log_attrs[i].is_line_break, ==, expected[i].is_line_break);
+      g_assert_cmpint (log_attrs[i].is_mandatory_break, ==, expected[i].is_mandatory_break);
+      g_assert_cmpint (log_attrs[i].is_char_break, ==, expected[i].is_char_break);
+    }
+
+  g_object_unref (layout);
+  vogue_attr_list_unref (attrs);
+  g_free (expected);
+}
+
+/* Check that breaking a long text on a thread pool
+ * gives the same result as breaking it serially
+ */
+static void
+test_log_attrs_parallel (void)
+{
+  const char *lines[] = {
+    "Hello, world. This is  a test!\n",
+    "שלום עולם. नमस्ते दुनिया 123.45\r\n",
+    "ภาษาไทยเป็นภาษาที่ไม่มีการเว้นวรรคระหว่างคำ\n",
+    "\n",
+    "🇩🇪🇫🇷 👩‍👩‍👧 e\xcc\x81 mañana\xe2\x80\xa9",
+    "مرحبا بالعالم. 你好，世界。\n",
+  };
+  GString *text;
+  VogueLogAttr *serial, *parallel;
+  GThreadPool *pool;
+  int len, i;
+
+  text = g_string_new ("");
+  for (i = 0; text->len < 256 * 1024; i++)
+    g_string_append (text, lines[i % G_N_ELEMENTS (lines)]);
+
+  len = g_utf8_strlen (text->str, text->len) + 1;
+  serial = g_new0 (VogueLogAttr, len);
+  parallel = g_new0 (VogueLogAttr, len);
+
+  pool = vogue_log_attrs_thread_pool_new (4);
+
+  vogue_get_log_attrs_with_flags (text->str, text->len, -1, NULL,
+                                  PANGO_LOG_ATTR_ALL, serial, len);
+  vogue_get_log_attrs_parallel (text->str, text->len, -1, NULL,
+                                PANGO_LOG_ATTR_ALL, parallel, len, pool);
+
+  for (i = 0; i < len; i++)
+    {
+      if (!log_attrs_equal (&serial[i], &parallel[i]))
+        {
+          g_test_message ("log attrs differ at position %d", i);
+          g_test_fail ();
+          break;
+        }
+    }
+
+  g_thread_pool_free (pool, FALSE, TRUE);
+  g_free (serial);
+  g_free (parallel);
+  g_string_free (text, TRUE);
+}
+
+static void
+test_paragraph_boundaries (void)
+{
+  const char *texts[] = {
+    "",
+    "no delimiters at all",
+    "one\ntwo\rthree\r\nfour\xe2\x80\xa9" "five",
+    "\r\r\n\n\r",
+    "trailing newline\n",
+    "a long line of text with a delimiter far from the start\r\nand more "
+    "text with non-ASCII bytes: \xe2\x80\x94 \xc3\xb1 \xe2\x80\xa8 "
+    "and a separator\xe2\x80\xa9" "at the end\r",
+    "truncated separator \xe2\x80",
+  };
+  int i;
+
+  for (i = 0; i < (int) G_N_ELEMENTS (texts); i++)
+    {
+      const char *text = texts[i];
+      int length = strlen (text);
+      int *delimiters, *starts;
+      int n_paragraphs;
+      int start, j;
+
+      vogue_find_paragraph_boundaries (text, length,
+                                       &delimiters, &starts, &n_paragraphs);
+
+      g_assert_cmpint (n_paragraphs, >, 0);
+      g_assert_cmpint (starts[0], ==, 0);
+
+      start = 0;
+      for (j = 0; j < n_paragraphs; j++)
+        {
+          int delimiter, next;
+
+          g_assert_cmpint (starts[j], ==, start);
+
+          vogue_find_paragraph_boundary (text + start, length - start,
+                                         &delimiter, &next);
+
+          g_assert_cmpint (delimiters[j], ==, start + delimiter);
+
+          if (j == n_paragraphs - 1)
+            g_assert_cmpint (start + delimiter, ==, length);
+          else
+            g_assert_cmpint (start + delimiter, <, length);
+
+          start += next;
+        }
+
+      g_free (delimiters);
+      g_free (starts);
+    }
+}
+
+static void
+test_layout_paragraphs (void)
+{
+  const char *text =
+    "A first paragraph that is long enough to span several blocks\n"
+    "second\r\nthird\rfourth\xe2\x80\xa9" "fifth, with \xc3\xb1 and \xe2\x80\x94\n"
+    "\n\r\r\nlast";
+  VogueLayout *layout;
+  VogueLayoutIter *iter;
+  int *delimiters, *starts;
+  int n_paragraphs;
+  int i;
+
+  vogue_find_paragraph_boundaries (text, -1, &delimiters, &starts, &n_paragraphs);
+
+  layout = vogue_layout_new (context);
+  vogue_layout_set_text (layout, text, -1);
+
+  g_assert_cmpint (vogue_layout_get_character_count (layout), ==, g_utf8_strlen (text, -1));
+  g_assert_cmpint (vogue_layout_get_line_count (layout), ==, n_paragraphs);
+
+  iter = vogue_layout_get_iter (layout);
+  for (i = 0; i < n_paragraphs; i++)
+    {
+      VogueLayoutLine *line = vogue_layout_iter_get_line_readonly (iter);
+
+      g_assert_cmpint (line->start_index, ==, starts[i]);
+      g_assert_cmpint (line->start_index + line->length, ==, delimiters[i]);
+
+      vogue_layout_iter_next_line (iter);
+    }
+  vogue_layout_iter_free (iter);
+
+  g_object_unref (layout);
+  g_free (delimiters);
+  g_free (starts);
+}
+
 int
 main (int argc, char *argv[])
 {
@@ -312,5 +674,12 @@ main (int argc, char *argv[])
     }
   g_dir_close (dir);
 
+  g_test_add_func ("/break/log-attr-flags", test_log_attr_flags);
+  g_test_add_func ("/break/log-attrs-parallel", test_log_attrs_parallel);
+  g_test_add_func ("/break/allow-breaks", test_allow_breaks);
+  g_test_add_func ("/break/log-attrs-update", test_log_attrs_update);
+  g_test_add_func ("/break/paragraph-boundaries", test_paragraph_boundaries);
+  g_test_add_func ("/break/layout-paragraphs", test_layout_paragraphs);
+
   return g_test_run ();
 }
@@ -116,6 +116,107 @@ test_variation (void)
   vogue_font_description_free (desc2);
 }
 
+static void
+test_hash (void)
+{
+  VogueFontDescription *desc1;
+  VogueFontDescription *desc2;
+  guint hash;
+
+  desc1 = vogue_font_description_from_string ("Cantarell Bold 14");
+  desc2 = vogue_font_description_from_string ("CANTARELL bold 14");
+
+  g_assert (vogue_font_description_equal (desc1, desc2));
+  g_assert_cmpuint (vogue_font_description_hash (desc1), ==, vogue_font_description_hash (desc2));
+
+  /* Setters must invalidate the cached hash */
+  hash = vogue_font_description_hash (desc1);
+  vogue_font_description_set_size (desc1, 16 * PANGO_SCALE);
+  g_assert (!vogue_font_description_equal (desc1, desc2));
+
+  vogue_font_description_set_size (desc2, 16 * PANGO_SCALE);
+  g_assert (vogue_font_description_equal (desc1, desc2));
+  g_assert_cmpuint (vogue_font_description_hash (desc1), ==, vogue_font_description_hash (desc2));
+
+  vogue_font_description_set_size (desc1, 14 * PANGO_SCALE);
+  g_assert_cmpuint (vogue_font_description_hash (desc1), ==, hash);
+
+  vogue_font_description_set_family (desc2, "Sans");
+  g_assert (!vogue_font_description_equal (desc1, desc2));
+  vogue_font_description_merge (desc2, desc1, TRUE);
+  vogue_font_description_set_size (desc2, 14 * PANGO_SCALE);
+  vogue_font_description_set_family (desc2, "cantarell");
+  g_assert (vogue_font_description_equal (desc1, desc2));
+  g_assert_cmpuint (vogue_font_description_hash (desc2), ==, hash);
+
+  /* Variations compare case-sensitively */
+  vogue_font_description_set_variations (desc1, "wght=100");
+  vogue_font_description_set_variations (desc2, "WGHT=100");
+  g_assert (!vogue_font_description_equal (desc1, desc2));
+
+  vogue_font_description_free (desc1);
+  vogue_font_description_free (desc2);
+}
+
+static void
+test_hash_copies (void)
+{
+  VogueFontDescription *desc;
+  VogueFontDescription *copy;
+  VogueFontDescription *merged;
+  VogueFontDescription *desc2;
+
+  desc = vogue_font_description_from_string ("Cantarell Bold 14");
+  vogue_font_description_set_variations (desc, "wght=300");
+  vogue_font_description_hash (desc);
+
+  /* Copies and merges keep the keys alive after @desc is gone */
+  copy = vogue_font_description_copy (desc);
+  merged = vogue_font_description_new ();
+  vogue_font_description_merge (merged, desc, TRUE);
+  vogue_font_description_free (desc);
+
+  desc2 = vogue_font_description_from_string ("cantarell bold 14");
+  vogue_font_description_set_variations (desc2, "wght=300");
+
+  g_assert (vogue_font_description_equal (copy, desc2));
+  g_assert (vogue_font_description_equal (merged, desc2));
+  g_assert_cmpuint (vogue_font_description_hash (copy), ==, vogue_font_description_hash (desc2));
+  g_assert_cmpuint (vogue_font_description_hash (merged), ==, vogue_font_description_hash (desc2));
+
+  vogue_font_description_unset_fields (merged, PANGO_FONT_MASK_VARIATIONS);
+  g_assert (!vogue_font_description_equal (merged, desc2));
+
+  vogue_font_description_free (copy);
+  vogue_font_description_free (merged);
+  vogue_font_description_free (desc2);
+}
+
+static void
+test_copy_family (void)
+{
+  VogueFontDescription *desc;
+  VogueFontDescription *copy;
+
+  desc = vogue_font_description_from_string ("Cantarell Bold 14");
+  copy = vogue_font_description_copy (desc);
+
+  /* Copies share the family name, but can still be changed on their own */
+  g_assert (vogue_font_description_get_family (copy) == vogue_font_description_get_family (desc));
+
+  vogue_font_description_set_family (copy, "Sans");
+  vogue_font_description_set_weight (copy, PANGO_WEIGHT_NORMAL);
+  g_assert_cmpstr (vogue_font_description_get_family (desc), ==, "Cantarell");
+  g_assert_cmpint (vogue_font_description_get_weight (desc), ==, PANGO_WEIGHT_BOLD);
+
+  vogue_font_description_set_family (copy, "Cantarell");
+  g_assert (vogue_font_description_get_family (copy) == vogue_font_description_get_family (desc));
+
+  vogue_font_description_free (desc);
+  g_assert_cmpstr (vogue_font_description_get_family (copy), ==, "Cantarell");
+  vogue_font_description_free (copy);
+}
+
 static void
 test_metrics (void)
 {
@@ -188,6 +289,52 @@ test_extents (void)
   g_object_unref (context);
 }
 
+static void
+test_advances (void)
+{
+  char *str = "Composer";
+  GList *items;
+  VogueItem *item;
+  VogueGlyphString *glyphs;
+  VogueGlyph *ids;
+  int *advances;
+  hb_font_t *hb_font;
+  VogueContext *context;
+  int i;
+
+  context = vogue_font_map_create_context (vogue_cairo_font_map_get_default ());
+  vogue_context_set_font_description (context, vogue_font_description_from_string ("Cantarell 11"));
+
+  items = vogue_itemize (context, str, 0, strlen (str), NULL, NULL);
+  glyphs = vogue_glyph_string_new ();
+  item = items->data;
+  vogue_shape (str, strlen (str), &item->analysis, glyphs);
+
+  hb_font = vogue_font_get_hb_font (item->analysis.font);
+  ids = g_new (VogueGlyph, glyphs->num_glyphs);
+  advances = g_new (int, glyphs->num_glyphs);
+  for (i = 0; i < glyphs->num_glyphs; i++)
+    ids[i] = glyphs->glyphs[i].glyph;
+
+  /* Query twice, to go through both the uncached and the cached path */
+  vogue_font_get_glyph_advances (item->analysis.font, ids, glyphs->num_glyphs, advances);
+  vogue_font_get_glyph_advances (item->analysis.font, ids, glyphs->num_glyphs, advances);
+
+  for (i = 0; i < glyphs->num_glyphs; i++)
+    {
+      g_assert_cmpint (advances[i], ==, hb_font_get_glyph_h_advance (hb_font, ids[i]));
+      g_assert_cmpint (advances[i], ==, vogue_font_get_glyph_advance (item->analysis.font, ids[i]));
+    }
+
+  g_assert_cmpint (vogue_font_get_glyph_advance (item->analysis.font, PANGO_GLYPH_EMPTY), ==, 0);
+
+  g_free (ids);
+  g_free (advances);
+  vogue_glyph_string_free (glyphs);
+  g_list_free_full (items, (GDestroyNotify)vogue_item_free);
+  g_object_unref (context);
+}
+
 int
 main (int argc, char *argv[])
 {
@@ -202,7 +349,11 @@ main (int argc, char *argv[])
   g_test_add_func ("/vogue/fontdescription/parse", test_parse);
   g_test_add_func ("/vogue/fontdescription/roundtrip", test_roundtrip);
   g_test_add_func ("/vogue/fontdescription/variation", test_variation);
+  g_test_add_func ("/vogue/fontdescription/hash", test_hash);
+  g_test_add_func ("/vogue/fontdescription/hash-copies", test_hash_copies);
+  g_test_add_func ("/vogue/fontdescription/copy-family", test_copy_family);
   g_test_add_func ("/vogue/font/extents", test_extents);
+  g_test_add_func ("/vogue/font/advances", test_advances);
 
   return g_test_run ();
 }
@@ -19,6 +19,8 @@
  * Boston, MA 02111-1307, USA.
  */
 
+#include <string.h>
+
 #include <vogue/vogue.h>
 #include <vogue/voguecairo.h>
 #include "test-common.h"
@@ -55,6 +57,141 @@ test_hb_font (void)
   vogue_font_description_free (desc);
 }
 
+/* Check that shaping a list of items on a thread pool
+ * gives the same glyphs as shaping them one by one
+ */
+static void
+test_shape_items (void)
+{
+  const char *text = "Hello שלום مرحبا नमस्ते สวัสดี 你好 Hello";
+  GList *list, *l;
+  VogueItem **items;
+  VogueGlyphString **serial;
+  VogueGlyphString **parallel;
+  GThreadPool *pool;
+  guint n_items, i;
+  guint hits_before, misses_before, hits, misses;
+  int j;
+
+  list = vogue_itemize (context, text, 0, strlen (text), NULL, NULL);
+  n_items = g_list_length (list);
+  g_assert_cmpuint (n_items, >, 1);
+
+  items = g_new (VogueItem *, n_items);
+  serial = g_new (VogueGlyphString *, n_items);
+  parallel = g_new (VogueGlyphString *, n_items);
+  for (l = list, i = 0; l; l = l->next, i++)
+    {
+      items[i] = l->data;
+      serial[i] = vogue_glyph_string_new ();
+      parallel[i] = vogue_glyph_string_new ();
+    }
+
+  pool = vogue_shape_thread_pool_new (4);
+
+  vogue_shape_plan_cache_get_stats (&hits_before, &misses_before, NULL);
+
+  vogue_shape_items (items, n_items, text, -1, serial, PANGO_SHAPE_NONE, NULL);
+  vogue_shape_items (items, n_items, text, -1, parallel, PANGO_SHAPE_NONE, pool);
+
+  /* Every item looks up a shape plan, and the second pass
+   * finds the plans of the first one
+   */
+  vogue_shape_plan_cache_get_stats (&hits, &misses, NULL);
+  g_assert_cmpuint ((hits - hits_before) + (misses - misses_before), ==, 2 * n_items);
+  g_assert_cmpuint (hits - hits_before, >=, n_items);
+
+  for (i = 0; i < n_items; i++)
+    {
+      g_assert_cmpint (serial[i]->num_glyphs, ==, parallel[i]->num_glyphs);
+      for (j = 0; j < serial[i]->num_glyphs; j++)
+        {
+          g_assert_cmpuint (serial[i]->glyphs[j].glyph, ==, parallel[i]->glyphs[j].glyph);
+          g_assert_cmpint (serial[i]->glyphs[j].geometry.width, ==, parallel[i]->glyphs[j].geometry.width);
+          g_assert_cmpint (serial[i]->log_clusters[j], ==, parallel[i]->log_clusters[j]);
+        }
+
+      vogue_glyph_string_free (serial[i]);
+      vogue_glyph_string_free (parallel[i]);
+    }
+
+  g_thread_pool_free (pool, FALSE, TRUE);
+  g_free (items);
+  g_free (serial);
+  g_free (parallel);
+  g_list_free_full (list, (GDestroyNotify)vogue_item_free);
+}
+
+/* Same as above, but with glyphs that are missing from the fonts,
+ * on fonts that have not been used yet, so that the pool threads
+ * hit the lazily created glyph extents caches and hex box info
+ */
+static void
+test_shape_items_missing (void)
+{
+  /* U+10FFFD is not covered by any font; U+0301 makes
+   * HarfBuzz position a mark on the missing glyph
+   */
+  const char *text = "a\xf4\x8f\xbf\xbd\xcc\x81b \xd7\xa9\xf4\x8f\xbf\xbd\xcc\x81 "
+                     "\xd9\x85\xf4\x8f\xbf\xbd \xe0\xa4\xa8\xf4\x8f\xbf\xbd\xcc\x81 "
+                     "\xe0\xb8\xaa\xf4\x8f\xbf\xbd \xe4\xbd\xa0\xf4\x8f\xbf\xbd\xcc\x81";
+  VogueFontMap *fontmap;
+  VogueContext *fresh_context;
+  GList *list, *l;
+  VogueItem **items;
+  VogueGlyphString **serial;
+  VogueGlyphString **parallel;
+  GThreadPool *pool;
+  guint n_items, i;
+  int j;
+
+  fontmap = vogue_cairo_font_map_new ();
+  fresh_context = vogue_font_map_create_context (fontmap);
+
+  list = vogue_itemize (fresh_context, text, 0, strlen (text), NULL, NULL);
+  n_items = g_list_length (list);
+  g_assert_cmpuint (n_items, >, 1);
+
+  items = g_new (VogueItem *, n_items);
+  serial = g_new (VogueGlyphString *, n_items);
+  parallel = g_new (VogueGlyphString *, n_items);
+  for (l = list, i = 0; l; l = l->next, i++)
+    {
+      items[i] = l->data;
+      serial[i] = vogue_glyph_string_new ();
+      parallel[i] = vogue_glyph_string_new ();
+    }
+
+  pool = vogue_shape_thread_pool_new (4);
+
+  /* Shape on the pool first, while the font caches are cold */
+  vogue_shape_items (items, n_items, text, -1, parallel, PANGO_SHAPE_NONE, pool);
+  vogue_shape_items (items, n_items, text, -1, serial, PANGO_SHAPE_NONE, NULL);
+
+  for (i = 0; i < n_items; i++)
+    {
+      g_assert_cmpint (serial[i]->num_glyphs, ==, parallel[i]->num_glyphs);
+      for (j = 0; j < serial[i]->num_glyphs; j++)
+        {
+          g_assert_cmpuint (serial[i]->glyphs[j].glyph, ==, parallel[i]->glyphs[j].glyph);
+          g_assert_cmpint (serial[i]->glyphs[j].geometry.width, ==, parallel[i]->glyphs[j].geometry.width);
+          g_assert_cmpint (serial[i]->glyphs[j].geometry.x_offset, ==, parallel[i]->glyphs[j].geometry.x_offset);
+          g_assert_cmpint (serial[i]->glyphs[j].geometry.y_offset, ==, parallel[i]->glyphs[j].geometry.y_offset);
+        }
+
+      vogue_glyph_string_free (serial[i]);
+      vogue_glyph_string_free (parallel[i]);
+    }
+
+  g_thread_pool_free (pool, FALSE, TRUE);
+  g_free (items);
+  g_free (serial);
+  g_free (parallel);
+  g_list_free_full (list, (GDestroyNotify)vogue_item_free);
+  g_object_unref (fresh_context);
+  g_object_unref (fontmap);
+}
+
 int
 main (int argc, char *argv[])
 {
@@ -66,6 +203,8 @@ main (int argc, char *argv[])
   g_test_init (&argc, &argv, NULL);
 
   g_test_add_func ("/harfbuzz/font", test_hb_font);
+  g_test_add_func ("/harfbuzz/shape-items", test_shape_items);
+  g_test_add_func ("/harfbuzz/shape-items-missing", test_shape_items_missing);
 
   return g_test_run ();
 }
@@ -88,6 +88,28 @@ test_attributes_equal (void)
   vogue_attribute_destroy (attr3);
 }
 
+static void
+test_attributes_font_desc (void)
+{
+  VogueFontDescription *desc;
+  VogueAttribute *attr1, *attr2;
+
+  desc = vogue_font_description_from_string ("Sans Bold 12");
+  attr1 = vogue_attr_font_desc_new (desc);
+  attr2 = vogue_attribute_copy (attr1);
+  vogue_font_description_free (desc);
+
+  /* Each attribute owns its description */
+  vogue_font_description_set_weight (((VogueAttrFontDesc *)attr1)->desc, PANGO_WEIGHT_NORMAL);
+  vogue_font_description_set_family (((VogueAttrFontDesc *)attr1)->desc, "Serif");
+  g_assert_cmpint (vogue_font_description_get_weight (((VogueAttrFontDesc *)attr2)->desc), ==, PANGO_WEIGHT_BOLD);
+  g_assert_cmpstr (vogue_font_description_get_family (((VogueAttrFontDesc *)attr2)->desc), ==, "Sans");
+  g_assert_false (vogue_attribute_equal (attr1, attr2));
+
+  vogue_attribute_destroy (attr1);
+  vogue_attribute_destroy (attr2);
+}
+
 static void
 assert_attributes (GSList     *attrs,
                    const char *expected)
@@ -606,6 +628,300 @@ test_list_update (void)
   vogue_attr_list_unref (list);
 }
 
+static void
+test_list_change_order (void)
+{
+  VogueAttrList *forward, *backward;
+  GSList *attrs;
+  GString *s1, *s2;
+  int i;
+
+  forward = vogue_attr_list_new ();
+  backward = vogue_attr_list_new ();
+
+  vogue_attr_list_insert (forward, vogue_attr_size_new (10));
+  vogue_attr_list_insert (backward, vogue_attr_size_new (10));
+
+  /* Changing in reverse order used to walk the whole list each time */
+  for (i = 0; i < 2000; i++)
+    {
+      VogueAttribute *attr;
+      int j = 1999 - i;
+
+      attr = vogue_attr_weight_new (i % 3 ? PANGO_WEIGHT_BOLD : PANGO_WEIGHT_LIGHT);
+      attr->start_index = 10 * i;
+      attr->end_index = 10 * i + 15;
+      vogue_attr_list_change (forward, attr);
+
+      attr = vogue_attr_weight_new (j % 3 ? PANGO_WEIGHT_BOLD : PANGO_WEIGHT_LIGHT);
+      attr->start_index = 10 * j;
+      attr->end_index = 10 * j + 15;
+      vogue_attr_list_change (backward, attr);
+    }
+
+  s1 = g_string_new ("");
+  attrs = vogue_attr_list_get_attributes (forward);
+  print_attributes (attrs, s1);
+  g_slist_free_full (attrs, (GDestroyNotify)vogue_attribute_destroy);
+
+  s2 = g_string_new ("");
+  attrs = vogue_attr_list_get_attributes (backward);
+  print_attributes (attrs, s2);
+  g_slist_free_full (attrs, (GDestroyNotify)vogue_attribute_destroy);
+
+  /* The lists differ where a later change overrides an earlier one */
+  g_assert_true (g_str_has_prefix (s1->str, "[0,-1]size=10\n[0,10]weight=300\n"));
+  g_assert_true (g_str_has_prefix (s2->str, "[0,-1]size=10\n[0,15]weight=300\n"));
+  g_assert_true (g_str_has_suffix (s1->str, "[19990,20005]weight=700\n"));
+  g_assert_true (g_str_has_suffix (s2->str, "[19995,20005]weight=700\n"));
+
+  g_string_free (s1, TRUE);
+  g_string_free (s2, TRUE);
+
+  vogue_attr_list_unref (forward);
+  vogue_attr_list_unref (backward);
+}
+
+static void
+test_list_change_long (void)
+{
+  VogueAttrList *list;
+  VogueAttribute *attr;
+  GSList *attrs;
+  GString *s;
+  int i;
+
+  list = vogue_attr_list_new ();
+
+  /* An attribute spanning the whole text used to make every later
+   * change look at all the attributes after it.
+   */
+  attr = vogue_attr_size_new (10);
+  attr->start_index = 0;
+  attr->end_index = 20000;
+  vogue_attr_list_change (list, attr);
+
+  for (i = 0; i < 2000; i++)
+    {
+      attr = vogue_attr_weight_new (i % 2 ? PANGO_WEIGHT_BOLD : PANGO_WEIGHT_LIGHT);
+      attr->start_index = 10 * i;
+      attr->end_index = 10 * i + 5;
+      vogue_attr_list_change (list, attr);
+    }
+
+  /* Changing the long attribute in the middle splits it */
+  attr = vogue_attr_size_new (20);
+  attr->start_index = 10000;
+  attr->end_index = 10010;
+  vogue_attr_list_change (list, attr);
+
+  s = g_string_new ("");
+  attrs = vogue_attr_list_get_attributes (list);
+  g_assert_cmpint (g_slist_length (attrs), ==, 2003);
+  print_attributes (attrs, s);
+  g_slist_free_full (attrs, (GDestroyNotify)vogue_attribute_destroy);
+
+  g_assert_true (g_str_has_prefix (s->str, "[0,10000]size=10\n"
+                                           "[0,5]weight=300\n"));
+  g_assert_nonnull (strstr (s->str, "[9990,9995]weight=700\n"
+                                    "[10000,10005]weight=300\n"
+                                    "[10000,10010]size=20\n"
+                                    "[10010,10015]weight=700\n"
+                                    "[10010,20000]size=10\n"
+                                    "[10020,10025]weight=300\n"));
+  g_assert_true (g_str_has_suffix (s->str, "[19990,19995]weight=700\n"));
+
+  g_string_free (s, TRUE);
+  vogue_attr_list_unref (list);
+}
+
+static void
+test_list_insert_order (void)
+{
+  VogueAttrList *forward, *backward, *list;
+  VogueAttribute *attr;
+  GSList *attrs;
+  GString *s1, *s2;
+  int i;
+
+  forward = vogue_attr_list_new ();
+  backward = vogue_attr_list_new ();
+
+  /* Inserting in reverse order used to move the whole array each time */
+  for (i = 0; i < 2000; i++)
+    {
+      int j = 1999 - i;
+
+      attr = vogue_attr_weight_new (i % 3 ? PANGO_WEIGHT_BOLD : PANGO_WEIGHT_LIGHT);
+      attr->start_index = 10 * i;
+      attr->end_index = 10 * i + 15;
+      vogue_attr_list_insert (forward, attr);
+
+      attr = vogue_attr_weight_new (j % 3 ? PANGO_WEIGHT_BOLD : PANGO_WEIGHT_LIGHT);
+      attr->start_index = 10 * j;
+      attr->end_index = 10 * j + 15;
+      if (j % 2)
+        vogue_attr_list_insert (backward, attr);
+      else
+        vogue_attr_list_insert_before (backward, attr);
+    }
+
+  s1 = g_string_new ("");
+  attrs = vogue_attr_list_get_attributes (forward);
+  print_attributes (attrs, s1);
+  g_slist_free_full (attrs, (GDestroyNotify)vogue_attribute_destroy);
+
+  s2 = g_string_new ("");
+  attrs = vogue_attr_list_get_attributes (backward);
+  print_attributes (attrs, s2);
+  g_slist_free_full (attrs, (GDestroyNotify)vogue_attribute_destroy);
+
+  g_assert_cmpstr (s1->str, ==, s2->str);
+
+  g_string_free (s1, TRUE);
+  g_string_free (s2, TRUE);
+
+  vogue_attr_list_unref (forward);
+  vogue_attr_list_unref (backward);
+
+  /* Attributes with the same start index keep the order they
+   * would have had if each had been put in place right away.
+   */
+  list = vogue_attr_list_new ();
+  attr = vogue_attr_size_new (50);
+  attr->start_index = 5;
+  attr->end_index = 6;
+  vogue_attr_list_insert (list, attr);
+  attr = vogue_attr_size_new (60);
+  attr->start_index = 0;
+  attr->end_index = 1;
+  vogue_attr_list_insert (list, attr);
+  for (i = 1; i <= 4; i++)
+    {
+      attr = vogue_attr_size_new (10 * i);
+      attr->start_index = 5;
+      attr->end_index = 6;
+      if (i % 2)
+        vogue_attr_list_insert (list, attr);
+      else
+        vogue_attr_list_insert_before (list, attr);
+    }
+
+  assert_attr_list (list, "[0,1]size=60\n"
+                          "[5,6]size=40\n"
+                          "[5,6]size=20\n"
+                          "[5,6]size=50\n"
+                          "[5,6]size=10\n"
+                          "[5,6]size=30\n");
+
+  /* Changes see the attributes inserted before them */
+  attr = vogue_attr_size_new (70);
+  attr->start_index = 0;
+  attr->end_index = 10;
+  vogue_attr_list_change (list, attr);
+  assert_attr_list (list, "[0,10]size=70\n");
+
+  vogue_attr_list_unref (list);
+}
+
+static void
+test_list_from_sorted (void)
+{
+  VogueAttrList *list;
+  VogueAttrListBuilder *builder;
+  VogueAttribute *attrs[3];
+  const char *expected = "[0,-1]size=10\n"
+                         "[0,-1]size=30\n"
+                         "[10,40]size=40\n"
+                         "[10,20]size=20\n";
+
+  attrs[0] = vogue_attr_size_new (10);
+  attrs[1] = vogue_attr_size_new (20);
+  attrs[1]->start_index = 10;
+  attrs[1]->end_index = 20;
+  attrs[2] = vogue_attr_size_new (30);
+
+  /* Out of order input ends up as with vogue_attr_list_insert() */
+  list = vogue_attr_list_new_from_sorted (attrs, 3, FALSE);
+  assert_attr_list (list, "[0,-1]size=10\n"
+                          "[0,-1]size=30\n"
+                          "[10,20]size=20\n");
+  vogue_attr_list_unref (list);
+
+  list = vogue_attr_list_new_from_sorted (attrs, 3, TRUE);
+  attrs[0] = vogue_attr_size_new (40);
+  attrs[0]->start_index = 10;
+  attrs[0]->end_index = 40;
+  vogue_attr_list_insert_before (list, attrs[0]);
+  assert_attr_list (list, expected);
+  vogue_attr_list_unref (list);
+
+  list = vogue_attr_list_new_from_sorted (NULL, 0, TRUE);
+  assert_attr_list (list, "");
+  vogue_attr_list_unref (list);
+
+  builder = vogue_attr_list_builder_new (0);
+  vogue_attr_list_builder_append (builder, vogue_attr_size_new (10));
+  vogue_attr_list_builder_append (builder, vogue_attr_size_new (30));
+  attrs[0] = vogue_attr_size_new (40);
+  attrs[0]->start_index = 10;
+  attrs[0]->end_index = 40;
+  vogue_attr_list_builder_append (builder, attrs[0]);
+  attrs[0] = vogue_attr_size_new (20);
+  attrs[0]->start_index = 10;
+  attrs[0]->end_index = 20;
+  vogue_attr_list_builder_append (builder, attrs[0]);
+  list = vogue_attr_list_builder_end (builder);
+  assert_attr_list (list, expected);
+  vogue_attr_list_unref (list);
+
+  builder = vogue_attr_list_builder_new (1);
+  vogue_attr_list_builder_append (builder, vogue_attr_size_new (10));
+  vogue_attr_list_builder_free (builder);
+}
+
+static void
+test_list_copy_on_write (void)
+{
+  VogueAttrList *list, *copy, *copy2;
+  VogueAttribute *attr;
+
+  list = vogue_attr_list_new ();
+  attr = vogue_attr_size_new (10);
+  attr->start_index = 0;
+  attr->end_index = 20;
+  vogue_attr_list_insert (list, attr);
+  attr = vogue_attr_weight_new (PANGO_WEIGHT_BOLD);
+  attr->start_index = 5;
+  attr->end_index = 10;
+  vogue_attr_list_insert (list, attr);
+
+  copy = vogue_attr_list_copy (list);
+  copy2 = vogue_attr_list_copy (copy);
+
+  /* Changing one copy leaves the others alone */
+  attr = vogue_attr_size_new (20);
+  attr->start_index = 0;
+  attr->end_index = 5;
+  vogue_attr_list_change (copy, attr);
+
+  assert_attr_list (list, "[0,20]size=10\n"
+                          "[5,10]weight=700\n");
+  assert_attr_list (copy, "[0,5]size=20\n"
+                          "[5,20]size=10\n"
+                          "[5,10]weight=700\n");
+  assert_attr_list (copy2, "[0,20]size=10\n"
+                           "[5,10]weight=700\n");
+
+  vogue_attr_list_unref (list);
+  vogue_attr_list_update (copy2, 0, 5, 0);
+  assert_attr_list (copy2, "[0,15]size=10\n"
+                           "[0,5]weight=700\n");
+
+  vogue_attr_list_unref (copy);
+  vogue_attr_list_unref (copy2);
+}
+
 int
 main (int argc, char *argv[])
 {
@@ -613,8 +929,14 @@ main (int argc, char *argv[])
 
   g_test_add_func ("/attributes/basic", test_attributes_basic);
   g_test_add_func ("/attributes/equal", test_attributes_equal);
+  g_test_add_func ("/attributes/font-desc", test_attributes_font_desc);
   g_test_add_func ("/attributes/list/basic", test_list);
   g_test_add_func ("/attributes/list/change", test_list_change);
+  g_test_add_func ("/attributes/list/change-order", test_list_change_order);
+  g_test_add_func ("/attributes/list/change-long", test_list_change_long);
+  g_test_add_func ("/attributes/list/insert-order", test_list_insert_order);
+  g_test_add_func ("/attributes/list/from-sorted", test_list_from_sorted);
+  g_test_add_func ("/attributes/list/copy-on-write", test_list_copy_on_write);
   g_test_add_func ("/attributes/list/splice", test_list_splice);
   g_test_add_func ("/attributes/list/filter", test_list_filter);
   g_test_add_func ("/attributes/list/update", test_list_update);
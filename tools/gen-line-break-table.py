@@ -0,0 +1,210 @@
+#!/usr/bin/env python3
+#
+# Generates vogue/vogue-line-break-table.h, the pair tables
+# used by vogue_default_break() for UAX #14 line breaking.
+#
+# Usage: ./gen-line-break-table.py > ../vogue/vogue-line-break-table.h
+#
+# The rules below mirror the order in which vogue_default_break()
+# used to evaluate them: later rules take precedence over earlier
+# ones. Each rule gets a rank; a table entry records the outcome of
+# the highest-ranked rule that fires for a (previous, current) pair
+# of line break classes. Rules that need more context than the pair
+# (the character after, the class before the previous one, the
+# numeric and regional indicator state, ...) are evaluated in C and
+# compared by rank against the table entry, so the combined result is
+# the same as evaluating every rule in order.
+
+from __future__ import print_function
+import sys
+
+# GUnicodeBreakType values, by their short UAX #14 names.
+# Only the symbolic names are written out, so the order does not matter.
+classes = [
+    ('BK', 'MANDATORY'),
+    ('CR', 'CARRIAGE_RETURN'),
+    ('LF', 'LINE_FEED'),
+    ('CM', 'COMBINING_MARK'),
+    ('SG', 'SURROGATE'),
+    ('ZW', 'ZERO_WIDTH_SPACE'),
+    ('IN', 'INSEPARABLE'),
+    ('GL', 'NON_BREAKING_GLUE'),
+    ('CB', 'CONTINGENT'),
+    ('SP', 'SPACE'),
+    ('BA', 'AFTER'),
+    ('BB', 'BEFORE'),
+    ('B2', 'BEFORE_AND_AFTER'),
+    ('HY', 'HYPHEN'),
+    ('NS', 'NON_STARTER'),
+    ('OP', 'OPEN_PUNCTUATION'),
+    ('CL', 'CLOSE_PUNCTUATION'),
+    ('QU', 'QUOTATION'),
+    ('EX', 'EXCLAMATION'),
+    ('ID', 'IDEOGRAPHIC'),
+    ('NU', 'NUMERIC'),
+    ('IS', 'INFIX_SEPARATOR'),
+    ('SY', 'SYMBOL'),
+    ('AL', 'ALPHABETIC'),
+    ('PR', 'PREFIX'),
+    ('PO', 'POSTFIX'),
+    ('SA', 'COMPLEX_CONTEXT'),
+    ('AI', 'AMBIGUOUS'),
+    ('XX', 'UNKNOWN'),
+    ('NL', 'NEXT_LINE'),
+    ('WJ', 'WORD_JOINER'),
+    ('JL', 'HANGUL_L_JAMO'),
+    ('JV', 'HANGUL_V_JAMO'),
+    ('JT', 'HANGUL_T_JAMO'),
+    ('H2', 'HANGUL_LV_SYLLABLE'),
+    ('H3', 'HANGUL_LVT_SYLLABLE'),
+    ('CP', 'CLOSE_PARANTHESIS'),
+    ('CJ', 'CONDITIONAL_JAPANESE_STARTER'),
+    ('HL', 'HEBREW_LETTER'),
+    ('RI', 'REGIONAL_INDICATOR'),
+    ('EB', 'EMOJI_BASE'),
+    ('EM', 'EMOJI_MODIFIER'),
+    ('ZWJ', 'ZERO_WIDTH_JOINER'),
+]
+
+names = [c[0] for c in classes]
+glib_name = dict((c[0], 'G_UNICODE_BREAK_' + c[1]) for c in classes)
+
+# Values of BreakOpportunity in break.c
+ALREADY_HANDLED, PROHIBITED, IF_SPACES, ALLOWED = range(4)
+
+P = PROHIBITED
+A = ALLOWED
+
+# (rank, rule, outcome, condition on previous, current and row class).
+# The row class is the previous class, skipping one run of spaces,
+# as used by the rules that apply "even if spaces intervene".
+# Ranks that are missing here belong to the context rules listed
+# in context_rules, which break.c evaluates itself.
+pair_rules = [
+    (1,  'LB30',  P, lambda p, c, r: p in ('AL', 'HL', 'NU') and c == 'OP'),
+    (2,  'LB30',  P, lambda p, c, r: p == 'CP' and c in ('AL', 'HL', 'NU')),
+    (4,  'LB30b', P, lambda p, c, r: p == 'EB' and c == 'EM'),
+    (5,  'LB29',  P, lambda p, c, r: p == 'IS' and c in ('AL', 'HL')),
+    (6,  'LB28',  P, lambda p, c, r: p in ('AL', 'HL') and c in ('AL', 'HL')),
+    (7,  'LB27',  P, lambda p, c, r: p in ('JL', 'JV', 'JT', 'H2', 'H3') and c in ('IN', 'PO')),
+    (8,  'LB27',  P, lambda p, c, r: p == 'PR' and c in ('JL', 'JV', 'JT', 'H2', 'H3')),
+    (9,  'LB26',  P, lambda p, c, r: p == 'JL' and c in ('JL', 'JV', 'H2', 'H3')),
+    (10, 'LB26',  P, lambda p, c, r: p in ('JV', 'H2') and c in ('JV', 'JT')),
+    (11, 'LB26',  P, lambda p, c, r: p in ('JT', 'H3') and c == 'JT'),
+    (12, 'LB25',  P, lambda p, c, r: p in ('PR', 'PO') and c == 'NU'),
+    (14, 'LB25',  P, lambda p, c, r: p in ('OP', 'HY') and c == 'NU'),
+    (15, 'LB25',  P, lambda p, c, r: p == 'NU' and c in ('NU', 'SY', 'IS')),
+    (18, 'LB24',  P, lambda p, c, r: p in ('PR', 'PO') and c in ('AL', 'HL')),
+    (19, 'LB24',  P, lambda p, c, r: p in ('AL', 'HL') and c in ('PR', 'PO')),
+    (20, 'LB23',  P, lambda p, c, r: p in ('AL', 'HL') and c == 'NU'),
+    (21, 'LB23',  P, lambda p, c, r: p == 'NU' and c in ('AL', 'HL')),
+    (22, 'LB23a', P, lambda p, c, r: p == 'PR' and c in ('ID', 'EB', 'EM')),
+    (23, 'LB23a', P, lambda p, c, r: p in ('ID', 'EB', 'EM') and c == 'PO'),
+    (24, 'LB22',  P, lambda p, c, r: c == 'IN' and p in ('AL', 'HL', 'EX', 'ID', 'EB', 'EM', 'IN', 'NU')),
+    (25, 'LB21',  P, lambda p, c, r: c in ('BA', 'HY', 'NS') or p == 'BB'),
+    (27, 'LB21b', P, lambda p, c, r: p == 'SY' and c == 'HL'),
+    (28, 'LB20',  A, lambda p, c, r: p == 'CB' or c == 'CB'),
+    (29, 'LB19',  P, lambda p, c, r: p == 'QU' or c == 'QU'),
+    (30, 'LB18',  A, lambda p, c, r: p == 'SP'),
+    (31, 'LB17',  P, lambda p, c, r: r == 'B2' and c == 'B2'),
+    (32, 'LB16',  P, lambda p, c, r: r in ('CL', 'CP') and c == 'NS'),
+    (33, 'LB15',  P, lambda p, c, r: r == 'QU' and c == 'OP'),
+    (34, 'LB14',  P, lambda p, c, r: r == 'OP'),
+    (35, 'LB13',  P, lambda p, c, r: c == 'EX'),
+    (36, 'LB13',  P, lambda p, c, r: p != 'NU' and c in ('CL', 'CP', 'IS', 'SY')),
+    (37, 'LB12',  P, lambda p, c, r: p == 'GL'),
+    (38, 'LB12a', P, lambda p, c, r: c == 'GL' and p not in ('SP', 'BA', 'HY')),
+    (39, 'LB11',  P, lambda p, c, r: p == 'WJ' or c == 'WJ'),
+    (40, 'LB9',   P, lambda p, c, r: c in ('CM', 'ZWJ') and p not in ('BK', 'CR', 'LF', 'NL', 'SP', 'ZW')),
+    (41, 'LB8',   A, lambda p, c, r: r == 'ZW'),
+    (43, 'LB7',   P, lambda p, c, r: c in ('SP', 'ZW')),
+    (44, 'LB6',   P, lambda p, c, r: c in ('BK', 'CR', 'LF', 'NL')),
+]
+
+# Rules evaluated in break.c, with the ranks they compete at
+context_rules = [
+    (3,  'LB30A_RI',             'regional indicator pairs'),
+    (13, 'LB25_PREFIX_NUMERIC',  '(PR | PO) x (OP | HY) NU'),
+    (16, 'LB25_NUMERIC',         'NU (SY | IS)* x (NU | SY | IS | CL | CP)'),
+    (17, 'LB25_NUMERIC_POSTFIX', 'NU (SY | IS)* (CL | CP)? x (PO | PR)'),
+    (26, 'LB21A',                'HL (HY | BA) x'),
+    (42, 'LB8A',                 'ZWJ x'),
+]
+
+assert max(r[0] for r in pair_rules + context_rules) < 64
+ranks = sorted(r[0] for r in pair_rules + context_rules)
+assert ranks == list(range(1, len(ranks) + 1)), "ranks must be unique and contiguous"
+
+
+def lookup(prev, cur, row):
+    # The row class is taken as AL at the start of text
+    if row == 'XX':
+        row = 'AL'
+    op, rank = ALREADY_HANDLED, 0
+    for r, name, outcome, cond in pair_rules:
+        if cond(prev, cur, row):
+            op, rank = outcome, r
+    return (rank << 2) | op
+
+
+def print_table(name, comment, entry):
+    print('/* %s */' % comment)
+    print('static const guint8 %s[LINE_BREAK_N_CLASSES][LINE_BREAK_N_CLASSES] = {' % name)
+    for first in names:
+        cells = []
+        for cur in names:
+            value = entry(first, cur)
+            if value:
+                cells.append('[%s] = 0x%02X' % (glib_name[cur], value))
+        if not cells:
+            continue
+        print('  [%s] = {' % glib_name[first])
+        for i in range(0, len(cells), 3):
+            print('    ' + ', '.join(cells[i:i + 3]) + ',')
+        print('  },')
+    print('};')
+    print()
+
+
+def main():
+    print('/* == Start of generated table == */')
+    print('/*')
+    print(' * The following tables are generated by running:')
+    print(' *')
+    print(' *   ./gen-line-break-table.py > vogue-line-break-table.h')
+    print(' *')
+    print(' * Each entry holds the BreakOpportunity of the highest-ranked')
+    print(' * UAX #14 pair rule that applies in its low two bits, and the')
+    print(' * rank of that rule in the remaining bits.')
+    print(' */')
+    print()
+    print('#ifndef PANGO_LINE_BREAK_TABLE_H')
+    print('#define PANGO_LINE_BREAK_TABLE_H')
+    print()
+    print('#include <glib.h>')
+    print()
+    print('#define LINE_BREAK_N_CLASSES (G_UNICODE_BREAK_ZERO_WIDTH_JOINER + 1)')
+    print()
+    print('#define LINE_BREAK_OP(entry)   ((entry) & 3)')
+    print('#define LINE_BREAK_RANK(entry) ((entry) >> 2)')
+    print()
+    print('/* Ranks of the rules that need more context than a pair of classes */')
+    for rank, name, comment in context_rules:
+        print('#define LINE_BREAK_RANK_%-22s %2d /* %s */' % (name, rank, comment))
+    print()
+    print_table('_vogue_line_break_pair_table',
+                'Indexed by the previous and current class, for a previous class other than SP',
+                lambda prev, cur: 0 if prev == 'SP' else lookup(prev, cur, prev))
+    print_table('_vogue_line_break_space_table',
+                'Indexed by the class before the spaces and the current class, for a previous class of SP',
+                lambda row, cur: 0 if row == 'SP' else lookup('SP', cur, row))
+    print('#endif /* PANGO_LINE_BREAK_TABLE_H */')
+    print()
+    print('/* == End of generated table == */')
+
+
+if __name__ == '__main__':
+    if len(sys.argv) != 1:
+        print('usage: ./gen-line-break-table.py > vogue-line-break-table.h', file=sys.stderr)
+        sys.exit(1)
+    main()
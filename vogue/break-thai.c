@@ -23,6 +23,8 @@
 #include "vogue-break.h"
 #include "vogue-impl-utils.h"
 
+#include <string.h>
+
 #ifdef HAVE_LIBTHAI
 #include <thai/thwchar.h>
 #include <thai/thbrk.h>
@@ -31,6 +33,118 @@
 G_LOCK_DEFINE_STATIC (th_brk);
 #endif
 
+/* Each thread gets its own breaker, so that breaking Thai text
+ * in several threads at once doesn't serialize, and a small LRU
+ * cache of break positions, since the same Thai runs (UI strings,
+ * for instance) tend to be laid out over and over again.
+ */
+#define THAI_CACHE_SIZE 64
+#define THAI_CACHE_MAX_LENGTH 1024
+
+typedef struct
+{
+  GList link;
+  char *text;
+  int n_breaks;
+  int breaks[];
+} ThaiCacheEntry;
+
+typedef struct
+{
+#ifdef HAVE_TH_BRK_FIND_BREAKS
+  ThBrk *brk;
+#endif
+  GHashTable *cache;
+  GQueue lru;
+} ThaiBreaker;
+
+static void
+thai_cache_entry_free (gpointer data)
+{
+  ThaiCacheEntry *entry = data;
+
+  g_free (entry->text);
+  g_free (entry);
+}
+
+static void
+thai_breaker_free (gpointer data)
+{
+  ThaiBreaker *breaker = data;
+
+#ifdef HAVE_TH_BRK_FIND_BREAKS
+  if (breaker->brk)
+    th_brk_delete (breaker->brk);
+#endif
+  g_hash_table_destroy (breaker->cache);
+  g_free (breaker);
+}
+
+static GPrivate thai_breaker = G_PRIVATE_INIT (thai_breaker_free);
+
+static ThaiBreaker *
+get_thai_breaker (void)
+{
+  ThaiBreaker *breaker = g_private_get (&thai_breaker);
+
+  if (G_UNLIKELY (!breaker))
+    {
+      breaker = g_new0 (ThaiBreaker, 1);
+#ifdef HAVE_TH_BRK_FIND_BREAKS
+      /* If this fails, we fall back to the shared breaker */
+      breaker->brk = th_brk_new (NULL);
+#endif
+      breaker->cache = g_hash_table_new_full (g_str_hash, g_str_equal,
+                                              NULL, thai_cache_entry_free);
+      g_queue_init (&breaker->lru);
+      g_private_set (&thai_breaker, breaker);
+    }
+
+  return breaker;
+}
+
+static ThaiCacheEntry *
+thai_cache_lookup (ThaiBreaker *breaker,
+                   const char  *text)
+{
+  ThaiCacheEntry *entry;
+
+  entry = g_hash_table_lookup (breaker->cache, text);
+  if (entry && breaker->lru.head != &entry->link)
+    {
+      g_queue_unlink (&breaker->lru, &entry->link);
+      g_queue_push_head_link (&breaker->lru, &entry->link);
+    }
+
+  return entry;
+}
+
+static void
+thai_cache_insert (ThaiBreaker *breaker,
+                   const char  *text,
+                   const int   *breaks,
+                   int          n_breaks)
+{
+  ThaiCacheEntry *entry;
+
+  if (breaker->lru.length >= THAI_CACHE_SIZE)
+    {
+      GList *last = g_queue_pop_tail_link (&breaker->lru);
+
+      g_hash_table_remove (breaker->cache, ((ThaiCacheEntry *) last->data)->text);
+    }
+
+  entry = g_malloc (sizeof (ThaiCacheEntry) + n_breaks * sizeof (int));
+  entry->text = g_strdup (text);
+  entry->n_breaks = n_breaks;
+  memcpy (entry->breaks, breaks, n_breaks * sizeof (int));
+  entry->link.data = entry;
+  entry->link.prev = entry->link.next = NULL;
+
+  g_queue_push_head_link (&breaker->lru, &entry->link);
+  g_hash_table_insert (breaker->cache, entry->text, entry);
+}
+
 /*
  * tis_text is assumed to be large enough to hold the converted string,
  * i.e. it must be at least vogue_utf8_strlen(text, len)+1 bytes.
@@ -61,32 +175,55 @@ break_thai (const char          *text,
 #ifdef HAVE_LIBTHAI
   thchar_t tis_stack[512];
   int brk_stack[512];
-  thchar_t *tis_text;
-  int *brk_pnts;
+  char key[THAI_CACHE_MAX_LENGTH + 1];
+  ThaiBreaker *breaker;
+  ThaiCacheEntry *entry = NULL;
+  thchar_t *tis_text = tis_stack;
+  int *brk_pnts = brk_stack;
+  gboolean cacheable;
   int cnt;
 
-  cnt = vogue_utf8_strlen (text, len) + 1;
+  breaker = get_thai_breaker ();
+
+  cacheable = len <= THAI_CACHE_MAX_LENGTH;
+  if (cacheable)
+    {
+      memcpy (key, text, len);
+      key[len] = '\0';
+      entry = thai_cache_lookup (breaker, key);
+    }
+
+  if (entry)
+    {
+      brk_pnts = entry->breaks;
+      len = entry->n_breaks;
+    }
+  else
+    {
+      cnt = vogue_utf8_strlen (text, len) + 1;
 
-  tis_text = tis_stack;
-  if (cnt > (int) G_N_ELEMENTS (tis_stack))
-    tis_text = g_new (thchar_t, cnt);
+      if (cnt > (int) G_N_ELEMENTS (tis_stack))
+        tis_text = g_new (thchar_t, cnt);
 
-  utf8_to_tis (text, len, tis_text, &cnt);
+      utf8_to_tis (text, len, tis_text, &cnt);
 
-  brk_pnts = brk_stack;
-  if (cnt > (int) G_N_ELEMENTS (brk_stack))
-    brk_pnts = g_new (int, cnt);
+      if (cnt > (int) G_N_ELEMENTS (brk_stack))
+        brk_pnts = g_new (int, cnt);
 
-  /* find line break positions */
+      /* find line break positions */
 
 #ifdef HAVE_TH_BRK_FIND_BREAKS
-  len = th_brk_find_breaks(NULL, tis_text, brk_pnts, cnt);
+      len = th_brk_find_breaks (breaker->brk, tis_text, brk_pnts, cnt);
 #else
-  G_LOCK (th_brk);
-  len = th_brk (tis_text, brk_pnts, cnt);
-  G_UNLOCK (th_brk);
+      G_LOCK (th_brk);
+      len = th_brk (tis_text, brk_pnts, cnt);
+      G_UNLOCK (th_brk);
 #endif
 
+      if (cacheable)
+        thai_cache_insert (breaker, key, brk_pnts, len);
+    }
+
   for (cnt = 0; cnt < len; cnt++)
     if (attrs[brk_pnts[cnt]].is_line_break)
     {
@@ -99,7 +236,7 @@ break_thai (const char          *text,
       attrs[brk_pnts[cnt]].is_word_end = TRUE;
     }
 
-  if (brk_pnts != brk_stack)
+  if (brk_pnts != brk_stack && !entry)
     g_free (brk_pnts);
 
   if (tis_text != tis_stack)
@@ -22,9 +22,11 @@
 #include "config.h"
 
 #include "vogue-break.h"
+#include "vogue-break-private.h"
 #include "vogue-script-private.h"
 #include "vogue-emoji-private.h"
 #include "vogue-break-table.h"
+#include "vogue-line-break-table.h"
 #include "vogue-impl-utils.h"
 #include <string.h>
 
@@ -138,26 +140,552 @@ typedef enum
 } WordType;
 
 
-/**
- * vogue_default_break:
- * @text: text to break. Must be valid UTF-8
- * @length: length of text in bytes (may be -1 if @text is nul-terminated)
- * @analysis: (nullable): a #VogueAnalysis for the @text
- * @attrs: logical attributes to fill in
- * @attrs_len: size of the array passed as @attrs
- *
- * This is the default break algorithm. It applies Unicode
- * rules without language-specific tailoring, therefore
- * the @analyis argument is unused and can be %NULL.
+/* See Grapheme_Cluster_Break Property Values table of UAX#29 */
+typedef enum
+{
+  GB_Other,
+  GB_ControlCRLF,
+  GB_Extend,
+  GB_ZWJ,
+  GB_Prepend,
+  GB_SpacingMark,
+  GB_InHangulSyllable, /* Handles all of L, V, T, LV, LVT rules */
+  /* Use state machine to handle emoji sequence */
+  /* Rule GB12 and GB13 */
+  GB_RI_Odd, /* Meets odd number of RI */
+  GB_RI_Even, /* Meets even number of RI */
+} GraphemeBreakType;
+
+/* See Word_Break Property Values table of UAX#29 */
+typedef enum
+{
+  WB_Other,
+  WB_NewlineCRLF,
+  WB_ExtendFormat,
+  WB_Katakana,
+  WB_Hebrew_Letter,
+  WB_ALetter,
+  WB_MidNumLet,
+  WB_MidLetter,
+  WB_MidNum,
+  WB_Numeric,
+  WB_ExtendNumLet,
+  WB_RI_Odd,
+  WB_RI_Even,
+  WB_WSegSpace,
+} WordBreakType;
+
+/* See Sentence_Break Property Values table of UAX#29 */
+typedef enum
+{
+  SB_Other,
+  SB_ExtendFormat,
+  SB_ParaSep,
+  SB_Sp,
+  SB_Lower,
+  SB_Upper,
+  SB_OLetter,
+  SB_Numeric,
+  SB_ATerm,
+  SB_SContinue,
+  SB_STerm,
+  SB_Close,
+  /* Rules SB8 and SB8a */
+  SB_ATerm_Close_Sp,
+  SB_STerm_Close_Sp,
+} SentenceBreakType;
+
+/* The properties of a character that vogue_default_break() needs,
+ * as computed by GLib, together with the parts of its UAX #29
+ * classes that do not depend on the surrounding text.
  *
- * See vogue_tailor_break() for language-specific breaks.
- **/
-void
-vogue_default_break (const gchar   *text,
-		     gint           length,
-		     VogueAnalysis *analysis G_GNUC_UNUSED,
-		     VogueLogAttr  *attrs,
-		     int            attrs_len G_GNUC_UNUSED)
+ * Finding these with the GLib and emoji tables, and then working
+ * out the classes, took most of the time of vogue_default_break().
+ * They are now computed once for each block of code points that
+ * is met, from the very same functions, so results do not change.
+ */
+typedef struct
+{
+  guint8 break_type;	/* GUnicodeBreakType, after BREAK_TYPE_SAFE() */
+  guint8 type;		/* GUnicodeType */
+  guint8 flags;
+  guint8 GB_type;	/* GraphemeBreakType; GB_RI_Odd for all regional indicators */
+  guint8 WB_type;	/* WordBreakType; WB_RI_Odd for all regional indicators */
+  guint8 SB_type;	/* SentenceBreakType */
+} CharProps;
+
+enum
+{
+  CHAR_WHITE                       = 1 << 0,
+  CHAR_EXTENDED_PICTOGRAPHIC       = 1 << 1,
+  CHAR_HANGUL_SYLLABLE_CANDIDATE   = 1 << 2, /* GB_InHangulSyllable if it makes a syllable */
+  CHAR_BACKSPACE_DELETES_CHARACTER = 1 << 3, /* when it is the base character */
+  CHAR_VIRAMA_OR_VOWEL_DEPENDENT   = 1 << 4,
+};
+
+#define CHAR_PROPS_BLOCK_BITS 7
+#define CHAR_PROPS_BLOCK_SIZE (1 << CHAR_PROPS_BLOCK_BITS)
+
+/* Blocks are kept for planes 0 to 2, which is where nearly all
+ * text is; properties of other characters are computed each time.
+ */
+#define CHAR_PROPS_CACHE_END 0x30000
+
+static CharProps *char_props_blocks[CHAR_PROPS_CACHE_END >> CHAR_PROPS_BLOCK_BITS];
+
+static GraphemeBreakType
+compute_grapheme_break_type (gunichar     wc,
+			     GUnicodeType type)
+{
+  GraphemeBreakType GB_type;
+
+  GB_type = GB_Other;
+  switch ((int) type)
+    {
+    case G_UNICODE_FORMAT:
+      if (G_UNLIKELY (wc == 0x200C))
+	{
+	  GB_type = GB_Extend;
+	  break;
+	}
+      if (G_UNLIKELY (wc == 0x200D))
+	{
+	  GB_type = GB_ZWJ;
+	  break;
+	}
+      if (G_UNLIKELY((wc >= 0x600 && wc <= 0x605) ||
+		      wc == 0x6DD ||
+		      wc == 0x70F ||
+		      wc == 0x8E2 ||
+		      wc == 0xD4E ||
+		      wc == 0x110BD ||
+		      (wc >= 0x111C2 && wc <= 0x111C3)))
+	{
+	  GB_type = GB_Prepend;
+	  break;
+	}
+      /* fall through */
+    case G_UNICODE_CONTROL:
+    case G_UNICODE_LINE_SEPARATOR:
+    case G_UNICODE_PARAGRAPH_SEPARATOR:
+    case G_UNICODE_SURROGATE:
+      GB_type = GB_ControlCRLF;
+      break;
+
+    case G_UNICODE_UNASSIGNED:
+      /* Unassigned default ignorables */
+      if ((wc >= 0xFFF0 && wc <= 0xFFF8) ||
+	  (wc >= 0xE0000 && wc <= 0xE0FFF))
+	{
+	  GB_type = GB_ControlCRLF;
+	  break;
+	}
+      /* fall through */
+
+    case G_UNICODE_OTHER_LETTER:
+      /* GB_InHangulSyllable depends on the previous character,
+       * see CHAR_HANGUL_SYLLABLE_CANDIDATE
+       */
+      break;
+
+    case G_UNICODE_MODIFIER_LETTER:
+      if (wc >= 0xFF9E && wc <= 0xFF9F)
+	GB_type = GB_Extend; /* Other_Grapheme_Extend */
+      break;
+
+    case G_UNICODE_SPACING_MARK:
+      GB_type = GB_SpacingMark; /* SpacingMark */
+      if (wc >= 0x0900)
+	{
+	  if (wc == 0x09BE || wc == 0x09D7 ||
+	      wc == 0x0B3E || wc == 0x0B57 || wc == 0x0BBE || wc == 0x0BD7 ||
+	      wc == 0x0CC2 || wc == 0x0CD5 || wc == 0x0CD6 ||
+	      wc == 0x0D3E || wc == 0x0D57 || wc == 0x0DCF || wc == 0x0DDF ||
+	      wc == 0x1D165 || (wc >= 0x1D16E && wc <= 0x1D172))
+	    GB_type = GB_Extend; /* Other_Grapheme_Extend */
+	}
+      break;
+
+    case G_UNICODE_ENCLOSING_MARK:
+    case G_UNICODE_NON_SPACING_MARK:
+      GB_type = GB_Extend; /* Grapheme_Extend */
+      break;
+
+    case G_UNICODE_OTHER_SYMBOL:
+      /* Odd or even depends on the previous character */
+      if (G_UNLIKELY(wc >=0x1F1E6 && wc <=0x1F1FF))
+	GB_type = GB_RI_Odd;
+      break;
+
+    case G_UNICODE_MODIFIER_SYMBOL:
+      if (wc >= 0x1F3FB && wc <= 0x1F3FF)
+	GB_type = GB_Extend;
+      break;
+    }
+
+  return GB_type;
+}
+
+static WordBreakType
+compute_word_break_type (gunichar          wc,
+			 GUnicodeType      type,
+			 GUnicodeBreakType break_type)
+{
+  VogueScript script;
+  WordBreakType WB_type;
+
+  script = (VogueScript)g_unichar_get_script (wc);
+
+  WB_type = WB_Other;
+
+  if (script == PANGO_SCRIPT_KATAKANA)
+    WB_type = WB_Katakana;
+
+  if (script == PANGO_SCRIPT_HEBREW && type == G_UNICODE_OTHER_LETTER)
+    WB_type = WB_Hebrew_Letter;
+
+  if (WB_type == WB_Other)
+    switch (wc >> 8)
+      {
+      case 0x30:
+	if (wc == 0x3031 || wc == 0x3032 || wc == 0x3033 || wc == 0x3034 || wc == 0x3035 ||
+	    wc == 0x309b || wc == 0x309c || wc == 0x30a0 || wc == 0x30fc)
+	  WB_type = WB_Katakana; /* Katakana exceptions */
+	break;
+      case 0xFF:
+	if (wc == 0xFF70)
+	  WB_type = WB_Katakana; /* Katakana exceptions */
+	else if (wc >= 0xFF9E && wc <= 0xFF9F)
+	  WB_type = WB_ExtendFormat; /* Other_Grapheme_Extend */
+	break;
+      case 0x05:
+	if (wc == 0x05F3)
+	  WB_type = WB_ALetter; /* ALetter exceptions */
+	break;
+      }
+
+  if (WB_type == WB_Other)
+    switch ((int) break_type)
+      {
+      case G_UNICODE_BREAK_NUMERIC:
+	if (wc != 0x066C)
+	  WB_type = WB_Numeric; /* Numeric */
+	break;
+      case G_UNICODE_BREAK_INFIX_SEPARATOR:
+	if (wc != 0x003A && wc != 0xFE13 && wc != 0x002E)
+	  WB_type = WB_MidNum; /* MidNum */
+	break;
+      }
+
+  if (WB_type == WB_Other)
+    switch ((int) type)
+      {
+      case G_UNICODE_CONTROL:
+	if (wc != 0x000D && wc != 0x000A && wc != 0x000B && wc != 0x000C && wc != 0x0085)
+	  break;
+	/* fall through */
+      case G_UNICODE_LINE_SEPARATOR:
+      case G_UNICODE_PARAGRAPH_SEPARATOR:
+	WB_type = WB_NewlineCRLF; /* CR, LF, Newline */
+	break;
+
+      case G_UNICODE_FORMAT:
+      case G_UNICODE_SPACING_MARK:
+      case G_UNICODE_ENCLOSING_MARK:
+      case G_UNICODE_NON_SPACING_MARK:
+	WB_type = WB_ExtendFormat; /* Extend, Format */
+	break;
+
+      case G_UNICODE_CONNECT_PUNCTUATION:
+	WB_type = WB_ExtendNumLet; /* ExtendNumLet */
+	break;
+
+      case G_UNICODE_INITIAL_PUNCTUATION:
+      case G_UNICODE_FINAL_PUNCTUATION:
+	if (wc == 0x2018 || wc == 0x2019)
+	  WB_type = WB_MidNumLet; /* MidNumLet */
+	break;
+      case G_UNICODE_OTHER_PUNCTUATION:
+	if (wc == 0x0027 || wc == 0x002e || wc == 0x2024 ||
+	    wc == 0xfe52 || wc == 0xff07 || wc == 0xff0e)
+	  WB_type = WB_MidNumLet; /* MidNumLet */
+	else if (wc == 0x00b7 || wc == 0x05f4 || wc == 0x2027 || wc == 0x003a || wc == 0x0387 ||
+		 wc == 0xfe13 || wc == 0xfe55 || wc == 0xff1a)
+	  WB_type = WB_MidLetter; /* WB_MidLetter */
+	else if (wc == 0x066c ||
+		 wc == 0xfe50 || wc == 0xfe54 || wc == 0xff0c || wc == 0xff1b)
+	  WB_type = WB_MidNum; /* MidNum */
+	break;
+
+      case G_UNICODE_OTHER_SYMBOL:
+	if (wc >= 0x24B6 && wc <= 0x24E9) /* Other_Alphabetic */
+	  goto Alphabetic;
+
+	/* Odd or even depends on the previous character */
+	if (G_UNLIKELY(wc >=0x1F1E6 && wc <=0x1F1FF))
+	  WB_type = WB_RI_Odd;
+
+	break;
+
+      case G_UNICODE_OTHER_LETTER:
+      case G_UNICODE_LETTER_NUMBER:
+	if (wc == 0x3006 || wc == 0x3007 ||
+	    (wc >= 0x3021 && wc <= 0x3029) ||
+	    (wc >= 0x3038 && wc <= 0x303A) ||
+	    (wc >= 0x3400 && wc <= 0x4DB5) ||
+	    (wc >= 0x4E00 && wc <= 0x9FC3) ||
+	    (wc >= 0xF900 && wc <= 0xFA2D) ||
+	    (wc >= 0xFA30 && wc <= 0xFA6A) ||
+	    (wc >= 0xFA70 && wc <= 0xFAD9) ||
+	    (wc >= 0x20000 && wc <= 0x2A6D6) ||
+	    (wc >= 0x2F800 && wc <= 0x2FA1D))
+	  break; /* ALetter exceptions: Ideographic */
+	goto Alphabetic;
+
+      case G_UNICODE_LOWERCASE_LETTER:
+      case G_UNICODE_MODIFIER_LETTER:
+      case G_UNICODE_TITLECASE_LETTER:
+      case G_UNICODE_UPPERCASE_LETTER:
+      Alphabetic:
+	if (break_type != G_UNICODE_BREAK_COMPLEX_CONTEXT && script != PANGO_SCRIPT_HIRAGANA)
+	  WB_type = WB_ALetter; /* ALetter */
+	break;
+      }
+
+  if (WB_type == WB_Other)
+    {
+      if (type == G_UNICODE_SPACE_SEPARATOR &&
+	  break_type != G_UNICODE_BREAK_NON_BREAKING_GLUE)
+	WB_type = WB_WSegSpace;
+    }
+
+  return WB_type;
+}
+
+static SentenceBreakType
+compute_sentence_break_type (gunichar          wc,
+			     GUnicodeType      type,
+			     GUnicodeBreakType break_type)
+{
+  SentenceBreakType SB_type;
+
+  SB_type = SB_Other;
+
+  if (break_type == G_UNICODE_BREAK_NUMERIC)
+    SB_type = SB_Numeric; /* Numeric */
+
+  if (SB_type == SB_Other)
+    switch ((int) type)
+      {
+      case G_UNICODE_CONTROL:
+	if (wc == '\r' || wc == '\n')
+	  SB_type = SB_ParaSep;
+	else if (wc == 0x0009 || wc == 0x000B || wc == 0x000C)
+	  SB_type = SB_Sp;
+	else if (wc == 0x0085)
+	  SB_type = SB_ParaSep;
+	break;
+
+      case G_UNICODE_SPACE_SEPARATOR:
+	if (wc == 0x0020 || wc == 0x00A0 || wc == 0x1680 ||
+	    (wc >= 0x2000 && wc <= 0x200A) ||
+	    wc == 0x202F || wc == 0x205F || wc == 0x3000)
+	  SB_type = SB_Sp;
+	break;
+
+      case G_UNICODE_LINE_SEPARATOR:
+      case G_UNICODE_PARAGRAPH_SEPARATOR:
+	SB_type = SB_ParaSep;
+	break;
+
+      case G_UNICODE_FORMAT:
+      case G_UNICODE_SPACING_MARK:
+      case G_UNICODE_ENCLOSING_MARK:
+      case G_UNICODE_NON_SPACING_MARK:
+	SB_type = SB_ExtendFormat; /* Extend, Format */
+	break;
+
+      case G_UNICODE_MODIFIER_LETTER:
+	if (wc >= 0xFF9E && wc <= 0xFF9F)
+	  SB_type = SB_ExtendFormat; /* Other_Grapheme_Extend */
+	break;
+
+      case G_UNICODE_TITLECASE_LETTER:
+	SB_type = SB_Upper;
+	break;
+
+      case G_UNICODE_DASH_PUNCTUATION:
+	if (wc == 0x002D ||
+	    (wc >= 0x2013 && wc <= 0x2014) ||
+	    (wc >= 0xFE31 && wc <= 0xFE32) ||
+	    wc == 0xFE58 ||
+	    wc == 0xFE63 ||
+	    wc == 0xFF0D)
+	  SB_type = SB_SContinue;
+	break;
+
+      case G_UNICODE_OTHER_PUNCTUATION:
+	if (wc == 0x05F3)
+	  SB_type = SB_OLetter;
+	else if (wc == 0x002E || wc == 0x2024 ||
+	    wc == 0xFE52 || wc == 0xFF0E)
+	  SB_type = SB_ATerm;
+
+	if (wc == 0x002C ||
+	    wc == 0x003A ||
+	    wc == 0x055D ||
+	    (wc >= 0x060C && wc <= 0x060D) ||
+	    wc == 0x07F8 ||
+	    wc == 0x1802 ||
+	    wc == 0x1808 ||
+	    wc == 0x3001 ||
+	    (wc >= 0xFE10 && wc <= 0xFE11) ||
+	    wc == 0xFE13 ||
+	    (wc >= 0xFE50 && wc <= 0xFE51) ||
+	    wc == 0xFE55 ||
+	    wc == 0xFF0C ||
+	    wc == 0xFF1A ||
+	    wc == 0xFF64)
+	  SB_type = SB_SContinue;
+
+	if (_vogue_is_STerm(wc))
+	  SB_type = SB_STerm;
+
+	break;
+      }
+
+  if (SB_type == SB_Other)
+    {
+      if (g_unichar_islower(wc))
+	SB_type = SB_Lower;
+      else if (g_unichar_isupper(wc))
+	SB_type = SB_Upper;
+      else if (g_unichar_isalpha(wc))
+	SB_type = SB_OLetter;
+
+      if (type == G_UNICODE_OPEN_PUNCTUATION ||
+	  type == G_UNICODE_CLOSE_PUNCTUATION ||
+	  break_type == G_UNICODE_BREAK_QUOTATION)
+	SB_type = SB_Close;
+    }
+
+  return SB_type;
+}
+
+static void
+compute_char_props (gunichar   wc,
+		    CharProps *props)
+{
+  GUnicodeType type;
+  GUnicodeBreakType break_type;
+  gboolean is_Extended_Pictographic;
+  guint flags = 0;
+
+  type = g_unichar_type (wc);
+  break_type = BREAK_TYPE_SAFE (g_unichar_break_type (wc));
+  is_Extended_Pictographic = _vogue_Is_Emoji_Extended_Pictographic (wc);
+
+  switch (type)
+    {
+    case G_UNICODE_SPACE_SEPARATOR:
+    case G_UNICODE_LINE_SEPARATOR:
+    case G_UNICODE_PARAGRAPH_SEPARATOR:
+      flags |= CHAR_WHITE;
+      break;
+    default:
+      if (wc == '\t' || wc == '\n' || wc == '\r' || wc == '\f')
+	flags |= CHAR_WHITE;
+      break;
+    }
+
+  if (is_Extended_Pictographic)
+    flags |= CHAR_EXTENDED_PICTOGRAPHIC;
+
+  /* See the G_UNICODE_OTHER_LETTER case of compute_grapheme_break_type() */
+  if (IS_JAMO (break_type) &&
+      (type == G_UNICODE_OTHER_LETTER ||
+       (type == G_UNICODE_UNASSIGNED &&
+	!(wc >= 0xFFF0 && wc <= 0xFFF8) &&
+	!(wc >= 0xE0000 && wc <= 0xE0FFF))))
+    flags |= CHAR_HANGUL_SYLLABLE_CANDIDATE;
+
+  if (BACKSPACE_DELETES_CHARACTER (wc))
+    flags |= CHAR_BACKSPACE_DELETES_CHARACTER;
+
+  /* Dependent Vowels for Indic language */
+  if (_vogue_is_Virama (wc) || _vogue_is_Vowel_Dependent (wc))
+    flags |= CHAR_VIRAMA_OR_VOWEL_DEPENDENT;
+
+  props->break_type = break_type;
+  props->type = type;
+  props->flags = flags;
+  props->GB_type = compute_grapheme_break_type (wc, type);
+  props->WB_type = compute_word_break_type (wc, type, break_type);
+  props->SB_type = compute_sentence_break_type (wc, type, break_type);
+}
+
+static G_GNUC_NOINLINE const CharProps *
+fill_char_props_block (guint block_index)
+{
+  CharProps *block;
+  gunichar start;
+  guint i;
+
+  block = g_new (CharProps, CHAR_PROPS_BLOCK_SIZE);
+  start = block_index << CHAR_PROPS_BLOCK_BITS;
+  for (i = 0; i < CHAR_PROPS_BLOCK_SIZE; i++)
+    compute_char_props (start + i, &block[i]);
+
+  /* Another thread may have filled it in the meantime */
+  if (!g_atomic_pointer_compare_and_exchange (&char_props_blocks[block_index], NULL, block))
+    {
+      g_free (block);
+      block = g_atomic_pointer_get (&char_props_blocks[block_index]);
+    }
+
+  return block;
+}
+
+static inline CharProps
+get_char_props (gunichar wc)
+{
+  const CharProps *block;
+  CharProps props;
+
+  if (G_UNLIKELY (wc >= CHAR_PROPS_CACHE_END))
+    {
+      compute_char_props (wc, &props);
+      return props;
+    }
+
+  block = g_atomic_pointer_get (&char_props_blocks[wc >> CHAR_PROPS_BLOCK_BITS]);
+  if (G_UNLIKELY (block == NULL))
+    block = fill_char_props_block (wc >> CHAR_PROPS_BLOCK_BITS);
+
+  return block[wc & (CHAR_PROPS_BLOCK_SIZE - 1)];
+}
+
+static inline gunichar
+utf8_get_char (const char *p)
+{
+  if ((guchar) *p < 0x80)
+    return (guchar) *p;
+
+  return g_utf8_get_char (p);
+}
+
+/* Computes the attributes selected by @flags; line breaks,
+ * whitespace, cursor positions and expandable spaces are always
+ * computed, since line breaking depends on them. The fields of
+ * the other groups are set to %FALSE. Sentence boundaries are
+ * found at word boundaries, so asking for sentences fills in
+ * is_word_boundary too.
+ */
+static void
+default_break (const gchar       *text,
+	       gint               length,
+	       VogueLogAttr      *attrs,
+	       VogueLogAttrFlags  flags)
 {
   /* The rationale for all this is in section 5.15 of the Unicode 3.0 book,
    * the line breaking stuff is also in TR14 on unicode.org
@@ -176,6 +704,8 @@ vogue_default_break (const gchar   *text,
 
   gunichar prev_wc;
   gunichar next_wc;
+  CharProps next_props;
+  guint prev_flags;
 
   JamoType prev_jamo;
 
@@ -183,64 +713,12 @@ vogue_default_break (const gchar   *text,
   GUnicodeBreakType prev_break_type;
   GUnicodeBreakType prev_prev_break_type;
 
-  /* See Grapheme_Cluster_Break Property Values table of UAX#29 */
-  typedef enum
-  {
-    GB_Other,
-    GB_ControlCRLF,
-    GB_Extend,
-    GB_ZWJ,
-    GB_Prepend,
-    GB_SpacingMark,
-    GB_InHangulSyllable, /* Handles all of L, V, T, LV, LVT rules */
-    /* Use state machine to handle emoji sequence */
-    /* Rule GB12 and GB13 */
-    GB_RI_Odd, /* Meets odd number of RI */
-    GB_RI_Even, /* Meets even number of RI */
-  } GraphemeBreakType;
   GraphemeBreakType prev_GB_type = GB_Other;
   gboolean met_Extended_Pictographic = FALSE;
 
-  /* See Word_Break Property Values table of UAX#29 */
-  typedef enum
-  {
-    WB_Other,
-    WB_NewlineCRLF,
-    WB_ExtendFormat,
-    WB_Katakana,
-    WB_Hebrew_Letter,
-    WB_ALetter,
-    WB_MidNumLet,
-    WB_MidLetter,
-    WB_MidNum,
-    WB_Numeric,
-    WB_ExtendNumLet,
-    WB_RI_Odd,
-    WB_RI_Even,
-    WB_WSegSpace,
-  } WordBreakType;
   WordBreakType prev_prev_WB_type = WB_Other, prev_WB_type = WB_Other;
   gint prev_WB_i = -1;
 
-  /* See Sentence_Break Property Values table of UAX#29 */
-  typedef enum
-  {
-    SB_Other,
-    SB_ExtendFormat,
-    SB_ParaSep,
-    SB_Sp,
-    SB_Lower,
-    SB_Upper,
-    SB_OLetter,
-    SB_Numeric,
-    SB_ATerm,
-    SB_SContinue,
-    SB_STerm,
-    SB_Close,
-    /* Rules SB8 and SB8a */
-    SB_ATerm_Close_Sp,
-    SB_STerm_Close_Sp,
-  } SentenceBreakType;
   SentenceBreakType prev_prev_SB_type = SB_Other, prev_SB_type = SB_Other;
   gint prev_SB_i = -1;
 
@@ -257,7 +735,7 @@ vogue_default_break (const gchar   *text,
 
   WordType current_word_type = WordNone;
   gunichar last_word_letter = 0;
-  gunichar base_character = 0;
+  guint base_flags;
 
   gint last_sentence_start = -1;
   gint last_non_space = -1;
@@ -265,8 +743,10 @@ vogue_default_break (const gchar   *text,
   gboolean almost_done = FALSE;
   gboolean done = FALSE;
 
-  g_return_if_fail (length == 0 || text != NULL);
-  g_return_if_fail (attrs != NULL);
+  gboolean want_backspace = (flags & PANGO_LOG_ATTR_BACKSPACE) != 0;
+  gboolean want_words = (flags & PANGO_LOG_ATTR_WORDS) != 0;
+  gboolean want_sentences = (flags & PANGO_LOG_ATTR_SENTENCES) != 0;
+  gboolean want_word_boundaries = want_words || want_sentences;
 
   next = text;
 
@@ -281,18 +761,22 @@ vogue_default_break (const gchar   *text,
       almost_done = TRUE;
     }
   else
-    next_wc = g_utf8_get_char (next);
+    next_wc = utf8_get_char (next);
 
-  next_break_type = g_unichar_break_type (next_wc);
-  next_break_type = BREAK_TYPE_SAFE (next_break_type);
+  next_props = get_char_props (next_wc);
+  prev_flags = base_flags = get_char_props (0).flags;
 
   for (i = 0; !done ; i++)
     {
+      VogueLogAttr attr = { 0, };
+      CharProps props;
       GUnicodeType type;
       gunichar wc;
       GUnicodeBreakType break_type;
       GUnicodeBreakType row_break_type;
       BreakOpportunity break_op;
+      guint8 break_entry;
+      guint break_rank;
       JamoType jamo;
       gboolean makes_hangul_syllable;
 
@@ -306,7 +790,8 @@ vogue_default_break (const gchar   *text,
 
 
       wc = next_wc;
-      break_type = next_break_type;
+      props = next_props;
+      break_type = props.break_type;
 
       if (almost_done)
 	{
@@ -315,7 +800,7 @@ vogue_default_break (const gchar   *text,
 	   * may not increment next
 	   */
 	  next_wc = 0;
-	  next_break_type = G_UNICODE_BREAK_UNKNOWN;
+	  next_props.break_type = G_UNICODE_BREAK_UNKNOWN;
 	  done = TRUE;
 	}
       else
@@ -332,13 +817,13 @@ vogue_default_break (const gchar   *text,
 	      almost_done = TRUE;
 	    }
 	  else
-	    next_wc = g_utf8_get_char (next);
+	    next_wc = utf8_get_char (next);
 
-	  next_break_type = g_unichar_break_type (next_wc);
-	  next_break_type = BREAK_TYPE_SAFE (next_break_type);
+	  next_props = get_char_props (next_wc);
 	}
+      next_break_type = next_props.break_type;
 
-      type = g_unichar_type (wc);
+      type = props.type;
       jamo = JAMO_TYPE (break_type);
 
       /* Determine wheter this forms a Hangul syllable with prev. */
@@ -353,26 +838,13 @@ vogue_default_break (const gchar   *text,
 	  makes_hangul_syllable = (prev_end == this_start) || (prev_end + 1 == this_start);
 	}
 
-      switch (type)
-        {
-        case G_UNICODE_SPACE_SEPARATOR:
-        case G_UNICODE_LINE_SEPARATOR:
-        case G_UNICODE_PARAGRAPH_SEPARATOR:
-          attrs[i].is_white = TRUE;
-          break;
-        default:
-          if (wc == '\t' || wc == '\n' || wc == '\r' || wc == '\f')
-            attrs[i].is_white = TRUE;
-          else
-            attrs[i].is_white = FALSE;
-          break;
-        }
+      attr.is_white = (props.flags & CHAR_WHITE) != 0;
 
       /* Just few spaces have variable width. So explicitly mark them.
        */
-      attrs[i].is_expandable_space = (0x0020 == wc || 0x00A0 == wc);
+      attr.is_expandable_space = (0x0020 == wc || 0x00A0 == wc);
       is_Extended_Pictographic =
-	_vogue_Is_Emoji_Extended_Pictographic (wc);
+	(props.flags & CHAR_EXTENDED_PICTOGRAPHIC) != 0;
 
 
       /* ---- UAX#29 Grapheme Boundaries ---- */
@@ -380,102 +852,19 @@ vogue_default_break (const gchar   *text,
 	GraphemeBreakType GB_type;
 
         /* Find the GraphemeBreakType of wc */
-	GB_type = GB_Other;
-	switch ((int) type)
-	  {
-	  case G_UNICODE_FORMAT:
-	    if (G_UNLIKELY (wc == 0x200C))
-	      {
-		GB_type = GB_Extend;
-		break;
-	      }
-	    if (G_UNLIKELY (wc == 0x200D))
-	      {
-		GB_type = GB_ZWJ;
-		break;
-	      }
-            if (G_UNLIKELY((wc >= 0x600 && wc <= 0x605) ||
-                            wc == 0x6DD ||
-                            wc == 0x70F ||
-                            wc == 0x8E2 ||
-                            wc == 0xD4E ||
-                            wc == 0x110BD ||
-                            (wc >= 0x111C2 && wc <= 0x111C3)))
-              {
-                GB_type = GB_Prepend;
-                break;
-              }
-	    /* fall through */
-	  case G_UNICODE_CONTROL:
-	  case G_UNICODE_LINE_SEPARATOR:
-	  case G_UNICODE_PARAGRAPH_SEPARATOR:
-	  case G_UNICODE_SURROGATE:
-	    GB_type = GB_ControlCRLF;
-	    break;
-
-	  case G_UNICODE_UNASSIGNED:
-	    /* Unassigned default ignorables */
-	    if ((wc >= 0xFFF0 && wc <= 0xFFF8) ||
-		(wc >= 0xE0000 && wc <= 0xE0FFF))
-	      {
-		GB_type = GB_ControlCRLF;
-		break;
-	      }
-	    /* fall through */
-
-	  case G_UNICODE_OTHER_LETTER:
-	    if (makes_hangul_syllable)
-	      GB_type = GB_InHangulSyllable;
-	    break;
-
-	  case G_UNICODE_MODIFIER_LETTER:
-	    if (wc >= 0xFF9E && wc <= 0xFF9F)
-	      GB_type = GB_Extend; /* Other_Grapheme_Extend */
-	    break;
-
-	  case G_UNICODE_SPACING_MARK:
-	    GB_type = GB_SpacingMark; /* SpacingMark */
-	    if (wc >= 0x0900)
-	      {
-		if (wc == 0x09BE || wc == 0x09D7 ||
-		    wc == 0x0B3E || wc == 0x0B57 || wc == 0x0BBE || wc == 0x0BD7 ||
-		    wc == 0x0CC2 || wc == 0x0CD5 || wc == 0x0CD6 ||
-		    wc == 0x0D3E || wc == 0x0D57 || wc == 0x0DCF || wc == 0x0DDF ||
-		    wc == 0x1D165 || (wc >= 0x1D16E && wc <= 0x1D172))
-		  GB_type = GB_Extend; /* Other_Grapheme_Extend */
-	      }
-	    break;
-
-	  case G_UNICODE_ENCLOSING_MARK:
-	  case G_UNICODE_NON_SPACING_MARK:
-	    GB_type = GB_Extend; /* Grapheme_Extend */
-	    break;
-
-          case G_UNICODE_OTHER_SYMBOL:
-            if (G_UNLIKELY(wc >=0x1F1E6 && wc <=0x1F1FF))
-              {
-                if (prev_GB_type == GB_RI_Odd)
-                  GB_type = GB_RI_Even;
-                else if (prev_GB_type == GB_RI_Even)
-                  GB_type = GB_RI_Odd;
-                else
-                  GB_type = GB_RI_Odd;
-                break;
-              }
-            break;
-
-          case G_UNICODE_MODIFIER_SYMBOL:
-            if (wc >= 0x1F3FB && wc <= 0x1F3FF)
-              GB_type = GB_Extend;
-            break;
-	  }
+	GB_type = props.GB_type;
+	if (G_UNLIKELY (props.flags & CHAR_HANGUL_SYLLABLE_CANDIDATE) &&
+	    makes_hangul_syllable)
+	  GB_type = GB_InHangulSyllable;
+	else if (G_UNLIKELY (GB_type == GB_RI_Odd) && prev_GB_type == GB_RI_Odd)
+	  GB_type = GB_RI_Even;
 
 	/* Rule GB11 */
 	if (met_Extended_Pictographic)
 	  {
 	    if (GB_type == GB_Extend)
 	      met_Extended_Pictographic = TRUE;
-	    else if (_vogue_Is_Emoji_Extended_Pictographic (prev_wc) &&
+	    else if ((prev_flags & CHAR_EXTENDED_PICTOGRAPHIC) &&
 		     GB_type == GB_ZWJ)
 	      met_Extended_Pictographic = TRUE;
 	    else if (prev_GB_type == GB_Extend && GB_type == GB_ZWJ)
@@ -517,20 +906,19 @@ vogue_default_break (const gchar   *text,
 	if (is_Extended_Pictographic)
 	  met_Extended_Pictographic = TRUE;
 
-	attrs[i].is_cursor_position = is_grapheme_boundary;
+	attr.is_cursor_position = is_grapheme_boundary;
 	/* If this is a grapheme boundary, we have to decide if backspace
 	 * deletes a character or the whole grapheme cluster */
-	if (is_grapheme_boundary)
+	if (is_grapheme_boundary && want_backspace)
           {
-	    attrs[i].backspace_deletes_character = BACKSPACE_DELETES_CHARACTER (base_character);
+	    attr.backspace_deletes_character = (base_flags & CHAR_BACKSPACE_DELETES_CHARACTER) != 0;
 
 	    /* Dependent Vowels for Indic language */
-	    if (_vogue_is_Virama (prev_wc) ||
-		_vogue_is_Vowel_Dependent (prev_wc))
-	      attrs[i].backspace_deletes_character = TRUE;
+	    if (prev_flags & CHAR_VIRAMA_OR_VOWEL_DEPENDENT)
+	      attr.backspace_deletes_character = TRUE;
           }
 	else
-	  attrs[i].backspace_deletes_character = FALSE;
+	  attr.backspace_deletes_character = FALSE;
 
 	prev_GB_type = GB_type;
       }
@@ -538,150 +926,21 @@ vogue_default_break (const gchar   *text,
       /* ---- UAX#29 Word Boundaries ---- */
       {
 	is_word_boundary = FALSE;
-	if (is_grapheme_boundary ||
-	    G_UNLIKELY(wc >=0x1F1E6 && wc <=0x1F1FF)) /* Rules WB3 and WB4 */
+	if (want_word_boundaries &&
+	    (is_grapheme_boundary ||
+	     G_UNLIKELY(wc >=0x1F1E6 && wc <=0x1F1FF))) /* Rules WB3 and WB4 */
 	  {
-	    VogueScript script;
 	    WordBreakType WB_type;
 
-	    script = (VogueScript)g_unichar_get_script (wc);
-
 	    /* Find the WordBreakType of wc */
-	    WB_type = WB_Other;
-
-	    if (script == PANGO_SCRIPT_KATAKANA)
-	      WB_type = WB_Katakana;
-
-	    if (script == PANGO_SCRIPT_HEBREW && type == G_UNICODE_OTHER_LETTER)
-	      WB_type = WB_Hebrew_Letter;
-
-	    if (WB_type == WB_Other)
-	      switch (wc >> 8)
-	        {
-		case 0x30:
-		  if (wc == 0x3031 || wc == 0x3032 || wc == 0x3033 || wc == 0x3034 || wc == 0x3035 ||
-		      wc == 0x309b || wc == 0x309c || wc == 0x30a0 || wc == 0x30fc)
-		    WB_type = WB_Katakana; /* Katakana exceptions */
-		  break;
-		case 0xFF:
-		  if (wc == 0xFF70)
-		    WB_type = WB_Katakana; /* Katakana exceptions */
-		  else if (wc >= 0xFF9E && wc <= 0xFF9F)
-		    WB_type = WB_ExtendFormat; /* Other_Grapheme_Extend */
-		  break;
-		case 0x05:
-		  if (wc == 0x05F3)
-		    WB_type = WB_ALetter; /* ALetter exceptions */
-		  break;
-		}
-
-	    if (WB_type == WB_Other)
-	      switch ((int) break_type)
-	        {
-		case G_UNICODE_BREAK_NUMERIC:
-		  if (wc != 0x066C)
-		    WB_type = WB_Numeric; /* Numeric */
-		  break;
-		case G_UNICODE_BREAK_INFIX_SEPARATOR:
-		  if (wc != 0x003A && wc != 0xFE13 && wc != 0x002E)
-		    WB_type = WB_MidNum; /* MidNum */
-		  break;
-		}
-
-	    if (WB_type == WB_Other)
-	      switch ((int) type)
-		{
-		case G_UNICODE_CONTROL:
-		  if (wc != 0x000D && wc != 0x000A && wc != 0x000B && wc != 0x000C && wc != 0x0085)
-		    break;
-		  /* fall through */
-		case G_UNICODE_LINE_SEPARATOR:
-		case G_UNICODE_PARAGRAPH_SEPARATOR:
-		  WB_type = WB_NewlineCRLF; /* CR, LF, Newline */
-		  break;
-
-		case G_UNICODE_FORMAT:
-		case G_UNICODE_SPACING_MARK:
-		case G_UNICODE_ENCLOSING_MARK:
-		case G_UNICODE_NON_SPACING_MARK:
-		  WB_type = WB_ExtendFormat; /* Extend, Format */
-		  break;
-
-		case G_UNICODE_CONNECT_PUNCTUATION:
-		  WB_type = WB_ExtendNumLet; /* ExtendNumLet */
-		  break;
-
-		case G_UNICODE_INITIAL_PUNCTUATION:
-		case G_UNICODE_FINAL_PUNCTUATION:
-		  if (wc == 0x2018 || wc == 0x2019)
-		    WB_type = WB_MidNumLet; /* MidNumLet */
-		  break;
-		case G_UNICODE_OTHER_PUNCTUATION:
-		  if (wc == 0x0027 || wc == 0x002e || wc == 0x2024 ||
-		      wc == 0xfe52 || wc == 0xff07 || wc == 0xff0e)
-		    WB_type = WB_MidNumLet; /* MidNumLet */
-		  else if (wc == 0x00b7 || wc == 0x05f4 || wc == 0x2027 || wc == 0x003a || wc == 0x0387 ||
-			   wc == 0xfe13 || wc == 0xfe55 || wc == 0xff1a)
-		    WB_type = WB_MidLetter; /* WB_MidLetter */
-		  else if (wc == 0x066c ||
-			   wc == 0xfe50 || wc == 0xfe54 || wc == 0xff0c || wc == 0xff1b)
-		    WB_type = WB_MidNum; /* MidNum */
-		  break;
-
-		case G_UNICODE_OTHER_SYMBOL:
-		  if (wc >= 0x24B6 && wc <= 0x24E9) /* Other_Alphabetic */
-		    goto Alphabetic;
-
-		  if (G_UNLIKELY(wc >=0x1F1E6 && wc <=0x1F1FF))
-		    {
-			  if (prev_WB_type == WB_RI_Odd)
-			   WB_type = WB_RI_Even;
-			  else if (prev_WB_type == WB_RI_Even)
-			   WB_type = WB_RI_Odd;
-			  else
-			   WB_type = WB_RI_Odd;
-		    }
-
-		  break;
-
-		case G_UNICODE_OTHER_LETTER:
-		case G_UNICODE_LETTER_NUMBER:
-		  if (wc == 0x3006 || wc == 0x3007 ||
-		      (wc >= 0x3021 && wc <= 0x3029) ||
-		      (wc >= 0x3038 && wc <= 0x303A) ||
-		      (wc >= 0x3400 && wc <= 0x4DB5) ||
-		      (wc >= 0x4E00 && wc <= 0x9FC3) ||
-		      (wc >= 0xF900 && wc <= 0xFA2D) ||
-		      (wc >= 0xFA30 && wc <= 0xFA6A) ||
-		      (wc >= 0xFA70 && wc <= 0xFAD9) ||
-		      (wc >= 0x20000 && wc <= 0x2A6D6) ||
-		      (wc >= 0x2F800 && wc <= 0x2FA1D))
-		    break; /* ALetter exceptions: Ideographic */
-		  goto Alphabetic;
-
-		case G_UNICODE_LOWERCASE_LETTER:
-		case G_UNICODE_MODIFIER_LETTER:
-		case G_UNICODE_TITLECASE_LETTER:
-		case G_UNICODE_UPPERCASE_LETTER:
-		Alphabetic:
-		  if (break_type != G_UNICODE_BREAK_COMPLEX_CONTEXT && script != PANGO_SCRIPT_HIRAGANA)
-		    WB_type = WB_ALetter; /* ALetter */
-		  break;
-		}
-
-	    if (WB_type == WB_Other)
-	      {
-		if (type == G_UNICODE_SPACE_SEPARATOR &&
-		    break_type != G_UNICODE_BREAK_NON_BREAKING_GLUE)
-		  WB_type = WB_WSegSpace;
-	      }
+	    WB_type = props.WB_type;
+	    if (G_UNLIKELY (WB_type == WB_RI_Odd) && prev_WB_type == WB_RI_Odd)
+	      WB_type = WB_RI_Even;
 
 	    /* Word Cluster Boundary Rules */
 
 	    /* We apply Rules WB1 and WB2 at the end of the function */
 
-	    if (prev_wc == 0x3031 && wc == 0x41)
-	      g_debug ("Y %d %d", prev_WB_type, WB_type);
 	    if (prev_WB_type == WB_NewlineCRLF && prev_WB_i + 1 == i)
 	      {
 	        /* The extra check for prev_WB_i is to correctly handle sequences like
@@ -759,117 +1018,20 @@ vogue_default_break (const gchar   *text,
 	      }
 	  }
 
-	attrs[i].is_word_boundary = is_word_boundary;
+	attr.is_word_boundary = is_word_boundary;
       }
 
       /* ---- UAX#29 Sentence Boundaries ---- */
       {
 	is_sentence_boundary = FALSE;
-	if (is_word_boundary ||
-	    wc == '\r' || wc == '\n') /* Rules SB3 and SB5 */
+	if (want_sentences &&
+	    (is_word_boundary ||
+	     wc == '\r' || wc == '\n')) /* Rules SB3 and SB5 */
 	  {
 	    SentenceBreakType SB_type;
 
 	    /* Find the SentenceBreakType of wc */
-	    SB_type = SB_Other;
-
-	    if (break_type == G_UNICODE_BREAK_NUMERIC)
-	      SB_type = SB_Numeric; /* Numeric */
-
-	    if (SB_type == SB_Other)
-	      switch ((int) type)
-		{
-		case G_UNICODE_CONTROL:
-		  if (wc == '\r' || wc == '\n')
-		    SB_type = SB_ParaSep;
-		  else if (wc == 0x0009 || wc == 0x000B || wc == 0x000C)
-		    SB_type = SB_Sp;
-		  else if (wc == 0x0085)
-		    SB_type = SB_ParaSep;
-		  break;
-
-		case G_UNICODE_SPACE_SEPARATOR:
-		  if (wc == 0x0020 || wc == 0x00A0 || wc == 0x1680 ||
-		      (wc >= 0x2000 && wc <= 0x200A) ||
-		      wc == 0x202F || wc == 0x205F || wc == 0x3000)
-		    SB_type = SB_Sp;
-		  break;
-
-		case G_UNICODE_LINE_SEPARATOR:
-		case G_UNICODE_PARAGRAPH_SEPARATOR:
-		  SB_type = SB_ParaSep;
-		  break;
-
-		case G_UNICODE_FORMAT:
-		case G_UNICODE_SPACING_MARK:
-		case G_UNICODE_ENCLOSING_MARK:
-		case G_UNICODE_NON_SPACING_MARK:
-		  SB_type = SB_ExtendFormat; /* Extend, Format */
-		  break;
-
-		case G_UNICODE_MODIFIER_LETTER:
-		  if (wc >= 0xFF9E && wc <= 0xFF9F)
-		    SB_type = SB_ExtendFormat; /* Other_Grapheme_Extend */
-		  break;
-
-		case G_UNICODE_TITLECASE_LETTER:
-		  SB_type = SB_Upper;
-		  break;
-
-		case G_UNICODE_DASH_PUNCTUATION:
-		  if (wc == 0x002D ||
-		      (wc >= 0x2013 && wc <= 0x2014) ||
-		      (wc >= 0xFE31 && wc <= 0xFE32) ||
-		      wc == 0xFE58 ||
-		      wc == 0xFE63 ||
-		      wc == 0xFF0D)
-		    SB_type = SB_SContinue;
-		  break;
-
-		case G_UNICODE_OTHER_PUNCTUATION:
-		  if (wc == 0x05F3)
-		    SB_type = SB_OLetter;
-		  else if (wc == 0x002E || wc == 0x2024 ||
-		      wc == 0xFE52 || wc == 0xFF0E)
-		    SB_type = SB_ATerm;
-
-		  if (wc == 0x002C ||
-		      wc == 0x003A ||
-		      wc == 0x055D ||
-		      (wc >= 0x060C && wc <= 0x060D) ||
-		      wc == 0x07F8 ||
-		      wc == 0x1802 ||
-		      wc == 0x1808 ||
-		      wc == 0x3001 ||
-		      (wc >= 0xFE10 && wc <= 0xFE11) ||
-		      wc == 0xFE13 ||
-		      (wc >= 0xFE50 && wc <= 0xFE51) ||
-		      wc == 0xFE55 ||
-		      wc == 0xFF0C ||
-		      wc == 0xFF1A ||
-		      wc == 0xFF64)
-		    SB_type = SB_SContinue;
-
-		  if (_vogue_is_STerm(wc))
-		    SB_type = SB_STerm;
-
-		  break;
-		}
-
-	    if (SB_type == SB_Other)
-	      {
-		if (g_unichar_islower(wc))
-		  SB_type = SB_Lower;
-		else if (g_unichar_isupper(wc))
-		  SB_type = SB_Upper;
-		else if (g_unichar_isalpha(wc))
-		  SB_type = SB_OLetter;
-
-		if (type == G_UNICODE_OPEN_PUNCTUATION ||
-		    type == G_UNICODE_CLOSE_PUNCTUATION ||
-		    break_type == G_UNICODE_BREAK_QUOTATION)
-		  SB_type = SB_Close;
-	      }
+	    SB_type = props.SB_type;
 
 	    /* Sentence Boundary Rules */
 
@@ -965,10 +1127,10 @@ vogue_default_break (const gchar   *text,
 
 	  }
 
-	if (i == 0 || done)
+	if (want_sentences && (i == 0 || done))
 	  is_sentence_boundary = TRUE; /* Rules SB1 and SB2 */
 
-	attrs[i].is_sentence_boundary = is_sentence_boundary;
+	attr.is_sentence_boundary = is_sentence_boundary;
       }
 
       /* ---- Line breaking ---- */
@@ -979,9 +1141,9 @@ vogue_default_break (const gchar   *text,
 	prev_prev_break_type : prev_break_type;
       g_assert (row_break_type != G_UNICODE_BREAK_SPACE);
 
-      attrs[i].is_char_break = FALSE;
-      attrs[i].is_line_break = FALSE;
-      attrs[i].is_mandatory_break = FALSE;
+      attr.is_char_break = FALSE;
+      attr.is_line_break = FALSE;
+      attr.is_mandatory_break = FALSE;
 
       /* Rule LB1:
 	 assign a line breaking class to each code point of the input. */
@@ -1010,7 +1172,7 @@ vogue_default_break (const gchar   *text,
 	}
 
       /* If it's not a grapheme boundary, it's not a line break either */
-      if (attrs[i].is_cursor_position ||
+      if (attr.is_cursor_position ||
 	  break_type == G_UNICODE_BREAK_COMBINING_MARK ||
 	  break_type == G_UNICODE_BREAK_ZERO_WIDTH_JOINER ||
 	  break_type == G_UNICODE_BREAK_HANGUL_L_JAMO ||
@@ -1055,286 +1217,70 @@ vogue_default_break (const gchar   *text,
 		LB_type = LB_RI_Odd;
 	    }
 
-	  attrs[i].is_line_break = TRUE; /* Rule LB31 */
+	  attr.is_line_break = TRUE; /* Rule LB31 */
 	  /* Unicode doesn't specify char wrap;
 	     we wrap around all chars currently. */
-	  if (attrs[i].is_cursor_position)
-	    attrs[i].is_char_break = TRUE;
-
-	  /* Make any necessary replacements first */
-	  if (row_break_type == G_UNICODE_BREAK_UNKNOWN)
-	    row_break_type = G_UNICODE_BREAK_ALPHABETIC;
-
-	  /* add the line break rules in reverse order to override
-	     the lower priority rules. */
+	  if (attr.is_cursor_position)
+	    attr.is_char_break = TRUE;
+
+	  /* Rules LB6 to LB30b. The rules that only depend on the pair of
+	   * classes, or on the class before a run of spaces, are looked up in
+	   * the generated tables. The remaining rules are checked here, and
+	   * take effect if they outrank the rule that the table picked, which
+	   * matches applying all of the rules in order of precedence.
+	   */
+	  if (prev_break_type == G_UNICODE_BREAK_SPACE)
+	    break_entry = _vogue_line_break_space_table[row_break_type][break_type];
+	  else
+	    break_entry = _vogue_line_break_pair_table[prev_break_type][break_type];
 
-	  /* Rule LB30 */
-	  if ((prev_break_type == G_UNICODE_BREAK_ALPHABETIC ||
-	       prev_break_type == G_UNICODE_BREAK_HEBREW_LETTER ||
-	       prev_break_type == G_UNICODE_BREAK_NUMERIC) &&
-	      break_type == G_UNICODE_BREAK_OPEN_PUNCTUATION)
-	    break_op = BREAK_PROHIBITED;
+	  break_op = LINE_BREAK_OP (break_entry);
+	  break_rank = LINE_BREAK_RANK (break_entry);
 
-	  if (prev_break_type == G_UNICODE_BREAK_CLOSE_PARANTHESIS &&
-	      (break_type == G_UNICODE_BREAK_ALPHABETIC ||
-	       break_type == G_UNICODE_BREAK_HEBREW_LETTER ||
-	       break_type == G_UNICODE_BREAK_NUMERIC))
-	    break_op = BREAK_PROHIBITED;
+#define PROHIBIT_IF_OUTRANKS(rank, condition) \
+	  if ((rank) > break_rank && (condition)) \
+	    { \
+	      break_op = BREAK_PROHIBITED; \
+	      break_rank = (rank); \
+	    }
 
 	  /* Rule LB30a */
-	  if (prev_LB_type == LB_RI_Odd && LB_type == LB_RI_Even)
-	    break_op = BREAK_PROHIBITED;
-
-	  /* Rule LB30b */
-	  if (prev_break_type == G_UNICODE_BREAK_EMOJI_BASE &&
-	      break_type == G_UNICODE_BREAK_EMOJI_MODIFIER)
-	    break_op = BREAK_PROHIBITED;
-
-	  /* Rule LB29 */
-	  if (prev_break_type == G_UNICODE_BREAK_INFIX_SEPARATOR &&
-	      (break_type == G_UNICODE_BREAK_ALPHABETIC ||
-	       break_type == G_UNICODE_BREAK_HEBREW_LETTER))
-	    break_op = BREAK_PROHIBITED;
-
-	  /* Rule LB28 */
-	  if ((prev_break_type == G_UNICODE_BREAK_ALPHABETIC ||
-	       prev_break_type == G_UNICODE_BREAK_HEBREW_LETTER) &&
-	      (break_type == G_UNICODE_BREAK_ALPHABETIC ||
-	       break_type == G_UNICODE_BREAK_HEBREW_LETTER))
-	    break_op = BREAK_PROHIBITED;
-
-	  /* Rule LB27 */
-	  if ((prev_break_type == G_UNICODE_BREAK_HANGUL_L_JAMO ||
-	       prev_break_type == G_UNICODE_BREAK_HANGUL_V_JAMO ||
-	       prev_break_type == G_UNICODE_BREAK_HANGUL_T_JAMO ||
-	       prev_break_type == G_UNICODE_BREAK_HANGUL_LV_SYLLABLE ||
-	       prev_break_type == G_UNICODE_BREAK_HANGUL_LVT_SYLLABLE) &&
-	      (break_type == G_UNICODE_BREAK_INSEPARABLE ||
-	       break_type == G_UNICODE_BREAK_POSTFIX))
-	    break_op = BREAK_PROHIBITED;
-
-	  if (prev_break_type == G_UNICODE_BREAK_PREFIX &&
-	      (break_type == G_UNICODE_BREAK_HANGUL_L_JAMO ||
-	       break_type == G_UNICODE_BREAK_HANGUL_V_JAMO ||
-	       break_type == G_UNICODE_BREAK_HANGUL_T_JAMO ||
-	       break_type == G_UNICODE_BREAK_HANGUL_LV_SYLLABLE ||
-	       break_type == G_UNICODE_BREAK_HANGUL_LVT_SYLLABLE))
-	    break_op = BREAK_PROHIBITED;
-
-	  /* Rule LB26 */
-	  if (prev_break_type == G_UNICODE_BREAK_HANGUL_L_JAMO &&
-	      (break_type == G_UNICODE_BREAK_HANGUL_L_JAMO ||
-	       break_type == G_UNICODE_BREAK_HANGUL_V_JAMO ||
-	       break_type == G_UNICODE_BREAK_HANGUL_LV_SYLLABLE ||
-	       break_type == G_UNICODE_BREAK_HANGUL_LVT_SYLLABLE))
-	    break_op = BREAK_PROHIBITED;
-
-	  if ((prev_break_type == G_UNICODE_BREAK_HANGUL_V_JAMO ||
-	       prev_break_type == G_UNICODE_BREAK_HANGUL_LV_SYLLABLE) &&
-	      (break_type == G_UNICODE_BREAK_HANGUL_V_JAMO ||
-	       break_type == G_UNICODE_BREAK_HANGUL_T_JAMO))
-	    break_op = BREAK_PROHIBITED;
-
-	  if ((prev_break_type == G_UNICODE_BREAK_HANGUL_T_JAMO ||
-	       prev_break_type == G_UNICODE_BREAK_HANGUL_LVT_SYLLABLE) &&
-	      break_type == G_UNICODE_BREAK_HANGUL_T_JAMO)
-	    break_op = BREAK_PROHIBITED;
+	  PROHIBIT_IF_OUTRANKS (LINE_BREAK_RANK_LB30A_RI,
+				prev_LB_type == LB_RI_Odd && LB_type == LB_RI_Even);
 
 	  /* Rule LB25 with Example 7 of Customization */
-	  if ((prev_break_type == G_UNICODE_BREAK_PREFIX ||
-	       prev_break_type == G_UNICODE_BREAK_POSTFIX) &&
-	      break_type == G_UNICODE_BREAK_NUMERIC)
-	    break_op = BREAK_PROHIBITED;
-
-	  if ((prev_break_type == G_UNICODE_BREAK_PREFIX ||
-	       prev_break_type == G_UNICODE_BREAK_POSTFIX) &&
-	      (break_type == G_UNICODE_BREAK_OPEN_PUNCTUATION ||
-	       break_type == G_UNICODE_BREAK_HYPHEN) &&
-	      next_break_type == G_UNICODE_BREAK_NUMERIC)
-	    break_op = BREAK_PROHIBITED;
-
-	  if ((prev_break_type == G_UNICODE_BREAK_OPEN_PUNCTUATION ||
-	       prev_break_type == G_UNICODE_BREAK_HYPHEN) &&
-	      break_type == G_UNICODE_BREAK_NUMERIC)
-	    break_op = BREAK_PROHIBITED;
-
-	  if (prev_break_type == G_UNICODE_BREAK_NUMERIC &&
-	      (break_type == G_UNICODE_BREAK_NUMERIC ||
-	       break_type == G_UNICODE_BREAK_SYMBOL ||
-	       break_type == G_UNICODE_BREAK_INFIX_SEPARATOR))
-	    break_op = BREAK_PROHIBITED;
-
-	  if (prev_LB_type == LB_Numeric &&
-	      (break_type == G_UNICODE_BREAK_NUMERIC ||
-	       break_type == G_UNICODE_BREAK_SYMBOL ||
-	       break_type == G_UNICODE_BREAK_INFIX_SEPARATOR ||
-	       break_type == G_UNICODE_BREAK_CLOSE_PUNCTUATION ||
-	       break_type == G_UNICODE_BREAK_CLOSE_PARANTHESIS))
-	    break_op = BREAK_PROHIBITED;
-
-	  if ((prev_LB_type == LB_Numeric ||
-	       prev_LB_type == LB_Numeric_Close) &&
-	      (break_type == G_UNICODE_BREAK_POSTFIX ||
-	       break_type == G_UNICODE_BREAK_PREFIX))
-	    break_op = BREAK_PROHIBITED;
-
-	  /* Rule LB24 */
-	  if ((prev_break_type == G_UNICODE_BREAK_PREFIX ||
-	       prev_break_type == G_UNICODE_BREAK_POSTFIX) &&
-	      (break_type == G_UNICODE_BREAK_ALPHABETIC ||
-	       break_type == G_UNICODE_BREAK_HEBREW_LETTER))
-	    break_op = BREAK_PROHIBITED;
-
-	  if ((prev_break_type == G_UNICODE_BREAK_ALPHABETIC ||
-	       prev_break_type == G_UNICODE_BREAK_HEBREW_LETTER) &&
-	      (break_type == G_UNICODE_BREAK_PREFIX ||
-	       break_type == G_UNICODE_BREAK_POSTFIX))
-	    break_op = BREAK_PROHIBITED;
-
-	  /* Rule LB23 */
-	  if ((prev_break_type == G_UNICODE_BREAK_ALPHABETIC ||
-	       prev_break_type == G_UNICODE_BREAK_HEBREW_LETTER) &&
-	      break_type == G_UNICODE_BREAK_NUMERIC)
-	    break_op = BREAK_PROHIBITED;
-
-	  if (prev_break_type == G_UNICODE_BREAK_NUMERIC &&
-	      (break_type == G_UNICODE_BREAK_ALPHABETIC ||
-	       break_type == G_UNICODE_BREAK_HEBREW_LETTER))
-	    break_op = BREAK_PROHIBITED;
-
-	  /* Rule LB23a */
-	  if (prev_break_type == G_UNICODE_BREAK_PREFIX &&
-	      (break_type == G_UNICODE_BREAK_IDEOGRAPHIC ||
-	       break_type == G_UNICODE_BREAK_EMOJI_BASE ||
-	       break_type == G_UNICODE_BREAK_EMOJI_MODIFIER))
-	    break_op = BREAK_PROHIBITED;
-
-	  if ((prev_break_type == G_UNICODE_BREAK_IDEOGRAPHIC ||
-	       prev_break_type == G_UNICODE_BREAK_EMOJI_BASE ||
-	       prev_break_type == G_UNICODE_BREAK_EMOJI_MODIFIER) &&
-	      break_type == G_UNICODE_BREAK_POSTFIX)
-	    break_op = BREAK_PROHIBITED;
-
-	  /* Rule LB22 */
-	  if (break_type == G_UNICODE_BREAK_INSEPARABLE)
-	    {
-	      if (prev_break_type == G_UNICODE_BREAK_ALPHABETIC ||
-		  prev_break_type == G_UNICODE_BREAK_HEBREW_LETTER)
-		break_op = BREAK_PROHIBITED;
-
-	      if (prev_break_type == G_UNICODE_BREAK_EXCLAMATION)
-		break_op = BREAK_PROHIBITED;
-
-	      if (prev_break_type == G_UNICODE_BREAK_IDEOGRAPHIC ||
-		  prev_break_type == G_UNICODE_BREAK_EMOJI_BASE ||
-		  prev_break_type == G_UNICODE_BREAK_EMOJI_MODIFIER)
-		break_op = BREAK_PROHIBITED;
-
-	      if (prev_break_type == G_UNICODE_BREAK_INSEPARABLE)
-		break_op = BREAK_PROHIBITED;
-
-	      if (prev_break_type == G_UNICODE_BREAK_NUMERIC)
-		break_op = BREAK_PROHIBITED;
-	    }
-
-	  if (break_type == G_UNICODE_BREAK_AFTER ||
-	      break_type == G_UNICODE_BREAK_HYPHEN ||
-	      break_type == G_UNICODE_BREAK_NON_STARTER ||
-	      prev_break_type == G_UNICODE_BREAK_BEFORE)
-	    break_op = BREAK_PROHIBITED; /* Rule LB21 */
-
-	  if (prev_prev_break_type == G_UNICODE_BREAK_HEBREW_LETTER &&
-	      (prev_break_type == G_UNICODE_BREAK_HYPHEN ||
-	       prev_break_type == G_UNICODE_BREAK_AFTER))
-	    break_op = BREAK_PROHIBITED; /* Rule LB21a */
-
-	  if (prev_break_type == G_UNICODE_BREAK_SYMBOL &&
-	      break_type == G_UNICODE_BREAK_HEBREW_LETTER)
-	    break_op = BREAK_PROHIBITED; /* Rule LB21b */
-
-	  if (prev_break_type == G_UNICODE_BREAK_CONTINGENT ||
-	      break_type == G_UNICODE_BREAK_CONTINGENT)
-	    break_op = BREAK_ALLOWED; /* Rule LB20 */
-
-	  if (prev_break_type == G_UNICODE_BREAK_QUOTATION ||
-	      break_type == G_UNICODE_BREAK_QUOTATION)
-	    break_op = BREAK_PROHIBITED; /* Rule LB19 */
-
-	  /* handle related rules for Space as state machine here,
-	     and override the pair table result. */
-	  if (prev_break_type == G_UNICODE_BREAK_SPACE) /* Rule LB18 */
-	    break_op = BREAK_ALLOWED;
-
-	  if (row_break_type == G_UNICODE_BREAK_BEFORE_AND_AFTER &&
-	      break_type == G_UNICODE_BREAK_BEFORE_AND_AFTER)
-	    break_op = BREAK_PROHIBITED; /* Rule LB17 */
-
-	  if ((row_break_type == G_UNICODE_BREAK_CLOSE_PUNCTUATION ||
-	       row_break_type == G_UNICODE_BREAK_CLOSE_PARANTHESIS) &&
-	      break_type == G_UNICODE_BREAK_NON_STARTER)
-	    break_op = BREAK_PROHIBITED; /* Rule LB16 */
-
-	  if (row_break_type == G_UNICODE_BREAK_QUOTATION &&
-	      break_type == G_UNICODE_BREAK_OPEN_PUNCTUATION)
-	    break_op = BREAK_PROHIBITED; /* Rule LB15 */
-
-	  if (row_break_type == G_UNICODE_BREAK_OPEN_PUNCTUATION)
-	    break_op = BREAK_PROHIBITED; /* Rule LB14 */
-
-	  /* Rule LB13 with Example 7 of Customization */
-	  if (break_type == G_UNICODE_BREAK_EXCLAMATION)
-	    break_op = BREAK_PROHIBITED;
-
-	  if (prev_break_type != G_UNICODE_BREAK_NUMERIC &&
-	      (break_type == G_UNICODE_BREAK_CLOSE_PUNCTUATION ||
-	       break_type == G_UNICODE_BREAK_CLOSE_PARANTHESIS ||
-	       break_type == G_UNICODE_BREAK_INFIX_SEPARATOR ||
-	       break_type == G_UNICODE_BREAK_SYMBOL))
-	    break_op = BREAK_PROHIBITED;
-
-	  if (prev_break_type == G_UNICODE_BREAK_NON_BREAKING_GLUE)
-	    break_op = BREAK_PROHIBITED; /* Rule LB12 */
-
-	  if (break_type == G_UNICODE_BREAK_NON_BREAKING_GLUE &&
-	      (prev_break_type != G_UNICODE_BREAK_SPACE &&
-	       prev_break_type != G_UNICODE_BREAK_AFTER &&
-	       prev_break_type != G_UNICODE_BREAK_HYPHEN))
-	    break_op = BREAK_PROHIBITED; /* Rule LB12a */
-
-	  if (prev_break_type == G_UNICODE_BREAK_WORD_JOINER ||
-	      break_type == G_UNICODE_BREAK_WORD_JOINER)
-	    break_op = BREAK_PROHIBITED; /* Rule LB11 */
-
-
-	  /* Rule LB9 */
-	  if (break_type == G_UNICODE_BREAK_COMBINING_MARK ||
-              break_type == G_UNICODE_BREAK_ZERO_WIDTH_JOINER)
-	    {
-	      if (!(prev_break_type == G_UNICODE_BREAK_MANDATORY ||
-		    prev_break_type == G_UNICODE_BREAK_CARRIAGE_RETURN ||
-		    prev_break_type == G_UNICODE_BREAK_LINE_FEED ||
-		    prev_break_type == G_UNICODE_BREAK_NEXT_LINE ||
-		    prev_break_type == G_UNICODE_BREAK_SPACE ||
-		    prev_break_type == G_UNICODE_BREAK_ZERO_WIDTH_SPACE))
-		break_op = BREAK_PROHIBITED;
-	    }
-
-	  if (row_break_type == G_UNICODE_BREAK_ZERO_WIDTH_SPACE)
-	    break_op = BREAK_ALLOWED; /* Rule LB8 */
-
-	  if (prev_wc == 0x200D)
-	    break_op = BREAK_PROHIBITED; /* Rule LB8a */
-
-	  if (break_type == G_UNICODE_BREAK_SPACE ||
-	      break_type == G_UNICODE_BREAK_ZERO_WIDTH_SPACE)
-	    break_op = BREAK_PROHIBITED; /* Rule LB7 */
-
-	  /* Rule LB6 */
-	  if (break_type == G_UNICODE_BREAK_MANDATORY ||
-	      break_type == G_UNICODE_BREAK_CARRIAGE_RETURN ||
-	      break_type == G_UNICODE_BREAK_LINE_FEED ||
-	      break_type == G_UNICODE_BREAK_NEXT_LINE)
-	    break_op = BREAK_PROHIBITED;
+	  PROHIBIT_IF_OUTRANKS (LINE_BREAK_RANK_LB25_PREFIX_NUMERIC,
+				(prev_break_type == G_UNICODE_BREAK_PREFIX ||
+				 prev_break_type == G_UNICODE_BREAK_POSTFIX) &&
+				(break_type == G_UNICODE_BREAK_OPEN_PUNCTUATION ||
+				 break_type == G_UNICODE_BREAK_HYPHEN) &&
+				next_break_type == G_UNICODE_BREAK_NUMERIC);
+
+	  PROHIBIT_IF_OUTRANKS (LINE_BREAK_RANK_LB25_NUMERIC,
+				prev_LB_type == LB_Numeric &&
+				(break_type == G_UNICODE_BREAK_NUMERIC ||
+				 break_type == G_UNICODE_BREAK_SYMBOL ||
+				 break_type == G_UNICODE_BREAK_INFIX_SEPARATOR ||
+				 break_type == G_UNICODE_BREAK_CLOSE_PUNCTUATION ||
+				 break_type == G_UNICODE_BREAK_CLOSE_PARANTHESIS));
+
+	  PROHIBIT_IF_OUTRANKS (LINE_BREAK_RANK_LB25_NUMERIC_POSTFIX,
+				(prev_LB_type == LB_Numeric ||
+				 prev_LB_type == LB_Numeric_Close) &&
+				(break_type == G_UNICODE_BREAK_POSTFIX ||
+				 break_type == G_UNICODE_BREAK_PREFIX));
+
+	  /* Rule LB21a */
+	  PROHIBIT_IF_OUTRANKS (LINE_BREAK_RANK_LB21A,
+				prev_prev_break_type == G_UNICODE_BREAK_HEBREW_LETTER &&
+				(prev_break_type == G_UNICODE_BREAK_HYPHEN ||
+				 prev_break_type == G_UNICODE_BREAK_AFTER));
+
+	  /* Rule LB8a */
+	  PROHIBIT_IF_OUTRANKS (LINE_BREAK_RANK_LB8A,
+				prev_wc == 0x200D);
+
+#undef PROHIBIT_IF_OUTRANKS
 
 	  /* Rules LB4 and LB5 */
 	  if (prev_break_type == G_UNICODE_BREAK_MANDATORY ||
@@ -1343,7 +1289,7 @@ vogue_default_break (const gchar   *text,
 	      prev_break_type == G_UNICODE_BREAK_LINE_FEED ||
 	      prev_break_type == G_UNICODE_BREAK_NEXT_LINE)
 	    {
-	      attrs[i].is_mandatory_break = TRUE;
+	      attr.is_mandatory_break = TRUE;
 	      break_op = BREAK_ALLOWED;
 	    }
 
@@ -1351,17 +1297,17 @@ vogue_default_break (const gchar   *text,
 	    {
 	    case BREAK_PROHIBITED:
 	      /* can't break here */
-	      attrs[i].is_line_break = FALSE;
+	      attr.is_line_break = FALSE;
 	      break;
 
 	    case BREAK_IF_SPACES:
 	      /* break if prev char was space */
 	      if (prev_break_type != G_UNICODE_BREAK_SPACE)
-		attrs[i].is_line_break = FALSE;
+		attr.is_line_break = FALSE;
 	      break;
 
 	    case BREAK_ALLOWED:
-	      attrs[i].is_line_break = TRUE;
+	      attr.is_line_break = TRUE;
 	      break;
 
 	    case BREAK_ALREADY_HANDLED:
@@ -1430,10 +1376,12 @@ vogue_default_break (const gchar   *text,
       /* ---- Word breaks ---- */
 
       /* default to not a word start/end */
-      attrs[i].is_word_start = FALSE;
-      attrs[i].is_word_end = FALSE;
+      attr.is_word_start = FALSE;
+      attr.is_word_end = FALSE;
 
-      if (current_word_type != WordNone)
+      if (!want_words)
+	;
+      else if (current_word_type != WordNone)
 	{
 	  /* Check for a word end */
 	  switch ((int) type)
@@ -1466,7 +1414,7 @@ vogue_default_break (const gchar   *text,
 			   !JAPANESE (wc)) ||
 			  (!JAPANESE (last_word_letter) &&
 			   JAPANESE (wc)))
-			attrs[i].is_word_end = TRUE;
+			attr.is_word_end = TRUE;
 		    }
 		}
 	      last_word_letter = wc;
@@ -1480,7 +1428,7 @@ vogue_default_break (const gchar   *text,
 
 	    default:
 	      /* Punctuation, control/format chars, etc. all end a word. */
-	      attrs[i].is_word_end = TRUE;
+	      attr.is_word_end = TRUE;
 	      current_word_type = WordNone;
 	      break;
 	    }
@@ -1497,7 +1445,7 @@ vogue_default_break (const gchar   *text,
 	    case G_UNICODE_UPPERCASE_LETTER:
 	      current_word_type = WordLetters;
 	      last_word_letter = wc;
-	      attrs[i].is_word_start = TRUE;
+	      attr.is_word_start = TRUE;
 	      break;
 
 	    case G_UNICODE_DECIMAL_NUMBER:
@@ -1505,7 +1453,7 @@ vogue_default_break (const gchar   *text,
 	    case G_UNICODE_OTHER_NUMBER:
 	      current_word_type = WordNumbers;
 	      last_word_letter = wc;
-	      attrs[i].is_word_start = TRUE;
+	      attr.is_word_start = TRUE;
 	      break;
 
 	    default:
@@ -1518,8 +1466,18 @@ vogue_default_break (const gchar   *text,
       {
 
 	/* default to not a sentence start/end */
-	attrs[i].is_sentence_start = FALSE;
-	attrs[i].is_sentence_end = FALSE;
+	attr.is_sentence_start = FALSE;
+	attr.is_sentence_end = FALSE;
+
+	/* The rest of the attributes of this position are final now.
+	 * They were collected in @attr, which is cheaper than setting
+	 * the bit-fields one by one in @attrs, but the sentence
+	 * boundaries below may be marked at @i as well.
+	 */
+	attrs[i] = attr;
+
+	if (!want_sentences)
+	  goto sentences_done;
 
 	/* maybe start sentence */
 	if (last_sentence_start == -1 && !is_sentence_boundary)
@@ -1546,16 +1504,19 @@ vogue_default_break (const gchar   *text,
 	    attrs[i - 1].is_white)
 	    last_sentence_start++;
 
+      sentences_done:
+	;
       }
 
       prev_wc = wc;
+      prev_flags = props.flags;
 
       /* wc might not be a valid Unicode base character, but really all we
        * need to know is the last non-combining character */
       if (type != G_UNICODE_SPACING_MARK &&
 	  type != G_UNICODE_ENCLOSING_MARK &&
 	  type != G_UNICODE_NON_SPACING_MARK)
-	base_character = wc;
+	base_flags = props.flags;
     }
 
   i--;
@@ -1563,17 +1524,58 @@ vogue_default_break (const gchar   *text,
   attrs[i].is_cursor_position = TRUE;  /* Rule GB2 */
   attrs[0].is_cursor_position = TRUE;  /* Rule GB1 */
 
-  attrs[i].is_word_boundary = TRUE;  /* Rule WB2 */
-  attrs[0].is_word_boundary = TRUE;  /* Rule WB1 */
+  if (want_word_boundaries)
+    {
+      attrs[i].is_word_boundary = TRUE;  /* Rule WB2 */
+      attrs[0].is_word_boundary = TRUE;  /* Rule WB1 */
+    }
 
   attrs[i].is_line_break = TRUE;  /* Rule LB3 */
   attrs[0].is_line_break = FALSE; /* Rule LB2 */
+}
+
+/**
+ * vogue_default_break:
+ * @text: text to break. Must be valid UTF-8
+ * @length: length of text in bytes (may be -1 if @text is nul-terminated)
+ * @analysis: (nullable): a #VogueAnalysis for the @text
+ * @attrs: logical attributes to fill in
+ * @attrs_len: size of the array passed as @attrs
+ *
+ * This is the default break algorithm. It applies Unicode
+ * rules without language-specific tailoring, therefore
+ * the @analyis argument is unused and can be %NULL.
+ *
+ * See vogue_tailor_break() for language-specific breaks.
+ **/
+void
+vogue_default_break (const gchar   *text,
+		     gint           length,
+		     VogueAnalysis *analysis G_GNUC_UNUSED,
+		     VogueLogAttr  *attrs,
+		     int            attrs_len G_GNUC_UNUSED)
+{
+  g_return_if_fail (length == 0 || text != NULL);
+  g_return_if_fail (attrs != NULL);
 
+  default_break (text, length, attrs, PANGO_LOG_ATTR_ALL);
 }
 
-static gboolean
-break_script (const char          *item_text,
-	      unsigned int         item_length,
+void
+_vogue_default_break_with_flags (const gchar       *text,
+				 gint               length,
+				 VogueLogAttr      *attrs,
+				 VogueLogAttrFlags  flags)
+{
+  g_return_if_fail (length == 0 || text != NULL);
+  g_return_if_fail (attrs != NULL);
+
+  default_break (text, length, attrs, flags);
+}
+
+static gboolean
+break_script (const char          *item_text,
+	      unsigned int         item_length,
 	      const VogueAnalysis *analysis,
 	      VogueLogAttr        *attrs,
 	      int                  attrs_len);
@@ -1638,6 +1640,48 @@ vogue_break (const gchar   *text,
   tailor_break        (text, length, analysis, -1, attrs, attrs_len);
 }
 
+/* Finds the first run of paragraph delimiters in [@text, @end).
+ * Returns %FALSE if there is none.
+ */
+static gboolean
+find_paragraph_delimiter (const char  *text,
+                          const char  *end,
+                          const char **delimiter,
+                          const char **next_start)
+{
+  const char *p;
+  const char *next;
+
+  for (p = text; ; p++)
+    {
+      p = _vogue_find_separator_candidate (p, end, FALSE);
+      if (p == end)
+        return FALSE;
+
+      if (*p == '\n' || *p == '\r')
+        {
+          next = p + 1;
+          break;
+        }
+
+      if (end - p >= 3 &&
+          memcmp (p, PARAGRAPH_SEPARATOR_STRING, 3) == 0)
+        {
+          next = p + 3;
+          break;
+        }
+    }
+
+  /* don't break between \r and \n */
+  if (*p == '\r' && next < end && *next == '\n')
+    next++;
+
+  *delimiter = p;
+  *next_start = next;
+
+  return TRUE;
+}
+
 /**
  * vogue_find_paragraph_boundary:
  * @text: UTF-8 text
@@ -1664,78 +1708,103 @@ vogue_find_paragraph_boundary (const gchar *text,
 			       gint        *paragraph_delimiter_index,
 			       gint        *next_paragraph_start)
 {
-  const gchar *p = text;
-  const gchar *end;
-  const gchar *start = NULL;
-  const gchar *delimiter = NULL;
-
-  /* Only one character has type G_UNICODE_PARAGRAPH_SEPARATOR in
-   * Unicode 5.0; update the following code if that changes.
-   */
-
-  /* prev_sep is the first byte of the previous separator.  Since
-   * the valid separators are \r, \n, and PARAGRAPH_SEPARATOR, the
-   * first byte is enough to identify it.
-   */
-  gchar prev_sep;
-
+  const gchar *delimiter;
+  const gchar *start;
 
   if (length < 0)
     length = strlen (text);
 
-  end = text + length;
-
   if (paragraph_delimiter_index)
     *paragraph_delimiter_index = length;
 
   if (next_paragraph_start)
     *next_paragraph_start = length;
 
-  if (length == 0)
+  if (!find_paragraph_delimiter (text, text + length, &delimiter, &start))
     return;
 
-  prev_sep = 0;
+  if (paragraph_delimiter_index)
+    *paragraph_delimiter_index = delimiter - text;
+
+  if (next_paragraph_start)
+    *next_paragraph_start = start - text;
+}
+
+/**
+ * vogue_find_paragraph_boundaries:
+ * @text: UTF-8 text
+ * @length: length of @text in bytes, or -1 if nul-terminated
+ * @delimiter_indices: (out) (array length=n_paragraphs) (transfer full) (optional):
+ *   return location for the index of the delimiter of each paragraph
+ * @paragraph_starts: (out) (array length=n_paragraphs) (transfer full) (optional):
+ *   return location for the start index of each paragraph
+ * @n_paragraphs: (out): return location for the number of paragraphs
+ *
+ * Splits all of @text into paragraphs in one call. The results are
+ * the same as those of calling vogue_find_paragraph_boundary()
+ * repeatedly, starting each call at the start of the next paragraph,
+ * until no more delimiters are found. If @text ends with a delimiter,
+ * the last paragraph is empty.
+ *
+ * The paragraph that ends at the end of @text has its delimiter
+ * index set to the length of @text. Free the returned arrays
+ * with g_free().
+ *
+ * Since: 1.46
+ */
+void
+vogue_find_paragraph_boundaries (const char  *text,
+                                 int          length,
+                                 int        **delimiter_indices,
+                                 int        **paragraph_starts,
+                                 int         *n_paragraphs)
+{
+  GArray *delimiters;
+  GArray *starts;
+  const char *p, *end;
 
-  while (p < end)
+  g_return_if_fail (length == 0 || text != NULL);
+  g_return_if_fail (n_paragraphs != NULL);
+
+  if (length < 0)
+    length = strlen (text);
+
+  delimiters = g_array_new (FALSE, FALSE, sizeof (int));
+  starts = g_array_new (FALSE, FALSE, sizeof (int));
+
+  end = text + length;
+  p = text;
+  while (TRUE)
     {
-      if (prev_sep == '\n' ||
-	  prev_sep == PARAGRAPH_SEPARATOR_STRING[0])
-	{
-	  g_assert (delimiter);
-	  start = p;
-	  break;
-	}
-      else if (prev_sep == '\r')
-	{
-	  /* don't break between \r and \n */
-	  if (*p != '\n')
-	    {
-	      g_assert (delimiter);
-	      start = p;
-	      break;
-	    }
-	}
+      const char *delimiter, *next;
+      int index;
 
-      if (*p == '\n' ||
-	   *p == '\r' ||
-	   !strncmp(p, PARAGRAPH_SEPARATOR_STRING,
-		    strlen(PARAGRAPH_SEPARATOR_STRING)))
-	{
-	  if (delimiter == NULL)
-	    delimiter = p;
-	  prev_sep = *p;
-	}
-      else
-	prev_sep = 0;
+      index = p - text;
+      g_array_append_val (starts, index);
 
-      p = g_utf8_next_char (p);
+      if (!find_paragraph_delimiter (p, end, &delimiter, &next))
+        {
+          g_array_append_val (delimiters, length);
+          break;
+        }
+
+      index = delimiter - text;
+      g_array_append_val (delimiters, index);
+
+      p = next;
     }
 
-  if (delimiter && paragraph_delimiter_index)
-    *paragraph_delimiter_index = delimiter - text;
+  *n_paragraphs = starts->len;
 
-  if (start && next_paragraph_start)
-    *next_paragraph_start = start - text;
+  if (delimiter_indices)
+    *delimiter_indices = (int *) g_array_free (delimiters, FALSE);
+  else
+    g_array_free (delimiters, TRUE);
+
+  if (paragraph_starts)
+    *paragraph_starts = (int *) g_array_free (starts, FALSE);
+  else
+    g_array_free (starts, TRUE);
 }
 
 /**
@@ -1830,18 +1899,21 @@ vogue_get_log_attrs (const char    *text,
 		     VogueLanguage *language,
 		     VogueLogAttr  *log_attrs,
 		     int            attrs_len)
+{
+  vogue_get_log_attrs_with_flags (text, length, level, language,
+                                  PANGO_LOG_ATTR_ALL,
+                                  log_attrs, attrs_len);
+}
+
+static int
+tailor_segments (const char    *text,
+                 int            length,
+                 VogueAnalysis *analysis,
+                 VogueLogAttr  *log_attrs)
 {
   int chars_broken;
-  VogueAnalysis analysis = { NULL };
   VogueScriptIter iter;
 
-  g_return_if_fail (length == 0 || text != NULL);
-  g_return_if_fail (log_attrs != NULL);
-
-  analysis.level = level;
-
-  vogue_default_break (text, length, &analysis, log_attrs, attrs_len);
-
   chars_broken = 0;
 
   _vogue_script_iter_init (&iter, text, length);
@@ -1851,19 +1923,574 @@ vogue_get_log_attrs (const char    *text,
       VogueScript script;
 
       vogue_script_iter_get_range (&iter, &run_start, &run_end, &script);
-      analysis.script = script;
+      analysis->script = script;
 
-      chars_broken += tailor_segment (run_start, run_end, chars_broken, &analysis, log_attrs);
+      chars_broken += tailor_segment (run_start, run_end, chars_broken, analysis, log_attrs);
     }
   while (vogue_script_iter_next (&iter));
   _vogue_script_iter_fini (&iter);
 
+  return chars_broken;
+}
+
+/**
+ * vogue_get_log_attrs_with_flags:
+ * @text: text to process. Must be valid UTF-8
+ * @length: length in bytes of @text
+ * @level: embedding level, or -1 if unknown
+ * @language: language tag
+ * @flags: the groups of attributes to compute
+ * @log_attrs: (array length=attrs_len): array with one #VogueLogAttr
+ *   per character in @text, plus one extra, to be filled in
+ * @attrs_len: length of @log_attrs array
+ *
+ * Like vogue_get_log_attrs(), but only computes the attributes
+ * selected by @flags. Line breaks, whitespace, cursor positions
+ * and expandable spaces are always computed; the fields of the
+ * groups that are not requested are set to %FALSE.
+ *
+ * Leaving out word and sentence boundaries makes this noticeably
+ * cheaper, which is useful when only line breaking is of interest.
+ *
+ * Since: 1.46
+ */
+void
+vogue_get_log_attrs_with_flags (const char        *text,
+                                int                length,
+                                int                level,
+                                VogueLanguage     *language G_GNUC_UNUSED,
+                                VogueLogAttrFlags  flags,
+                                VogueLogAttr      *log_attrs,
+                                int                attrs_len)
+{
+  int chars_broken;
+  VogueAnalysis analysis = { NULL };
+
+  g_return_if_fail (length == 0 || text != NULL);
+  g_return_if_fail (log_attrs != NULL);
+
+  analysis.level = level;
+
+  default_break (text, length, log_attrs, flags);
+
+  chars_broken = tailor_segments (text, length, &analysis, log_attrs);
+
   if (chars_broken + 1 > attrs_len)
     g_warning ("vogue_get_log_attrs: attrs_len should have been at least %d, but was %d.  Expect corrupted memory.",
 	       chars_broken + 1,
 	       attrs_len);
 }
 
+/* Fills in the attribute groups in @flags for @log_attrs, which
+ * were computed for the same text without them. Attributes that
+ * were already computed are left alone, so tailoring that was
+ * applied to them (such as allow-breaks attributes) is kept.
+ */
+void
+_vogue_log_attrs_complete (const char        *text,
+                           int                length,
+                           VogueLogAttrFlags  flags,
+                           VogueLogAttr      *log_attrs,
+                           int                attrs_len)
+{
+  VogueAnalysis analysis = { NULL };
+  VogueLogAttr *attrs;
+  int i;
+
+  attrs = g_new (VogueLogAttr, attrs_len);
+
+  default_break (text, length, attrs, flags);
+
+  /* Script tailoring may add word starts and ends at line breaks,
+   * which it already did on @log_attrs, with the right line breaks,
+   * so merge the untailored ones.
+   */
+  for (i = 0; i < attrs_len; i++)
+    {
+      if (flags & (PANGO_LOG_ATTR_WORDS | PANGO_LOG_ATTR_SENTENCES))
+        log_attrs[i].is_word_boundary = attrs[i].is_word_boundary;
+
+      if (flags & PANGO_LOG_ATTR_WORDS)
+        {
+          log_attrs[i].is_word_start |= attrs[i].is_word_start;
+          log_attrs[i].is_word_end |= attrs[i].is_word_end;
+        }
+
+      if (flags & PANGO_LOG_ATTR_SENTENCES)
+        {
+          log_attrs[i].is_sentence_boundary = attrs[i].is_sentence_boundary;
+          log_attrs[i].is_sentence_start = attrs[i].is_sentence_start;
+          log_attrs[i].is_sentence_end = attrs[i].is_sentence_end;
+        }
+    }
+
+  if (flags & PANGO_LOG_ATTR_BACKSPACE)
+    {
+      analysis.level = -1;
+      tailor_segments (text, length, &analysis, attrs);
+
+      for (i = 0; i < attrs_len; i++)
+        log_attrs[i].backspace_deletes_character = attrs[i].backspace_deletes_character;
+    }
+
+  g_free (attrs);
+}
+
+/* Parallel log attributes.
+ *
+ * The text is cut into chunks right after hard line breaks (LF or
+ * PARAGRAPH SEPARATOR). Every rule of the default break algorithm
+ * restarts after those, so each chunk can be broken on its own and
+ * only the position at the seam needs fixing: its left context is
+ * what the previous chunk saw at its end, and the character itself
+ * is what the next chunk saw at its start.
+ *
+ * Thai is broken with a dictionary, across whole script runs, so
+ * we never cut next to Thai text.
+ */
+
+#define MIN_CHUNK_LENGTH (16 * 1024)
+
+typedef struct
+{
+  GMutex mutex;
+  GCond cond;
+  guint pending;
+} BreakBatch;
+
+typedef struct
+{
+  BreakBatch *batch;
+  const char *text;
+  int length;
+  int level;
+  VogueLogAttrFlags flags;
+  VogueLogAttr *attrs;
+  int n_chars;
+} BreakTask;
+
+static void
+break_task_func (gpointer data,
+                 gpointer user_data G_GNUC_UNUSED)
+{
+  BreakTask *task = data;
+  BreakBatch *batch = task->batch;
+
+  task->n_chars = vogue_utf8_strlen (task->text, task->length);
+  task->attrs = g_new (VogueLogAttr, task->n_chars + 1);
+  vogue_get_log_attrs_with_flags (task->text, task->length,
+                                  task->level, NULL,
+                                  task->flags,
+                                  task->attrs, task->n_chars + 1);
+
+  g_mutex_lock (&batch->mutex);
+  if (--batch->pending == 0)
+    g_cond_signal (&batch->cond);
+  g_mutex_unlock (&batch->mutex);
+}
+
+static gboolean
+is_thai (const char *p)
+{
+  return g_unichar_get_script (g_utf8_get_char (p)) == G_UNICODE_SCRIPT_THAI;
+}
+
+static inline gboolean
+is_hard_break (const char *p,
+               const char *end)
+{
+  return *p == '\n' ||
+         ((guchar) p[0] == 0xE2 && end - p >= 3 &&
+          (guchar) p[1] == 0x80 && (guchar) p[2] == 0xA9);
+}
+
+/* Whether the character at @p extends the one before it for
+ * the word and sentence rules. After a CR LF pair, these look
+ * back past the hard break.
+ */
+static gboolean
+is_extend_or_format (const char *p)
+{
+  gunichar wc = g_utf8_get_char (p);
+
+  switch ((int) g_unichar_type (wc))
+    {
+    case G_UNICODE_FORMAT:
+    case G_UNICODE_SPACING_MARK:
+    case G_UNICODE_ENCLOSING_MARK:
+    case G_UNICODE_NON_SPACING_MARK:
+      return TRUE;
+    case G_UNICODE_MODIFIER_LETTER:
+      return wc >= 0xFF9E && wc <= 0xFF9F;
+    default:
+      return FALSE;
+    }
+}
+
+/* Whether we can cut between the hard break at @sep and @after */
+static gboolean
+is_safe_seam (const char *text,
+              const char *sep,
+              const char *after,
+              const char *end)
+{
+  if (after >= end)
+    return FALSE;
+
+  return (sep == text || !is_thai (g_utf8_prev_char (sep))) &&
+         !is_thai (after) && !is_extend_or_format (after);
+}
+
+/* Returns the first position at or after @p that follows a hard
+ * line break and is safe to cut at, or @end if there is none.
+ */
+static const char *
+find_chunk_end (const char *text,
+                const char *p,
+                const char *end)
+{
+  for (; p < end; p++)
+    {
+      p = _vogue_find_separator_candidate (p, end, FALSE);
+      if (p == end)
+        break;
+
+      if (is_hard_break (p, end))
+        {
+          const char *after = *p == '\n' ? p + 1 : p + 3;
+
+          if (is_safe_seam (text, p, after, end))
+            return after;
+        }
+    }
+
+  return end;
+}
+
+/* Returns the last position at or before @p that follows a hard
+ * line break and is safe to cut at, or @text if there is none.
+ */
+static const char *
+find_chunk_start (const char *text,
+                  const char *p,
+                  const char *end)
+{
+  while (p > text)
+    {
+      const char *sep = g_utf8_prev_char (p);
+
+      if (is_hard_break (sep, end) && is_safe_seam (text, sep, p, end))
+        return p;
+
+      p = sep;
+    }
+
+  return text;
+}
+
+static void
+merge_seam (VogueLogAttr       *attr,
+            const VogueLogAttr *before)
+{
+  attr->is_line_break = before->is_line_break;
+  attr->is_mandatory_break = before->is_mandatory_break;
+  attr->is_char_break = before->is_char_break;
+  attr->is_cursor_position = before->is_cursor_position;
+  attr->backspace_deletes_character = before->backspace_deletes_character;
+  attr->is_word_boundary = before->is_word_boundary;
+  attr->is_word_end |= before->is_word_end;
+  attr->is_sentence_boundary = before->is_sentence_boundary;
+  attr->is_sentence_end |= before->is_sentence_end;
+}
+
+/**
+ * vogue_log_attrs_thread_pool_new:
+ * @max_threads: the maximal number of threads to use,
+ *     or -1 to use one thread per processor
+ *
+ * Creates a thread pool that can be passed to
+ * vogue_get_log_attrs_parallel(). The pool can be reused
+ * for any number of calls, and is freed with g_thread_pool_free().
+ *
+ * Return value: (transfer full): a new #GThreadPool
+ *
+ * Since: 1.46
+ */
+GThreadPool *
+vogue_log_attrs_thread_pool_new (int max_threads)
+{
+  if (max_threads < 0)
+    max_threads = g_get_num_processors ();
+
+  return g_thread_pool_new (break_task_func, NULL, max_threads, FALSE, NULL);
+}
+
+/**
+ * vogue_get_log_attrs_parallel:
+ * @text: text to process. Must be valid UTF-8
+ * @length: length in bytes of @text, or -1 if it is nul-terminated
+ * @level: embedding level, or -1 if unknown
+ * @language: language tag
+ * @flags: the groups of attributes to compute
+ * @log_attrs: (array length=attrs_len): array with one #VogueLogAttr
+ *   per character in @text, plus one extra, to be filled in
+ * @attrs_len: length of @log_attrs array
+ * @pool: (allow-none): a thread pool created with
+ *     vogue_log_attrs_thread_pool_new(), or %NULL
+ *
+ * Computes the same attributes as vogue_get_log_attrs_with_flags(),
+ * but when @pool is given and @text is large, the text is split
+ * after hard line breaks and the pieces are handled by the threads
+ * of the pool. The result is identical to that of the serial
+ * function.
+ *
+ * This is meant for bulk processing of long texts, such as
+ * finding word boundaries for indexing.
+ *
+ * Since: 1.46
+ */
+void
+vogue_get_log_attrs_parallel (const char        *text,
+                              int                length,
+                              int                level,
+                              VogueLanguage     *language,
+                              VogueLogAttrFlags  flags,
+                              VogueLogAttr      *log_attrs,
+                              int                attrs_len,
+                              GThreadPool       *pool)
+{
+  BreakBatch batch;
+  GArray *tasks;
+  const char *p, *end;
+  int chunk_length;
+  int n_threads;
+  int offset;
+  guint i;
+
+  g_return_if_fail (length == 0 || text != NULL);
+  g_return_if_fail (log_attrs != NULL);
+
+  if (length < 0)
+    length = strlen (text);
+
+  n_threads = pool ? g_thread_pool_get_max_threads (pool) : 1;
+  if (n_threads < 0)
+    n_threads = g_get_num_processors ();
+
+  if (pool == NULL || n_threads < 2 || length < 2 * MIN_CHUNK_LENGTH)
+    {
+      vogue_get_log_attrs_with_flags (text, length, level, language,
+                                      flags, log_attrs, attrs_len);
+      return;
+    }
+
+  /* A few chunks per thread, to even out the load */
+  chunk_length = MAX (MIN_CHUNK_LENGTH, length / (4 * n_threads));
+
+  tasks = g_array_new (FALSE, TRUE, sizeof (BreakTask));
+
+  end = text + length;
+  for (p = text; p < end; )
+    {
+      BreakTask task = { NULL, };
+      const char *chunk_end;
+
+      if (end - p <= chunk_length)
+        chunk_end = end;
+      else
+        chunk_end = find_chunk_end (text, p + chunk_length, end);
+
+      task.batch = &batch;
+      task.text = p;
+      task.length = chunk_end - p;
+      task.level = level;
+      task.flags = flags;
+      g_array_append_val (tasks, task);
+
+      p = chunk_end;
+    }
+
+  g_mutex_init (&batch.mutex);
+  g_cond_init (&batch.cond);
+  batch.pending = tasks->len;
+
+  for (i = 0; i < tasks->len; i++)
+    g_thread_pool_push (pool, &g_array_index (tasks, BreakTask, i), NULL);
+
+  g_mutex_lock (&batch.mutex);
+  while (batch.pending > 0)
+    g_cond_wait (&batch.cond, &batch.mutex);
+  g_mutex_unlock (&batch.mutex);
+
+  g_mutex_clear (&batch.mutex);
+  g_cond_clear (&batch.cond);
+
+  offset = 0;
+  for (i = 0; i < tasks->len; i++)
+    offset += g_array_index (tasks, BreakTask, i).n_chars;
+
+  if (offset + 1 > attrs_len)
+    {
+      g_warning ("vogue_get_log_attrs: attrs_len should have been at least %d, but was %d.",
+                 offset + 1,
+                 attrs_len);
+    }
+  else
+    {
+      offset = 0;
+      for (i = 0; i < tasks->len; i++)
+        {
+          BreakTask *task = &g_array_index (tasks, BreakTask, i);
+
+          memcpy (log_attrs + offset, task->attrs, sizeof (VogueLogAttr) * (task->n_chars + 1));
+
+          if (i + 1 < tasks->len)
+            {
+              BreakTask *next = &g_array_index (tasks, BreakTask, i + 1);
+
+              merge_seam (next->attrs, &task->attrs[task->n_chars]);
+            }
+
+          offset += task->n_chars;
+        }
+    }
+
+  for (i = 0; i < tasks->len; i++)
+    g_free (g_array_index (tasks, BreakTask, i).attrs);
+  g_array_free (tasks, TRUE);
+}
+
+/**
+ * vogue_log_attrs_update:
+ * @text: the text after the edit. Must be valid UTF-8
+ * @length: length in bytes of @text, or -1 if it is nul-terminated
+ * @level: embedding level, or -1 if unknown
+ * @language: language tag
+ * @edit_start: byte offset in @text at which the edit starts
+ * @edit_offset: character offset in @text at which the edit starts
+ * @n_removed: number of characters that the edit removed
+ * @new_length: number of bytes that the edit inserted
+ * @log_attrs: (array length=attrs_len): the attributes of the text
+ *   before the edit, as computed by vogue_get_log_attrs(); updated
+ *   in place to those of @text
+ * @attrs_len: length of the @log_attrs array. It must have room for
+ *   the attributes of both the old and the new text
+ * @n_attrs: (inout): the number of valid attributes in @log_attrs,
+ *   which is updated to the number of attributes of @text
+ *
+ * Updates the logical attributes of a text after @n_removed
+ * characters at @edit_start have been replaced by @new_length
+ * bytes. The result is the same as calling vogue_get_log_attrs()
+ * on @text.
+ *
+ * The granularity of the update is a paragraph: the text is broken
+ * again from the last hard line break before the edit to the first
+ * one after it. No smaller window is safe in general. Sentence
+ * boundaries, runs of regional indicators, spaces before a line
+ * break opportunity and the script-specific breakers (such as the
+ * dictionary-based one for Thai) all look arbitrarily far back or
+ * ahead within a paragraph, so an attribute that was a boundary
+ * before the edit does not guarantee that the text on both sides
+ * of it is broken the same way after it. Hard line breaks are the
+ * same seams that vogue_get_log_attrs_parallel() cuts at.
+ *
+ * The position of the edit is passed both in bytes and in
+ * characters, so that the text outside the paragraphs that the
+ * edit touches is never scanned, and @level and @language are the
+ * ones that vogue_get_log_attrs() takes. @attrs_len and @n_attrs
+ * let the caller keep one array for a text that grows and shrinks.
+ * The cost of an update is proportional to the length of the
+ * paragraphs that the edit touches, and to the shift of the
+ * attributes after them.
+ *
+ * Since: 1.46
+ */
+void
+vogue_log_attrs_update (const char    *text,
+                        int            length,
+                        int            level,
+                        VogueLanguage *language,
+                        int            edit_start,
+                        int            edit_offset,
+                        int            n_removed,
+                        int            new_length,
+                        VogueLogAttr  *log_attrs,
+                        int            attrs_len,
+                        int           *n_attrs)
+{
+  const char *end, *start, *stop, *edit_end;
+  VogueLogAttr *attrs;
+  VogueLogAttr before;
+  int start_pos, n_chars, n_tail;
+  int old_tail_pos;
+
+  g_return_if_fail (length == 0 || text != NULL);
+  g_return_if_fail (log_attrs != NULL);
+  g_return_if_fail (n_attrs != NULL && *n_attrs > 0);
+
+  if (length < 0)
+    length = strlen (text);
+
+  g_return_if_fail (edit_start >= 0 && edit_offset >= 0);
+  g_return_if_fail (n_removed >= 0 && new_length >= 0);
+  g_return_if_fail (edit_start + new_length <= length);
+
+  /* Keep the characters on both sides of each seam outside of
+   * the edit, so that what made the seam safe in the new text
+   * held in the old one too.
+   */
+  end = text + length;
+  start = text + edit_start;
+  if (start > text)
+    start = find_chunk_start (text, g_utf8_prev_char (start), end);
+  edit_end = text + edit_start + new_length;
+  stop = edit_end;
+  if (stop < end)
+    stop = find_chunk_end (text, g_utf8_next_char (stop), end);
+
+  start_pos = edit_offset - vogue_utf8_strlen (start, text + edit_start - start);
+  n_chars = vogue_utf8_strlen (start, stop - start);
+
+  /* The text after @stop is unchanged, and so are its attributes,
+   * apart from having moved. In the old text, it started after the
+   * removed characters and the unchanged ones up to @stop.
+   */
+  old_tail_pos = edit_offset + n_removed + vogue_utf8_strlen (edit_end, stop - edit_end);
+  n_tail = *n_attrs - 1 - old_tail_pos;
+
+  if (start_pos < 0 || n_tail < 0 ||
+      start_pos + n_chars + n_tail + 1 > attrs_len)
+    {
+      g_warning ("vogue_log_attrs_update: the attributes don't match the edit, or attrs_len is too small");
+      return;
+    }
+
+  before = log_attrs[start_pos];
+
+  memmove (log_attrs + start_pos + n_chars,
+           log_attrs + old_tail_pos,
+           sizeof (VogueLogAttr) * (n_tail + 1));
+
+  attrs = g_new (VogueLogAttr, n_chars + 1);
+  vogue_get_log_attrs_with_flags (start, stop - start, level, language,
+                                  PANGO_LOG_ATTR_ALL,
+                                  attrs, n_chars + 1);
+
+  if (start > text)
+    merge_seam (&attrs[0], &before);
+
+  if (stop < end)
+    merge_seam (&log_attrs[start_pos + n_chars], &attrs[n_chars]);
+  else
+    log_attrs[start_pos + n_chars] = attrs[n_chars];
+
+  memcpy (log_attrs + start_pos, attrs, sizeof (VogueLogAttr) * n_chars);
+
+  g_free (attrs);
+
+  *n_attrs = start_pos + n_chars + n_tail + 1;
+}
+
 #include "break-arabic.c"
 #include "break-indic.c"
 #include "break-thai.c"
@@ -1904,6 +2531,54 @@ break_script (const char          *item_text,
   return TRUE;
 }
 
+/* Moves the cursor (@p, @pos) forward to byte @index of @text,
+ * and returns the character offset of that position.
+ */
+static int
+advance_to_index (const char  *text,
+                  int          index,
+                  const char **p,
+                  int         *pos)
+{
+  while (*p < text + index)
+    {
+      *p = g_utf8_next_char (*p);
+      (*pos)++;
+    }
+
+  return *pos;
+}
+
+static int
+compare_start_index (gconstpointer a,
+                     gconstpointer b)
+{
+  const VogueAttribute *attr1 = *(const VogueAttribute * const *) a;
+  const VogueAttribute *attr2 = *(const VogueAttribute * const *) b;
+
+  if (attr1->start_index < attr2->start_index)
+    return -1;
+  else if (attr1->start_index > attr2->start_index)
+    return 1;
+  else
+    return 0;
+}
+
+static int
+compare_uints (gconstpointer a,
+               gconstpointer b)
+{
+  guint u1 = *(const guint *) a;
+  guint u2 = *(const guint *) b;
+
+  if (u1 < u2)
+    return -1;
+  else if (u1 > u2)
+    return 1;
+  else
+    return 0;
+}
+
 static gboolean
 break_attrs (const char   *text,
              int           length,
@@ -1912,51 +2587,100 @@ break_attrs (const char   *text,
              VogueLogAttr *log_attrs,
              int           log_attrs_len)
 {
-  VogueAttrList *list;
-  VogueAttrIterator *iter;
+  guint item_start = offset;
+  guint item_end = offset + length;
+  GPtrArray *allow_breaks;
+  GArray *boundaries;
+  VogueAttribute **stack;
+  guint n_stack = 0;
+  guint next_attr = 0;
+  const char *p = text;
+  int pos = 0;
   GSList *l;
+  guint k;
+
+  allow_breaks = g_ptr_array_new ();
+  boundaries = g_array_new (FALSE, FALSE, sizeof (guint));
 
-  list = vogue_attr_list_new ();
   for (l = attributes; l; l = l->next)
     {
       VogueAttribute *attr = l->data;
 
-      if (attr->klass->type == PANGO_ATTR_ALLOW_BREAKS)
-        vogue_attr_list_insert (list, vogue_attribute_copy (attr));
+      if (attr->klass->type != PANGO_ATTR_ALLOW_BREAKS)
+        continue;
+
+      g_ptr_array_add (allow_breaks, attr);
+      g_array_append_val (boundaries, attr->start_index);
+      if (attr->end_index > attr->start_index)
+        g_array_append_val (boundaries, attr->end_index);
     }
 
-  iter = vogue_attr_list_get_iterator (list);
-  do {
-    VogueAttribute *attr;
+  if (allow_breaks->len == 0)
+    goto out;
 
-    attr = vogue_attr_iterator_get (iter, PANGO_ATTR_ALLOW_BREAKS);
-    if (attr && ((VogueAttrInt*)attr)->value == 0)
-      {
-        int start, end;
-        int start_pos, end_pos;
-        int pos;
-
-        vogue_attr_iterator_range (iter, &start, &end);
-        if (start < offset)
-          start_pos = 0;
-        else
-          start_pos = g_utf8_pointer_to_offset (text, text + start - offset);
-        if (end >= offset + length)
-          end_pos = log_attrs_len;
-        else
-          end_pos = g_utf8_pointer_to_offset (text, text + end - offset);
-
-        for (pos = start_pos + 1; pos < end_pos; pos++)
-          {
-            log_attrs[pos].is_mandatory_break = FALSE;
-            log_attrs[pos].is_line_break = FALSE;
-            log_attrs[pos].is_char_break = FALSE;
-          }
-      }
-  } while (vogue_attr_iterator_next (iter));
+  /* g_ptr_array_sort() is stable, so among the attributes that start
+   * at the same index, the one that comes last in @attributes is also
+   * last here, and is the one in effect, like with an attribute iterator.
+   */
+  g_ptr_array_sort (allow_breaks, compare_start_index);
+  g_array_sort (boundaries, compare_uints);
+
+  /* Sweep the segments between the boundaries in order. Attributes
+   * are pushed on @stack in the order above as their ranges begin, so
+   * once the ones that have ended are popped from the top, the top is
+   * the attribute in effect. Byte offsets are converted with a cursor
+   * that only moves forward.
+   */
+  stack = g_new (VogueAttribute *, allow_breaks->len);
+
+  for (k = 0; k + 1 < boundaries->len; k++)
+    {
+      guint start = g_array_index (boundaries, guint, k);
+      guint end = g_array_index (boundaries, guint, k + 1);
+      VogueAttribute *attr;
+
+      if (start >= item_end)
+        break;
+
+      while (next_attr < allow_breaks->len &&
+             ((VogueAttribute *) g_ptr_array_index (allow_breaks, next_attr))->start_index <= start)
+        stack[n_stack++] = g_ptr_array_index (allow_breaks, next_attr++);
+
+      while (n_stack > 0 && stack[n_stack - 1]->end_index <= start)
+        n_stack--;
+
+      if (start == end || n_stack == 0)
+        continue;
+
+      attr = stack[n_stack - 1];
+      if (((VogueAttrInt*)attr)->value == 0 && end > item_start)
+        {
+          int start_pos, end_pos;
+          int i;
+
+          if (start < item_start)
+            start_pos = 0;
+          else
+            start_pos = advance_to_index (text, start - offset, &p, &pos);
+          if (end >= item_end)
+            end_pos = log_attrs_len;
+          else
+            end_pos = advance_to_index (text, end - offset, &p, &pos);
+
+          for (i = start_pos + 1; i < end_pos; i++)
+            {
+              log_attrs[i].is_mandatory_break = FALSE;
+              log_attrs[i].is_line_break = FALSE;
+              log_attrs[i].is_char_break = FALSE;
+            }
+        }
+    }
+
+  g_free (stack);
 
-  vogue_attr_iterator_destroy (iter);
-  vogue_attr_list_unref (list);
+out:
+  g_ptr_array_free (allow_breaks, TRUE);
+  g_array_free (boundaries, TRUE);
 
   return TRUE;
 }
@@ -44,7 +44,7 @@
 
 struct _VogueFontDescription
 {
-  char *family_name;
+  char *family_name;		/* an interned GRefString, unless static_family */
 
   VogueStyle style;
   VogueVariant variant;
@@ -60,6 +60,13 @@ struct _VogueFontDescription
   guint size_is_absolute : 1;
 
   int size;
+
+  /* Computed when first needed, see get_family_key(); each holds
+   * a reference on an interned GRefString.
+   */
+  const char *family_key;
+  const char *variations_key;
+  guint hash;			/* 0 if not computed yet */
 };
 
 G_DEFINE_BOXED_TYPE (VogueFontDescription, vogue_font_description,
@@ -82,8 +89,124 @@ static const VogueFontDescription pfd_defaults = {
   0,    		/* size_is_absolute */
 
   0,			/* size */
+
+  NULL,			/* family_key */
+  NULL,			/* variations_key */
+  0,			/* hash */
 };
 
+/* Forgets the cached hash after a field has changed */
+static inline void
+desc_changed (VogueFontDescription *desc)
+{
+  desc->hash = 0;
+}
+
+static inline const char *
+key_acquire (const char *key)
+{
+  return key ? g_ref_string_acquire ((char *) key) : NULL;
+}
+
+static inline void
+key_release (const char *key)
+{
+  if (key)
+    g_ref_string_release ((char *) key);
+}
+
+/* Stores @key, which the caller owns a reference on, unless another
+ * thread got there first. Both threads interned the same string, so
+ * either one can be returned; ours is released.
+ */
+static const char *
+key_store (const char **location,
+           const char  *key)
+{
+  const char *stored;
+
+  if (g_atomic_pointer_compare_and_exchange (location, NULL, key))
+    return key;
+
+  stored = g_atomic_pointer_get (location);
+  key_release (key);
+
+  return stored;
+}
+
+static const char *
+intern_ascii_folded (const char *str)
+{
+  char buf[64];
+  char *folded;
+  const char *result;
+  gsize len, i;
+
+  len = strlen (str);
+  folded = len < sizeof (buf) ? buf : g_malloc (len + 1);
+
+  for (i = 0; i < len; i++)
+    folded[i] = g_ascii_tolower (str[i]);
+  folded[len] = '\0';
+
+  result = g_ref_string_new_intern (folded);
+
+  if (folded != buf)
+    g_free (folded);
+
+  return result;
+}
+
+/* Returns the family name as an interned, ASCII-lowercased string,
+ * so that families can be compared by pointer the way
+ * vogue_font_description_equal() compares them with
+ * g_ascii_strcasecmp(). It is computed once and then kept in @desc,
+ * which holds a reference on it until the family changes or @desc
+ * is freed. The write is atomic because const descriptions may be
+ * shared between threads.
+ */
+static const char *
+get_family_key (const VogueFontDescription *desc)
+{
+  VogueFontDescription *mutable_desc = (VogueFontDescription *) desc;
+  const char *key;
+
+  if (desc->family_name == NULL)
+    return NULL;
+
+  key = g_atomic_pointer_get (&mutable_desc->family_key);
+  if (key == NULL)
+    key = key_store (&mutable_desc->family_key,
+                     intern_ascii_folded (desc->family_name));
+
+  return key;
+}
+
+/* Gets the variations of @desc as an interned string, so that they
+ * can be compared and hashed by pointer. The string is owned by @desc
+ * and stays valid until its variations change or it is freed; callers
+ * that keep it longer take their own reference with
+ * g_ref_string_acquire().
+ */
+const char *
+vogue_font_description_get_variations_key (const VogueFontDescription *desc)
+{
+  VogueFontDescription *mutable_desc = (VogueFontDescription *) desc;
+  const char *key;
+
+  g_return_val_if_fail (desc != NULL, NULL);
+
+  if (desc->variations == NULL)
+    return NULL;
+
+  key = g_atomic_pointer_get (&mutable_desc->variations_key);
+  if (key == NULL)
+    key = key_store (&mutable_desc->variations_key,
+                     g_ref_string_new_intern (desc->variations));
+
+  return key;
+}
+
 /**
  * vogue_font_description_new:
  *
@@ -117,11 +240,32 @@ void
 vogue_font_description_set_family (VogueFontDescription *desc,
 				   const char           *family)
 {
+  char *interned;
+
   g_return_if_fail (desc != NULL);
 
-  vogue_font_description_set_family_static (desc, family ? g_strdup (family) : NULL);
-  if (family)
-    desc->static_family = FALSE;
+  if (!family)
+    {
+      vogue_font_description_set_family_static (desc, NULL);
+      return;
+    }
+
+  /* Family names are interned, so that copies of a description,
+   * such as those in font description attributes, share them.
+   */
+  interned = g_ref_string_new_intern (family);
+
+  if (desc->family_name == interned)
+    {
+      if (desc->static_family)
+        desc->static_family = FALSE;
+      else
+        g_ref_string_release (interned);
+      return;
+    }
+
+  vogue_font_description_set_family_static (desc, interned);
+  desc->static_family = FALSE;
 }
 
 /**
@@ -146,7 +290,11 @@ vogue_font_description_set_family_static (VogueFontDescription *desc,
     return;
 
   if (desc->family_name && !desc->static_family)
-    g_free (desc->family_name);
+    g_ref_string_release (desc->family_name);
+
+  key_release (desc->family_key);
+  desc->family_key = NULL;
+  desc_changed (desc);
 
   if (family)
     {
@@ -204,6 +352,7 @@ vogue_font_description_set_style (VogueFontDescription *desc,
 
   desc->style = style;
   desc->mask |= PANGO_FONT_MASK_STYLE;
+  desc_changed (desc);
 }
 
 /**
@@ -241,6 +390,7 @@ vogue_font_description_set_variant (VogueFontDescription *desc,
 
   desc->variant = variant;
   desc->mask |= PANGO_FONT_MASK_VARIANT;
+  desc_changed (desc);
 }
 
 /**
@@ -280,6 +430,7 @@ vogue_font_description_set_weight (VogueFontDescription *desc,
 
   desc->weight = weight;
   desc->mask |= PANGO_FONT_MASK_WEIGHT;
+  desc_changed (desc);
 }
 
 /**
@@ -317,6 +468,7 @@ vogue_font_description_set_stretch (VogueFontDescription *desc,
 
   desc->stretch = stretch;
   desc->mask |= PANGO_FONT_MASK_STRETCH;
+  desc_changed (desc);
 }
 
 /**
@@ -362,6 +514,7 @@ vogue_font_description_set_size (VogueFontDescription *desc,
   desc->size = size;
   desc->size_is_absolute = FALSE;
   desc->mask |= PANGO_FONT_MASK_SIZE;
+  desc_changed (desc);
 }
 
 /**
@@ -409,6 +562,7 @@ vogue_font_description_set_absolute_size (VogueFontDescription *desc,
   desc->size = size;
   desc->size_is_absolute = TRUE;
   desc->mask |= PANGO_FONT_MASK_SIZE;
+  desc_changed (desc);
 }
 
 /**
@@ -461,6 +615,7 @@ vogue_font_description_set_gravity (VogueFontDescription *desc,
 
   desc->gravity = gravity;
   desc->mask |= PANGO_FONT_MASK_GRAVITY;
+  desc_changed (desc);
 }
 
 /**
@@ -510,6 +665,10 @@ vogue_font_description_set_variations_static (VogueFontDescription *desc,
   if (desc->variations && !desc->static_variations)
     g_free (desc->variations);
 
+  key_release (desc->variations_key);
+  desc->variations_key = NULL;
+  desc_changed (desc);
+
   if (variations)
     {
       desc->variations = (char *)variations;
@@ -652,7 +811,7 @@ vogue_font_description_merge (VogueFontDescription       *desc,
 
   if (family_merged)
     {
-      desc->family_name = g_strdup (desc->family_name);
+      desc->family_name = g_ref_string_new_intern (desc->family_name);
       desc->static_family = FALSE;
     }
 
@@ -681,7 +840,9 @@ vogue_font_description_merge_static (VogueFontDescription       *desc,
 				     const VogueFontDescription *desc_to_merge,
 				     gboolean                    replace_existing)
 {
+  VogueFontDescription *mutable_merge = (VogueFontDescription *) desc_to_merge;
   VogueFontMask new_mask;
+  const char *key;
 
   g_return_if_fail (desc != NULL);
   g_return_if_fail (desc_to_merge != NULL);
@@ -692,7 +853,15 @@ vogue_font_description_merge_static (VogueFontDescription       *desc,
     new_mask = desc_to_merge->mask & ~desc->mask;
 
   if (new_mask & PANGO_FONT_MASK_FAMILY)
-    vogue_font_description_set_family_static (desc, desc_to_merge->family_name);
+    {
+      vogue_font_description_set_family_static (desc, desc_to_merge->family_name);
+      key = key_acquire (g_atomic_pointer_get (&mutable_merge->family_key));
+      if (key)
+        {
+          key_release (desc->family_key);
+          desc->family_key = key;
+        }
+    }
   if (new_mask & PANGO_FONT_MASK_STYLE)
     desc->style = desc_to_merge->style;
   if (new_mask & PANGO_FONT_MASK_VARIANT)
@@ -709,9 +878,18 @@ vogue_font_description_merge_static (VogueFontDescription       *desc,
   if (new_mask & PANGO_FONT_MASK_GRAVITY)
     desc->gravity = desc_to_merge->gravity;
   if (new_mask & PANGO_FONT_MASK_VARIATIONS)
-    vogue_font_description_set_variations_static (desc, desc_to_merge->variations);
+    {
+      vogue_font_description_set_variations_static (desc, desc_to_merge->variations);
+      key = key_acquire (g_atomic_pointer_get (&mutable_merge->variations_key));
+      if (key)
+        {
+          key_release (desc->variations_key);
+          desc->variations_key = key;
+        }
+    }
 
   desc->mask |= new_mask;
+  desc_changed (desc);
 }
 
 static gint
@@ -800,13 +978,19 @@ vogue_font_description_copy  (const VogueFontDescription  *desc)
 
   if (result->family_name)
     {
-      result->family_name = g_strdup (result->family_name);
+      if (desc->static_family)
+        result->family_name = g_ref_string_new_intern (result->family_name);
+      else
+        result->family_name = g_ref_string_acquire (result->family_name);
       result->static_family = FALSE;
     }
 
   result->variations = g_strdup (result->variations);
   result->static_variations = FALSE;
 
+  result->family_key = key_acquire (g_atomic_pointer_get (&((VogueFontDescription *) desc)->family_key));
+  result->variations_key = key_acquire (g_atomic_pointer_get (&((VogueFontDescription *) desc)->variations_key));
+
   return result;
 }
 
@@ -842,6 +1026,9 @@ vogue_font_description_copy_static (const VogueFontDescription *desc)
   if (result->variations)
     result->static_variations = TRUE;
 
+  result->family_key = key_acquire (g_atomic_pointer_get (&((VogueFontDescription *) desc)->family_key));
+  result->variations_key = key_acquire (g_atomic_pointer_get (&((VogueFontDescription *) desc)->variations_key));
+
   return result;
 }
 
@@ -863,9 +1050,17 @@ gboolean
 vogue_font_description_equal (const VogueFontDescription  *desc1,
 			      const VogueFontDescription  *desc2)
 {
+  guint hash1, hash2;
+
   g_return_val_if_fail (desc1 != NULL, FALSE);
   g_return_val_if_fail (desc2 != NULL, FALSE);
 
+  /* Cached hashes that differ tell the descriptions apart for free */
+  hash1 = g_atomic_int_get (&((VogueFontDescription *) desc1)->hash);
+  hash2 = g_atomic_int_get (&((VogueFontDescription *) desc2)->hash);
+  if (hash1 != 0 && hash2 != 0 && hash1 != hash2)
+    return FALSE;
+
   return desc1->style == desc2->style &&
 	 desc1->variant == desc2->variant &&
 	 desc1->weight == desc2->weight &&
@@ -873,27 +1068,8 @@ vogue_font_description_equal (const VogueFontDescription  *desc1,
 	 desc1->size == desc2->size &&
 	 desc1->size_is_absolute == desc2->size_is_absolute &&
 	 desc1->gravity == desc2->gravity &&
-	 (desc1->family_name == desc2->family_name ||
-	  (desc1->family_name && desc2->family_name && g_ascii_strcasecmp (desc1->family_name, desc2->family_name) == 0)) &&
-         (g_strcmp0 (desc1->variations, desc2->variations) == 0);
-}
-
-#define TOLOWER(c) \
-  (((c) >= 'A' && (c) <= 'Z') ? (c) - 'A' + 'a' : (c))
-
-static guint
-case_insensitive_hash (const char *key)
-{
-  const char *p = key;
-  guint h = TOLOWER (*p);
-
-  if (h)
-    {
-      for (p += 1; *p != '\0'; p++)
-	h = (h << 5) - h + TOLOWER (*p);
-    }
-
-  return h;
+	 get_family_key (desc1) == get_family_key (desc2) &&
+	 vogue_font_description_get_variations_key (desc1) == vogue_font_description_get_variations_key (desc2);
 }
 
 /**
@@ -909,14 +1085,20 @@ case_insensitive_hash (const char *key)
 guint
 vogue_font_description_hash (const VogueFontDescription *desc)
 {
-  guint hash = 0;
+  VogueFontDescription *mutable_desc = (VogueFontDescription *) desc;
+  guint hash;
 
   g_return_val_if_fail (desc != NULL, 0);
 
-  if (desc->family_name)
-    hash = case_insensitive_hash (desc->family_name);
-  if (desc->variations)
-    hash ^= g_str_hash (desc->variations);
+  hash = g_atomic_int_get (&mutable_desc->hash);
+  if (hash != 0)
+    return hash;
+
+  /* The interned strings stand for the family and variations, so
+   * their addresses can be hashed instead of their contents.
+   */
+  hash = GPOINTER_TO_UINT (get_family_key (desc)) * 2654435761u;
+  hash ^= GPOINTER_TO_UINT (vogue_font_description_get_variations_key (desc)) * 40503u;
   hash ^= desc->size;
   hash ^= desc->size_is_absolute ? 0xc33ca55a : 0;
   hash ^= desc->style << 16;
@@ -925,6 +1107,12 @@ vogue_font_description_hash (const VogueFontDescription *desc)
   hash ^= desc->stretch << 26;
   hash ^= desc->gravity << 28;
 
+  /* 0 means that the hash has not been computed */
+  if (hash == 0)
+    hash = 1;
+
+  g_atomic_int_set (&mutable_desc->hash, hash);
+
   return hash;
 }
 
@@ -941,11 +1129,14 @@ vogue_font_description_free  (VogueFontDescription  *desc)
     return;
 
   if (desc->family_name && !desc->static_family)
-    g_free (desc->family_name);
+    g_ref_string_release (desc->family_name);
 
   if (desc->variations && !desc->static_variations)
     g_free (desc->variations);
 
+  key_release (desc->family_key);
+  key_release (desc->variations_key);
+
   g_slice_free (VogueFontDescription, desc);
 }
 
@@ -1333,22 +1524,26 @@ vogue_font_description_from_string (const char *str)
   if (str != last)
     {
       int i;
+      char *family;
       char **families;
 
-      desc->family_name = g_strndup (str, last - str);
+      family = g_strndup (str, last - str);
 
       /* Now sanitize it to trim space from around individual family names.
        * bug #499624 */
 
-      families = g_strsplit (desc->family_name, ",", -1);
+      families = g_strsplit (family, ",", -1);
 
       for (i = 0; families[i]; i++)
 	g_strstrip (families[i]);
 
-      g_free (desc->family_name);
-      desc->family_name = g_strjoinv (",", families);
+      g_free (family);
+      family = g_strjoinv (",", families);
       g_strfreev (families);
 
+      desc->family_name = g_ref_string_new_intern (family);
+      g_free (family);
+
       desc->mask |= PANGO_FONT_MASK_FAMILY;
     }
 
@@ -1647,10 +1842,25 @@ vogue_parse_stretch (const char   *str,
  * VogueFont
  */
 
+/* Horizontal advances of the glyphs of the hb_font, indexed
+ * by glyph id. Entries are filled in lazily and hold
+ * ADVANCE_UNSET until then.
+ */
+typedef struct {
+  guint n_glyphs;
+  int advances[1];
+} VogueAdvanceCache;
+
+#define ADVANCE_UNSET G_MININT
+
 typedef struct {
   hb_font_t *hb_font;
+  VogueAdvanceCache *advance_cache;
+  GHashTable *unknown_advances;
 } VogueFontPrivate;
 
+G_LOCK_DEFINE_STATIC (unknown_advances);
+
 G_DEFINE_ABSTRACT_TYPE_WITH_PRIVATE (VogueFont, vogue_font, G_TYPE_OBJECT)
 
 static void
@@ -1660,6 +1870,9 @@ vogue_font_finalize (GObject *object)
   VogueFontPrivate *priv = vogue_font_get_instance_private (font);
 
   hb_font_destroy (priv->hb_font);
+  g_free (priv->advance_cache);
+  if (priv->unknown_advances)
+    g_hash_table_unref (priv->unknown_advances);
 
   G_OBJECT_CLASS (vogue_font_parent_class)->finalize (object);
 }
@@ -1899,17 +2112,192 @@ hb_font_t *
 vogue_font_get_hb_font (VogueFont *font)
 {
   VogueFontPrivate *priv = vogue_font_get_instance_private (font);
+  hb_font_t *hb_font;
 
   g_return_val_if_fail (PANGO_IS_FONT (font), NULL);
 
-  if (priv->hb_font)
-    return priv->hb_font;
+  hb_font = g_atomic_pointer_get (&priv->hb_font);
+  if (G_LIKELY (hb_font))
+    return hb_font;
+
+  hb_font = PANGO_FONT_GET_CLASS (font)->create_hb_font (font);
+
+  hb_font_make_immutable (hb_font);
+
+  /* Another thread may have beaten us to it; if so, use theirs */
+  if (!g_atomic_pointer_compare_and_exchange (&priv->hb_font, NULL, hb_font))
+    {
+      hb_font_destroy (hb_font);
+      hb_font = g_atomic_pointer_get (&priv->hb_font);
+    }
+
+  return hb_font;
+}
+
+static VogueAdvanceCache *
+get_advance_cache (VogueFont *font,
+                   hb_font_t *hb_font)
+{
+  VogueFontPrivate *priv = vogue_font_get_instance_private (font);
+  VogueAdvanceCache *cache;
+  guint n_glyphs, i;
+
+  cache = g_atomic_pointer_get (&priv->advance_cache);
+  if (G_LIKELY (cache))
+    return cache;
+
+  n_glyphs = hb_face_get_glyph_count (hb_font_get_face (hb_font));
+
+  cache = g_malloc (sizeof (VogueAdvanceCache) + MAX (n_glyphs, 1) * sizeof (int));
+  cache->n_glyphs = n_glyphs;
+  for (i = 0; i < n_glyphs; i++)
+    cache->advances[i] = ADVANCE_UNSET;
+
+  if (!g_atomic_pointer_compare_and_exchange (&priv->advance_cache, NULL, cache))
+    {
+      g_free (cache);
+      cache = g_atomic_pointer_get (&priv->advance_cache);
+    }
+
+  return cache;
+}
+
+static int
+get_unknown_glyph_advance (VogueFont  *font,
+                           VogueGlyph  glyph)
+{
+  VogueFontPrivate *priv = vogue_font_get_instance_private (font);
+  VogueRectangle logical_rect;
+  gpointer value;
+  gboolean found;
+
+  G_LOCK (unknown_advances);
+  found = priv->unknown_advances &&
+          g_hash_table_lookup_extended (priv->unknown_advances, GUINT_TO_POINTER (glyph), NULL, &value);
+  G_UNLOCK (unknown_advances);
+
+  if (found)
+    return GPOINTER_TO_INT (value);
+
+  vogue_font_get_glyph_extents (font, glyph, NULL, &logical_rect);
 
-  priv->hb_font = PANGO_FONT_GET_CLASS (font)->create_hb_font (font);
+  G_LOCK (unknown_advances);
+  if (!priv->unknown_advances)
+    priv->unknown_advances = g_hash_table_new (NULL, NULL);
+  g_hash_table_insert (priv->unknown_advances, GUINT_TO_POINTER (glyph), GINT_TO_POINTER (logical_rect.width));
+  G_UNLOCK (unknown_advances);
+
+  return logical_rect.width;
+}
+
+/**
+ * vogue_font_get_glyph_advances:
+ * @font: (nullable): a #VogueFont
+ * @glyphs: (array length=n_glyphs): the glyphs to look up
+ * @n_glyphs: the number of glyphs in @glyphs
+ * @advances: (out caller-allocates) (array length=n_glyphs): return
+ *     location for the horizontal advances of @glyphs
+ *
+ * Gets the horizontal advances of a number of glyphs at once,
+ * in 1/PANGO_SCALE of a device unit.
+ *
+ * The advances are taken from the font's hb_font_t and cached
+ * per font, so repeated queries for the same glyphs are cheap.
+ * Unknown glyphs (see PANGO_GET_UNKNOWN_GLYPH()) are measured
+ * with vogue_font_get_glyph_extents(), and %PANGO_GLYPH_EMPTY
+ * has zero width.
+ *
+ * If @font is %NULL, the advances are the same fallback values
+ * that vogue_font_get_glyph_extents() uses.
+ *
+ * This function is thread-safe.
+ *
+ * Since: 1.46
+ */
+void
+vogue_font_get_glyph_advances (VogueFont        *font,
+                               const VogueGlyph *glyphs,
+                               guint             n_glyphs,
+                               int              *advances)
+{
+  hb_font_t *hb_font;
+  VogueAdvanceCache *cache;
+  hb_codepoint_t missing[64];
+  hb_position_t missing_advances[64];
+  guint missing_index[64];
+  guint n_missing = 0;
+  guint i, j;
+
+  g_return_if_fail (n_glyphs == 0 || (glyphs != NULL && advances != NULL));
+
+  if (G_UNLIKELY (!font))
+    {
+      for (i = 0; i < n_glyphs; i++)
+        advances[i] = PANGO_UNKNOWN_GLYPH_WIDTH * PANGO_SCALE;
+      return;
+    }
+
+  hb_font = vogue_font_get_hb_font (font);
+  cache = get_advance_cache (font, hb_font);
+
+  for (i = 0; i < n_glyphs; i++)
+    {
+      VogueGlyph glyph = glyphs[i];
+
+      if (glyph == PANGO_GLYPH_EMPTY)
+        advances[i] = 0;
+      else if (glyph & PANGO_GLYPH_UNKNOWN_FLAG)
+        advances[i] = get_unknown_glyph_advance (font, glyph);
+      else if (glyph < cache->n_glyphs)
+        {
+          advances[i] = g_atomic_int_get (&cache->advances[glyph]);
+          if (advances[i] == ADVANCE_UNSET)
+            {
+              missing[n_missing] = glyph;
+              missing_index[n_missing] = i;
+              n_missing++;
+            }
+        }
+      else
+        advances[i] = hb_font_get_glyph_h_advance (hb_font, glyph);
+
+      if (n_missing == G_N_ELEMENTS (missing) || (n_missing > 0 && i + 1 == n_glyphs))
+        {
+          hb_font_get_glyph_h_advances (hb_font, n_missing,
+                                        missing, sizeof (hb_codepoint_t),
+                                        missing_advances, sizeof (hb_position_t));
+          for (j = 0; j < n_missing; j++)
+            {
+              advances[missing_index[j]] = missing_advances[j];
+              /* Racing threads store the same value */
+              g_atomic_int_set (&cache->advances[missing[j]], missing_advances[j]);
+            }
+          n_missing = 0;
+        }
+    }
+}
+
+/**
+ * vogue_font_get_glyph_advance:
+ * @font: (nullable): a #VogueFont
+ * @glyph: the glyph index
+ *
+ * Gets the horizontal advance of a single glyph. See
+ * vogue_font_get_glyph_advances() for details.
+ *
+ * Return value: the advance of @glyph, in 1/PANGO_SCALE of a device unit
+ *
+ * Since: 1.46
+ */
+int
+vogue_font_get_glyph_advance (VogueFont  *font,
+                              VogueGlyph  glyph)
+{
+  int advance;
 
-  hb_font_make_immutable (priv->hb_font);
+  vogue_font_get_glyph_advances (font, &glyph, 1, &advance);
 
-  return priv->hb_font;
+  return advance;
 }
 
 G_DEFINE_BOXED_TYPE (VogueFontMetrics, vogue_font_metrics,
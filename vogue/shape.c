@@ -293,3 +293,177 @@ vogue_shape_with_flags (const gchar         *item_text,
         }
     }
 }
+
+typedef struct
+{
+  GMutex mutex;
+  GCond cond;
+  guint pending;
+} ShapeBatch;
+
+typedef struct
+{
+  ShapeBatch *batch;
+  const char *text;
+  int length;
+  VogueItem *item;
+  VogueGlyphString *glyphs;
+  VogueShapeFlags flags;
+} ShapeTask;
+
+static void
+shape_item (const char       *text,
+            int               length,
+            VogueItem        *item,
+            VogueGlyphString *glyphs,
+            VogueShapeFlags   flags)
+{
+  vogue_shape_with_flags (text + item->offset, item->length,
+                          text, length,
+                          &item->analysis,
+                          glyphs,
+                          flags);
+}
+
+static void
+shape_task_func (gpointer data,
+                 gpointer user_data G_GNUC_UNUSED)
+{
+  ShapeTask *task = data;
+  ShapeBatch *batch = task->batch;
+
+  shape_item (task->text, task->length, task->item, task->glyphs, task->flags);
+
+  g_mutex_lock (&batch->mutex);
+  if (--batch->pending == 0)
+    g_cond_signal (&batch->cond);
+  g_mutex_unlock (&batch->mutex);
+}
+
+/**
+ * vogue_shape_thread_pool_new:
+ * @max_threads: the maximal number of threads to use,
+ *     or -1 to use one thread per processor
+ *
+ * Creates a thread pool that can be passed to vogue_shape_items()
+ * to shape independent items concurrently. The pool can be reused
+ * for any number of calls, and is freed with g_thread_pool_free().
+ *
+ * Return value: (transfer full): a new #GThreadPool
+ *
+ * Since: 1.46
+ */
+GThreadPool *
+vogue_shape_thread_pool_new (int max_threads)
+{
+  if (max_threads < 0)
+    max_threads = g_get_num_processors ();
+
+  return g_thread_pool_new (shape_task_func, NULL, max_threads, FALSE, NULL);
+}
+
+/**
+ * vogue_shape_items:
+ * @items: (array length=n_items): the items to shape, as
+ *     returned by vogue_itemize()
+ * @n_items: the number of items in @items
+ * @text: the paragraph text that the offsets of @items refer to
+ * @length: the length (in bytes) of @text. -1 means nul-terminated text.
+ * @glyphs: (array length=n_items): glyph strings in which to
+ *     store the results, one per item
+ * @flags: flags influencing the shaping process
+ * @pool: (allow-none): a thread pool created with
+ *     vogue_shape_thread_pool_new(), or %NULL
+ *
+ * Shapes a list of items in one call. This is equivalent to calling
+ * vogue_shape_with_flags() for each item with @text as paragraph
+ * text, but when @pool is given, the items are distributed over
+ * the threads of the pool and shaped concurrently. This pays off
+ * for paragraphs that are split into many items by script or font
+ * changes.
+ *
+ * The fonts of all items are prepared in the calling thread
+ * before any work is handed out: their HarfBuzz fonts are created
+ * and the state needed to measure missing glyphs is set up, since
+ * that may load further fonts from the font map, which is not
+ * thread-safe. The glyph extents caches that the pool threads
+ * still fill in while shaping are protected by the font backends.
+ *
+ * This function returns once all items have been shaped.
+ *
+ * Since: 1.46
+ */
+void
+vogue_shape_items (VogueItem         **items,
+                   guint               n_items,
+                   const char         *text,
+                   int                 length,
+                   VogueGlyphString  **glyphs,
+                   VogueShapeFlags     flags,
+                   GThreadPool        *pool)
+{
+  ShapeBatch batch;
+  ShapeTask *tasks;
+  VogueFont *last_font = NULL;
+  guint i;
+
+  g_return_if_fail (n_items == 0 || items != NULL);
+  g_return_if_fail (n_items == 0 || glyphs != NULL);
+  g_return_if_fail (text != NULL || n_items == 0);
+
+  if (n_items == 0)
+    return;
+
+  if (length == -1)
+    length = strlen (text);
+
+  if (pool == NULL || n_items == 1)
+    {
+      for (i = 0; i < n_items; i++)
+        shape_item (text, length, items[i], glyphs[i], flags);
+      return;
+    }
+
+  /* Warm up every font used, so that the hb_font is created here
+   * rather than raced for in the worker threads. Measuring a missing
+   * glyph makes the cairo fonts load the mini font they draw hex
+   * boxes with, which goes through the (unlocked) font map.
+   */
+  for (i = 0; i < n_items; i++)
+    {
+      VogueFont *font = items[i]->analysis.font;
+
+      if (font && font != last_font)
+        {
+          vogue_font_get_hb_font (font);
+          vogue_font_get_glyph_extents (font, PANGO_GET_UNKNOWN_GLYPH (0xFFFD), NULL, NULL);
+          last_font = font;
+        }
+    }
+
+  g_mutex_init (&batch.mutex);
+  g_cond_init (&batch.cond);
+  batch.pending = n_items;
+
+  tasks = g_new (ShapeTask, n_items);
+  for (i = 0; i < n_items; i++)
+    {
+      tasks[i].batch = &batch;
+      tasks[i].text = text;
+      tasks[i].length = length;
+      tasks[i].item = items[i];
+      tasks[i].glyphs = glyphs[i];
+      tasks[i].flags = flags;
+
+      g_thread_pool_push (pool, &tasks[i], NULL);
+    }
+
+  g_mutex_lock (&batch.mutex);
+  while (batch.pending > 0)
+    g_cond_wait (&batch.cond, &batch.mutex);
+  g_mutex_unlock (&batch.mutex);
+
+  g_free (tasks);
+  g_mutex_clear (&batch.mutex);
+  g_cond_clear (&batch.cond);
+}
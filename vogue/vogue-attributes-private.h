@@ -0,0 +1,45 @@
+/* Vogue
+ * vogue-attributes-private.h: Attributed text, private definitions
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.	 See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+#ifndef __PANGO_ATTRIBUTES_PRIVATE_H__
+#define __PANGO_ATTRIBUTES_PRIVATE_H__
+
+#include <vogue/vogue-attributes.h>
+
+G_BEGIN_DECLS
+
+/* Selects attributes of @type in a type mask. All types past
+ * the first 63 share the last bit.
+ */
+#define PANGO_ATTR_TYPE_MASK(type) \
+  ((guint) (type) < 63 ? G_GUINT64_CONSTANT (1) << (type) : G_GUINT64_CONSTANT (1) << 63)
+
+/* Returns a list that shares the attributes of @prefix and @list
+ * whose types are in @type_mask, or %NULL if there are none. The
+ * view does not own its attributes; they must outlive it, and it
+ * must not be modified.
+ */
+VogueAttrList *_vogue_attr_list_new_view (VogueAttrList   *list,
+                                          VogueAttribute **prefix,
+                                          guint            n_prefix,
+                                          guint64          type_mask);
+
+G_END_DECLS
+
+#endif /* __PANGO_ATTRIBUTES_PRIVATE_H__ */
@@ -34,23 +34,49 @@
 #include <string.h>
 
 #include "vogue-attributes.h"
+#include "vogue-attributes-private.h"
 #include "vogue-impl-utils.h"
 
 struct _VogueAttrList
 {
   guint ref_count;
-  GSList *attributes;
-  GSList *attributes_tail;
+  GPtrArray *attributes;	/* sorted by start_index */
+  GArray *pending;		/* PendingAttr inserted out of order, or NULL */
+  guint *end_tree;		/* largest end_index over ranges of attributes */
+  guint end_tree_size;		/* number of leaves in end_tree */
+  guint end_tree_valid;		/* number of up-to-date leaves */
+  guint end_tree_len;		/* number of leaves that may be nonzero */
+  guint borrowed : 1;		/* whether the attributes belong to someone else */
+  int *shared;			/* number of lists sharing attributes, or NULL */
 };
 
+/* An attribute that vogue_attr_list_insert() has not put in
+ * place yet. @key orders it among the attributes with the same
+ * start index: negative keys go before the sorted attributes,
+ * the most recently inserted first, and positive keys after them,
+ * in the order of insertion.
+ */
+typedef struct
+{
+  VogueAttribute *attr;
+  int key;
+} PendingAttr;
+
+/* Built-in attribute types get a slot in the iterator */
+#define N_ATTR_SLOTS (PANGO_ATTR_INSERT_HYPHENS + 1)
+
 struct _VogueAttrIterator
 {
-  GSList *next_attribute;
-  GList *attribute_stack;
+  GPtrArray *attrs;
+  guint attr_index;
+  GPtrArray *attribute_stack;	/* attributes at the current position, latest start last */
   guint start_index;
   guint end_index;
+  VogueAttribute *slots[N_ATTR_SLOTS]; /* topmost stack entry of each built-in type */
 };
 
+#define LIST_ATTR(list, i) ((VogueAttribute *) g_ptr_array_index ((list)->attributes, (i)))
+
 static VogueAttribute *vogue_attr_color_new         (const VogueAttrClass *klass,
 						     guint16               red,
 						     guint16               green,
@@ -1280,8 +1306,14 @@ vogue_attr_list_new (void)
   VogueAttrList *list = g_slice_new (VogueAttrList);
 
   list->ref_count = 1;
-  list->attributes = NULL;
-  list->attributes_tail = NULL;
+  list->attributes = g_ptr_array_new ();
+  list->pending = NULL;
+  list->end_tree = NULL;
+  list->end_tree_size = 0;
+  list->end_tree_valid = 0;
+  list->end_tree_len = 0;
+  list->borrowed = FALSE;
+  list->shared = NULL;
 
   return list;
 }
@@ -1307,6 +1339,254 @@ vogue_attr_list_ref (VogueAttrList *list)
   return list;
 }
 
+static void
+free_attributes (GPtrArray *attributes,
+                 int       *shared)
+{
+  guint i;
+
+  for (i = 0; i < attributes->len; i++)
+    {
+      VogueAttribute *attr = g_ptr_array_index (attributes, i);
+
+      attr->klass->destroy (attr);
+    }
+
+  g_ptr_array_free (attributes, TRUE);
+  g_free (shared);
+}
+
+/* The end tree is a binary tree over the attributes, in an array
+ * like a heap: the leaves hold the end index of each attribute and
+ * every other node the largest end index below it. This lets
+ * vogue_attr_list_change() go straight to the attributes that reach
+ * a given position, however long the attributes before them are.
+ *
+ * It is brought up to date lazily, from the first attribute that
+ * moved since it was last used.
+ */
+
+/* Marks the attributes from @index on as moved */
+static inline void
+invalidate_end_tree (VogueAttrList *list,
+                     guint          index)
+{
+  list->end_tree_valid = MIN (list->end_tree_valid, index);
+}
+
+/* Records a new end index for the attribute at @index, which
+ * has not moved.
+ */
+static void
+update_end_tree (VogueAttrList *list,
+                 guint          index)
+{
+  guint *tree = list->end_tree;
+  guint node;
+
+  if (index >= list->end_tree_valid)
+    return;
+
+  node = list->end_tree_size + index;
+  tree[node] = LIST_ATTR (list, index)->end_index;
+  for (node /= 2; node > 0; node /= 2)
+    tree[node] = MAX (tree[2 * node], tree[2 * node + 1]);
+}
+
+static void
+validate_end_tree (VogueAttrList *list)
+{
+  guint len = list->attributes->len;
+  guint first = list->end_tree_valid;
+  guint last = MAX (len, list->end_tree_len);
+  guint size = list->end_tree_size;
+  guint *tree;
+  guint lo, hi, i;
+
+  if (len > size)
+    {
+      size = MAX (size, 16);
+      while (size < len)
+        size *= 2;
+
+      g_free (list->end_tree);
+      list->end_tree = g_new0 (guint, 2 * size);
+      list->end_tree_size = size;
+      first = 0;
+      last = len;
+    }
+
+  tree = list->end_tree;
+  if (first < last)
+    {
+      for (i = first; i < last; i++)
+        tree[size + i] = i < len ? LIST_ATTR (list, i)->end_index : 0;
+
+      for (lo = (size + first) / 2, hi = (size + last - 1) / 2; lo > 0; lo /= 2, hi /= 2)
+        for (i = lo; i <= hi; i++)
+          tree[i] = MAX (tree[2 * i], tree[2 * i + 1]);
+    }
+
+  list->end_tree_valid = len;
+  list->end_tree_len = len;
+}
+
+/* Returns the index of the first attribute from @from up to @limit
+ * that ends at or after @start_index, or @limit if there is none.
+ */
+static guint
+find_overlap (VogueAttrList *list,
+              guint          from,
+              guint          limit,
+              guint          start_index)
+{
+  const guint *tree;
+  guint node;
+
+  if (from >= limit)
+    return limit;
+
+  validate_end_tree (list);
+  tree = list->end_tree;
+
+  node = list->end_tree_size + from;
+  if (tree[node] < start_index)
+    {
+      /* Go up until the subtree to the right has a match... */
+      for (;;)
+        {
+          if (node == 1)
+            return limit;
+
+          if (node % 2 == 0 && tree[node + 1] >= start_index)
+            {
+              node++;
+              break;
+            }
+
+          node /= 2;
+        }
+
+      /* ...and down to its first match */
+      while (node < list->end_tree_size)
+        {
+          node *= 2;
+          if (tree[node] < start_index)
+            node++;
+        }
+    }
+
+  return MIN (node - list->end_tree_size, limit);
+}
+
+static int
+compare_pending (gconstpointer a,
+                 gconstpointer b)
+{
+  const PendingAttr *pending1 = a;
+  const PendingAttr *pending2 = b;
+
+  if (pending1->attr->start_index != pending2->attr->start_index)
+    return pending1->attr->start_index < pending2->attr->start_index ? -1 : 1;
+
+  return pending1->key < pending2->key ? -1 : (pending1->key > pending2->key);
+}
+
+G_LOCK_DEFINE_STATIC (pending_attrs);
+
+/* Puts the attributes that vogue_attr_list_insert() added out of
+ * order in place. They are sorted among themselves and merged into
+ * the sorted array in one pass, so that building a list in any
+ * order takes O(n log n) time instead of moving the tail of the
+ * array for every attribute.
+ *
+ * This is called before anything reads the attributes, which could
+ * happen from several threads at once, so it takes a lock.
+ */
+static void
+attr_list_merge_pending (VogueAttrList *list)
+{
+  GArray *pending;
+  guint n, i, j, k;
+
+  if (g_atomic_pointer_get (&list->pending) == NULL)
+    return;
+
+  G_LOCK (pending_attrs);
+
+  pending = list->pending;
+  if (pending == NULL)
+    {
+      G_UNLOCK (pending_attrs);
+      return;
+    }
+
+  g_array_sort (pending, compare_pending);
+
+  n = list->attributes->len;
+  g_ptr_array_set_size (list->attributes, n + pending->len);
+
+  /* Fill the array from the back, so that every attribute moves once */
+  i = n;
+  j = pending->len;
+  k = n + pending->len;
+  while (j > 0)
+    {
+      PendingAttr *last = &g_array_index (pending, PendingAttr, j - 1);
+
+      if (i > 0 &&
+          (LIST_ATTR (list, i - 1)->start_index > last->attr->start_index ||
+           (LIST_ATTR (list, i - 1)->start_index == last->attr->start_index && last->key < 0)))
+        g_ptr_array_index (list->attributes, --k) = LIST_ATTR (list, --i);
+      else
+        {
+          g_ptr_array_index (list->attributes, --k) = last->attr;
+          j--;
+        }
+    }
+
+  invalidate_end_tree (list, k);
+
+  g_atomic_pointer_set (&list->pending, NULL);
+  G_UNLOCK (pending_attrs);
+
+  g_array_free (pending, TRUE);
+}
+
+/* Gives @list attributes of its own before it is modified,
+ * if it shares them with copies.
+ */
+static void
+attr_list_make_writable (VogueAttrList *list)
+{
+  GPtrArray *attributes;
+  guint i;
+
+  if (!list->shared)
+    return;
+
+  /* The last other list could be releasing the attributes
+   * concurrently, so only drop our share after copying.
+   */
+  if (g_atomic_int_get (list->shared) == 1)
+    {
+      g_free (list->shared);
+      list->shared = NULL;
+      return;
+    }
+
+  attributes = g_ptr_array_sized_new (list->attributes->len);
+  g_ptr_array_set_size (attributes, list->attributes->len);
+  for (i = 0; i < list->attributes->len; i++)
+    g_ptr_array_index (attributes, i) = vogue_attribute_copy (LIST_ATTR (list, i));
+
+  if (g_atomic_int_dec_and_test (list->shared))
+    free_attributes (list->attributes, list->shared);
+
+  list->attributes = attributes;
+  list->shared = NULL;
+}
+
 /**
  * vogue_attr_list_unref:
  * @list: (nullable): a #VogueAttrList, may be %NULL
@@ -1318,8 +1598,6 @@ vogue_attr_list_ref (VogueAttrList *list)
 void
 vogue_attr_list_unref (VogueAttrList *list)
 {
-  GSList *tmp_list;
-
   if (list == NULL)
     return;
 
@@ -1327,17 +1605,26 @@ vogue_attr_list_unref (VogueAttrList *list)
 
   if (g_atomic_int_dec_and_test ((int *) &list->ref_count))
     {
-      tmp_list = list->attributes;
-      while (tmp_list)
-	{
-	  VogueAttribute *attr = tmp_list->data;
-	  tmp_list = tmp_list->next;
+      if (list->shared)
+        {
+          if (g_atomic_int_dec_and_test (list->shared))
+            free_attributes (list->attributes, list->shared);
+        }
+      else if (list->borrowed)
+        g_ptr_array_free (list->attributes, TRUE);
+      else
+        free_attributes (list->attributes, NULL);
 
-	  attr->klass->destroy (attr);
-	}
+      if (list->pending)
+        {
+          guint i;
 
-      g_slist_free (list->attributes);
+          for (i = 0; i < list->pending->len; i++)
+            vogue_attribute_destroy (g_array_index (list->pending, PendingAttr, i).attr);
+          g_array_free (list->pending, TRUE);
+        }
 
+      g_free (list->end_tree);
       g_slice_free (VogueAttrList, list);
     }
 }
@@ -1348,6 +1635,9 @@ vogue_attr_list_unref (VogueAttrList *list)
  *
  * Copy @list and return an identical new list.
  *
+ * The copy shares the attributes of @list until either of the
+ * two lists is modified, so copying is cheap even for long lists.
+ *
  * Return value: (nullable): the newly allocated #VogueAttrList, with a
  *               reference count of one, which should
  *               be freed with vogue_attr_list_unref().
@@ -1357,78 +1647,118 @@ VogueAttrList *
 vogue_attr_list_copy (VogueAttrList *list)
 {
   VogueAttrList *new;
-  GSList *iter;
-  GSList *new_attrs;
+  guint i;
 
   if (list == NULL)
     return NULL;
 
+  attr_list_merge_pending (list);
+
   new = vogue_attr_list_new ();
 
-  iter = list->attributes;
-  new_attrs = NULL;
-  while (iter != NULL)
+  if (list->borrowed)
+    {
+      g_ptr_array_set_size (new->attributes, list->attributes->len);
+      for (i = 0; i < list->attributes->len; i++)
+        g_ptr_array_index (new->attributes, i) = vogue_attribute_copy (LIST_ATTR (list, i));
+
+      return new;
+    }
+
+  if (!list->shared)
     {
-      new_attrs = g_slist_prepend (new_attrs,
-				   vogue_attribute_copy (iter->data));
+      int *shared = g_new (int, 1);
 
-      iter = g_slist_next (iter);
+      *shared = 1;
+      if (!g_atomic_pointer_compare_and_exchange (&list->shared, NULL, shared))
+        g_free (shared);
     }
 
-  /* we're going to reverse the nodes, so head becomes tail */
-  new->attributes_tail = new_attrs;
-  new->attributes = g_slist_reverse (new_attrs);
+  g_atomic_int_inc (list->shared);
+
+  g_ptr_array_free (new->attributes, TRUE);
+  new->attributes = list->attributes;
+  new->shared = list->shared;
 
   return new;
 }
 
-static void
-vogue_attr_list_insert_internal (VogueAttrList  *list,
-				 VogueAttribute *attr,
-				 gboolean        before)
+/* Returns the index of the first attribute in @list that starts
+ * after @start_index, or, if @before is %TRUE, at or after it.
+ */
+static guint
+find_insert_position (VogueAttrList *list,
+                      guint          start_index,
+                      gboolean       before)
 {
-  GSList *tmp_list, *prev, *link;
-  guint start_index = attr->start_index;
+  guint lo, hi;
+
+  lo = 0;
+  hi = list->attributes->len;
 
-  if (!list->attributes)
+  /* Appending is the common case */
+  if (hi > 0)
     {
-      list->attributes = g_slist_prepend (NULL, attr);
-      list->attributes_tail = list->attributes;
+      VogueAttribute *last = LIST_ATTR (list, hi - 1);
+
+      if (last->start_index < start_index ||
+          (!before && last->start_index == start_index))
+        return hi;
     }
-  else if (((VogueAttribute *)list->attributes_tail->data)->start_index < start_index ||
-	   (!before && ((VogueAttribute *)list->attributes_tail->data)->start_index == start_index))
+
+  while (lo < hi)
     {
-      list->attributes_tail = g_slist_append (list->attributes_tail, attr);
-      list->attributes_tail = list->attributes_tail->next;
-      g_assert (list->attributes_tail);
+      guint mid = lo + (hi - lo) / 2;
+      VogueAttribute *attr = LIST_ATTR (list, mid);
+
+      if (attr->start_index < start_index ||
+          (!before && attr->start_index == start_index))
+        lo = mid + 1;
+      else
+        hi = mid;
     }
-  else
-    {
-      prev = NULL;
-      tmp_list = list->attributes;
-      while (1)
-	{
-	  VogueAttribute *tmp_attr = tmp_list->data;
 
-	  if (tmp_attr->start_index > start_index ||
-	      (before && tmp_attr->start_index == start_index))
-	    {
-	      link = g_slist_alloc ();
-	      link->next = tmp_list;
-	      link->data = attr;
+  return lo;
+}
 
-	      if (prev)
-		prev->next = link;
-	      else
-		list->attributes = link;
+/* Inserts @attr in place, in a list without pending attributes */
+static void
+attr_list_insert_sorted (VogueAttrList  *list,
+                         VogueAttribute *attr,
+                         gboolean        before)
+{
+  guint i;
 
-	      break;
-	    }
+  i = find_insert_position (list, attr->start_index, before);
+  g_ptr_array_insert (list->attributes, i, attr);
+  invalidate_end_tree (list, i);
+}
 
-	  prev = tmp_list;
-	  tmp_list = tmp_list->next;
-	}
+static void
+vogue_attr_list_insert_internal (VogueAttrList  *list,
+				 VogueAttribute *attr,
+				 gboolean        before)
+{
+  PendingAttr pending;
+  guint len;
+
+  attr_list_make_writable (list);
+
+  /* Appending is the common case, and needs nothing else */
+  len = list->attributes->len;
+  if (list->pending == NULL &&
+      find_insert_position (list, attr->start_index, before) == len)
+    {
+      g_ptr_array_add (list->attributes, attr);
+      return;
     }
+
+  if (list->pending == NULL)
+    list->pending = g_array_new (FALSE, FALSE, sizeof (PendingAttr));
+
+  pending.attr = attr;
+  pending.key = before ? - (int) list->pending->len - 1 : (int) list->pending->len + 1;
+  g_array_append_val (list->pending, pending);
 }
 
 /**
@@ -1440,6 +1770,9 @@ vogue_attr_list_insert_internal (VogueAttrList  *list,
  * Insert the given attribute into the #VogueAttrList. It will
  * be inserted after all other attributes with a matching
  * @start_index.
+ *
+ * Attributes can be inserted in any order; building a list
+ * takes O(n log n) time either way.
  **/
 void
 vogue_attr_list_insert (VogueAttrList  *list,
@@ -1486,14 +1819,20 @@ vogue_attr_list_insert_before (VogueAttrList  *list,
  * for large lists). However, vogue_attr_list_insert() is not
  * suitable for continually changing a set of attributes
  * since it never removes or combines existing attributes.
+ *
+ * A change takes time logarithmic in the size of @list, plus time
+ * for the attributes that the new one overlaps. Changes that are
+ * not in order of start index also move all attributes that start
+ * after the new one.
  **/
 void
 vogue_attr_list_change (VogueAttrList  *list,
 			VogueAttribute *attr)
 {
-  GSList *tmp_list, *prev, *link;
+  guint i, n, attr_index;
   guint start_index = attr->start_index;
   guint end_index = attr->end_index;
+  gboolean inserted = FALSE;
 
   g_return_if_fail (list != NULL);
 
@@ -1503,105 +1842,93 @@ vogue_attr_list_change (VogueAttrList  *list,
       return;
     }
 
-  tmp_list = list->attributes;
-  prev = NULL;
-  while (1)
+  attr_list_make_writable (list);
+  attr_list_merge_pending (list);
+
+  /* Only the first n attributes start at or before the new one,
+   * and of those, only the ones that reach it can overlap it.
+   */
+  n = find_insert_position (list, start_index, FALSE);
+
+  for (i = find_overlap (list, 0, n, start_index);
+       i < n;
+       i = find_overlap (list, i + 1, n, start_index))
     {
-      VogueAttribute *tmp_attr;
+      VogueAttribute *tmp_attr = LIST_ATTR (list, i);
+
+      if (tmp_attr->klass->type != attr->klass->type)
+	continue;
 
-      if (!tmp_list ||
-	  ((VogueAttribute *)tmp_list->data)->start_index > start_index)
+      /* We overlap with an existing attribute */
+      if (vogue_attribute_equal (tmp_attr, attr))
 	{
-	  /* We need to insert a new attribute
+	  /* We can merge the new attribute with this attribute
 	   */
-	  link = g_slist_alloc ();
-	  link->next = tmp_list;
-	  link->data = attr;
-
-	  if (prev)
-	    prev->next = link;
-	  else
-	    list->attributes = link;
-
-	  if (!tmp_list)
-	    list->attributes_tail = link;
+	  if (tmp_attr->end_index >= end_index)
+	    {
+	      /* We are totally overlapping the previous attribute.
+	       * No action is needed.
+	       */
+	      vogue_attribute_destroy (attr);
+	      return;
+	    }
+	  tmp_attr->end_index = end_index;
+	  update_end_tree (list, i);
+	  vogue_attribute_destroy (attr);
 
-	  prev = link;
-	  tmp_list = prev->next;
+	  attr = tmp_attr;
+	  inserted = TRUE;
 	  break;
 	}
-
-      tmp_attr = tmp_list->data;
-
-      if (tmp_attr->klass->type == attr->klass->type &&
-	  tmp_attr->end_index >= start_index)
+      else
 	{
-	  /* We overlap with an existing attribute */
-	  if (vogue_attribute_equal (tmp_attr, attr))
+	  /* Split, truncate, or remove the old attribute. The end
+	   * piece starts after the new attribute, so it goes after
+	   * the first n attributes.
+	   */
+	  if (tmp_attr->end_index > attr->end_index)
 	    {
-	      /* We can merge the new attribute with this attribute
-	       */
-	      if (tmp_attr->end_index >= end_index)
-		{
-		  /* We are totally overlapping the previous attribute.
-		   * No action is needed.
-		   */
-		  vogue_attribute_destroy (attr);
-		  return;
-		}
-	      tmp_attr->end_index = end_index;
-	      vogue_attribute_destroy (attr);
+	      VogueAttribute *end_attr = vogue_attribute_copy (tmp_attr);
 
-	      attr = tmp_attr;
+	      end_attr->start_index = attr->end_index;
+	      attr_list_insert_sorted (list, end_attr, FALSE);
+	    }
 
-	      prev = tmp_list;
-	      tmp_list = tmp_list->next;
+	  if (tmp_attr->start_index == attr->start_index)
+	    {
+	      vogue_attribute_destroy (tmp_attr);
+	      g_ptr_array_index (list->attributes, i) = attr;
+	      update_end_tree (list, i);
 
+	      inserted = TRUE;
 	      break;
 	    }
 	  else
 	    {
-	      /* Split, truncate, or remove the old attribute
-	       */
-	      if (tmp_attr->end_index > attr->end_index)
-		{
-		  VogueAttribute *end_attr = vogue_attribute_copy (tmp_attr);
-
-		  end_attr->start_index = attr->end_index;
-		  vogue_attr_list_insert (list, end_attr);
-		}
-
-	      if (tmp_attr->start_index == attr->start_index)
-		{
-		  vogue_attribute_destroy (tmp_attr);
-		  tmp_list->data = attr;
-
-		  prev = tmp_list;
-		  tmp_list = tmp_list->next;
-		  break;
-		}
-	      else
-		{
-		  tmp_attr->end_index = attr->start_index;
-		}
+	      tmp_attr->end_index = attr->start_index;
+	      update_end_tree (list, i);
 	    }
 	}
-      prev = tmp_list;
-      tmp_list = tmp_list->next;
     }
-  /* At this point, prev points to the list node with attr in it,
-   * tmp_list points to prev->next.
-   */
 
-  g_assert (prev->data == attr);
-  g_assert (prev->next == tmp_list);
+  if (!inserted)
+    {
+      /* We need to insert a new attribute
+       */
+      i = n;
+      g_ptr_array_insert (list->attributes, i, attr);
+      invalidate_end_tree (list, i);
+    }
 
   /* We now have the range inserted into the list one way or the
-   * other. Fix up the remainder
+   * other, at position i. Fix up the remainder
    */
-  while (tmp_list)
+  attr_index = i;
+
+  i++;
+  while (i < list->attributes->len)
     {
-      VogueAttribute *tmp_attr = tmp_list->data;
+      VogueAttribute *tmp_attr = LIST_ATTR (list, i);
 
       if (tmp_attr->start_index > end_index)
 	break;
@@ -1615,13 +1942,9 @@ vogue_attr_list_change (VogueAttrList  *list,
 	      attr->end_index = MAX (end_index, tmp_attr->end_index);
 
 	      vogue_attribute_destroy (tmp_attr);
-	      prev->next = tmp_list->next;
-
-	      if (!prev->next)
-		list->attributes_tail = prev;
-
-	      g_slist_free_1 (tmp_list);
-	      tmp_list = prev->next;
+	      g_ptr_array_remove_index (list->attributes, i);
+	      update_end_tree (list, attr_index);
+	      invalidate_end_tree (list, i);
 
 	      continue;
 	    }
@@ -1632,48 +1955,31 @@ vogue_attr_list_change (VogueAttrList  *list,
 	       * it in the list to maintain the required non-decreasing
 	       * order of start indices
 	       */
-	      GSList *tmp_list2;
-	      GSList *prev2;
+	      guint j;
 
 	      tmp_attr->start_index = attr->end_index;
 
-	      tmp_list2 = tmp_list->next;
-	      prev2 = tmp_list;
-
-	      while (tmp_list2)
+	      for (j = i + 1; j < list->attributes->len; j++)
 		{
-		  VogueAttribute *tmp_attr2 = tmp_list2->data;
-
-		  if (tmp_attr2->start_index >= tmp_attr->start_index)
+		  if (LIST_ATTR (list, j)->start_index >= tmp_attr->start_index)
 		    break;
-
-		  prev2 = tmp_list2;
-		  tmp_list2 = tmp_list2->next;
 		}
 
-	      /* Now remove and insert before tmp_list2. We'll
+	      /* Now remove and insert before j. We'll
 	       * hit this attribute again later, but that's harmless.
 	       */
-	      if (prev2 != tmp_list)
+	      if (j != i + 1)
 		{
-		  GSList *old_next = tmp_list->next;
-
-		  prev->next = old_next;
-		  prev2->next = tmp_list;
-		  tmp_list->next = tmp_list2;
-
-		  if (!tmp_list->next)
-		    list->attributes_tail = tmp_list;
-
-		  tmp_list = old_next;
+		  g_ptr_array_remove_index (list->attributes, i);
+		  g_ptr_array_insert (list->attributes, j - 1, tmp_attr);
+		  invalidate_end_tree (list, i);
 
 		  continue;
 		}
 	    }
 	}
 
-      prev = tmp_list;
-      tmp_list = tmp_list->next;
+      i++;
     }
 }
 
@@ -1709,53 +2015,51 @@ vogue_attr_list_update (VogueAttrList *list,
                         int             remove,
                         int             add)
 {
-  GSList *l, *prev, *next;
+  guint i, n;
+
+  attr_list_make_writable (list);
+  attr_list_merge_pending (list);
 
-   prev = NULL;
-   l = list->attributes;
-   while (l)
+  /* This keeps the order of start indices, so we only
+   * need to drop the removed attributes in place.
+   */
+  n = 0;
+  for (i = 0; i < list->attributes->len; i++)
     {
-      VogueAttribute *attr = l->data;
-      next = l->next;
+      VogueAttribute *attr = LIST_ATTR (list, i);
 
       if (attr->start_index >= pos &&
           attr->end_index < pos + remove)
         {
           vogue_attribute_destroy (attr);
-          if (prev == NULL)
-            list->attributes = next;
-          else
-            prev->next = next;
+          continue;
+        }
 
-          g_slist_free_1 (l);
+      if (attr->start_index >= pos &&
+          attr->start_index < pos + remove)
+        {
+          attr->start_index = pos + add;
         }
-      else
+      else if (attr->start_index >= pos + remove)
         {
-          prev = l;
-
-          if (attr->start_index >= pos &&
-              attr->start_index < pos + remove)
-            {
-              attr->start_index = pos + add;
-            }
-          else if (attr->start_index >= pos + remove)
-            {
-              attr->start_index += add - remove;
-            }
+          attr->start_index += add - remove;
+        }
 
-          if (attr->end_index >= pos &&
-              attr->end_index < pos + remove)
-            {
-              attr->end_index = pos;
-            }
-          else if (attr->end_index >= pos + remove)
-            {
-              attr->end_index += add - remove;
-            }
+      if (attr->end_index >= pos &&
+          attr->end_index < pos + remove)
+        {
+          attr->end_index = pos;
+        }
+      else if (attr->end_index >= pos + remove)
+        {
+          attr->end_index += add - remove;
         }
 
-      l = next;
+      g_ptr_array_index (list->attributes, n++) = attr;
     }
+
+  g_ptr_array_set_size (list->attributes, n);
+  invalidate_end_tree (list, 0);
 }
 
 /**
@@ -1784,7 +2088,7 @@ vogue_attr_list_splice (VogueAttrList *list,
 			gint           pos,
 			gint           len)
 {
-  GSList *tmp_list;
+  guint i;
   guint upos, ulen;
 
   g_return_if_fail (list != NULL);
@@ -1795,15 +2099,18 @@ vogue_attr_list_splice (VogueAttrList *list,
   upos = (guint)pos;
   ulen = (guint)len;
 
+  attr_list_make_writable (list);
+  attr_list_merge_pending (list);
+  attr_list_merge_pending (other);
+
 /* This definition only works when a and b are unsigned; overflow
  * isn't defined in the C standard for signed integers
  */
 #define CLAMP_ADD(a,b) (((a) + (b) < (a)) ? G_MAXUINT : (a) + (b))
 
-  tmp_list = list->attributes;
-  while (tmp_list)
+  for (i = 0; i < list->attributes->len; i++)
     {
-      VogueAttribute *attr = tmp_list->data;
+      VogueAttribute *attr = LIST_ATTR (list, i);
 
       if (attr->start_index <= upos)
 	{
@@ -1820,14 +2127,13 @@ vogue_attr_list_splice (VogueAttrList *list,
 	  attr->start_index = CLAMP_ADD (attr->start_index, ulen);
 	  attr->end_index = CLAMP_ADD (attr->end_index, ulen);
 	}
-
-      tmp_list = tmp_list->next;
     }
 
-  tmp_list = other->attributes;
-  while (tmp_list)
+  invalidate_end_tree (list, 0);
+
+  for (i = 0; i < other->attributes->len; i++)
     {
-      VogueAttribute *attr = vogue_attribute_copy (tmp_list->data);
+      VogueAttribute *attr = vogue_attribute_copy (LIST_ATTR (other, i));
       attr->start_index = CLAMP_ADD (attr->start_index, upos);
       attr->end_index = CLAMP_ADD (attr->end_index, upos);
 
@@ -1835,8 +2141,6 @@ vogue_attr_list_splice (VogueAttrList *list,
        * vogue_attr_list_change() will take care of deleting it.
        */
       vogue_attr_list_change (list, attr);
-
-      tmp_list = tmp_list->next;
     }
 #undef CLAMP_ADD
 }
@@ -1857,9 +2161,252 @@ vogue_attr_list_splice (VogueAttrList *list,
 GSList *
 vogue_attr_list_get_attributes (VogueAttrList *list)
 {
+  GSList *result = NULL;
+  guint i;
+
   g_return_val_if_fail (list != NULL, NULL);
 
-  return g_slist_copy_deep (list->attributes, (GCopyFunc)vogue_attribute_copy, NULL);
+  attr_list_merge_pending (list);
+
+  for (i = list->attributes->len; i > 0; i--)
+    result = g_slist_prepend (result, vogue_attribute_copy (LIST_ATTR (list, i - 1)));
+
+  return result;
+}
+
+static int
+compare_start_index (gconstpointer a,
+                     gconstpointer b)
+{
+  const VogueAttribute *attr1 = *(const VogueAttribute * const *) a;
+  const VogueAttribute *attr2 = *(const VogueAttribute * const *) b;
+
+  if (attr1->start_index < attr2->start_index)
+    return -1;
+  else if (attr1->start_index > attr2->start_index)
+    return 1;
+  else
+    return 0;
+}
+
+/* Turns @attributes into a list, taking ownership of the array.
+ * g_ptr_array_sort() is stable, so if the attributes are not in
+ * order the result is the same as inserting them one by one with
+ * vogue_attr_list_insert().
+ */
+static VogueAttrList *
+attr_list_new_from_array (GPtrArray *attributes,
+                          gboolean   sorted)
+{
+  VogueAttrList *list = g_slice_new (VogueAttrList);
+
+  if (!sorted)
+    g_ptr_array_sort (attributes, compare_start_index);
+
+  list->ref_count = 1;
+  list->attributes = attributes;
+  list->pending = NULL;
+  list->end_tree = NULL;
+  list->end_tree_size = 0;
+  list->end_tree_valid = 0;
+  list->end_tree_len = 0;
+  list->borrowed = FALSE;
+  list->shared = NULL;
+
+  return list;
+}
+
+/**
+ * vogue_attr_list_new_from_sorted:
+ * @attrs: (array length=n_attrs): the attributes, sorted by start index
+ * @n_attrs: the number of attributes in @attrs
+ * @take_ownership: whether the new list takes ownership of the
+ *   attributes in @attrs. If %FALSE, they are copied
+ *
+ * Creates a new attribute list holding the attributes in @attrs.
+ *
+ * This is the same as creating an empty list and calling
+ * vogue_attr_list_insert() for each attribute in turn, but when
+ * the attributes are already sorted by start index, as they are
+ * when produced by a parser or a highlighter, it takes linear time.
+ * Unsorted input is accepted too, and sorted once.
+ *
+ * Return value: (transfer full): the newly allocated #VogueAttrList,
+ *               which should be freed with vogue_attr_list_unref().
+ *
+ * Since: 1.46
+ */
+VogueAttrList *
+vogue_attr_list_new_from_sorted (VogueAttribute **attrs,
+                                 guint            n_attrs,
+                                 gboolean         take_ownership)
+{
+  GPtrArray *attributes;
+  gboolean sorted = TRUE;
+  guint i;
+
+  g_return_val_if_fail (attrs != NULL || n_attrs == 0, NULL);
+
+  attributes = g_ptr_array_sized_new (n_attrs);
+  g_ptr_array_set_size (attributes, n_attrs);
+
+  for (i = 0; i < n_attrs; i++)
+    {
+      VogueAttribute *attr = attrs[i];
+
+      if (i > 0 && attr->start_index < attrs[i - 1]->start_index)
+        sorted = FALSE;
+
+      g_ptr_array_index (attributes, i) = take_ownership ? attr : vogue_attribute_copy (attr);
+    }
+
+  return attr_list_new_from_array (attributes, sorted);
+}
+
+struct _VogueAttrListBuilder
+{
+  GPtrArray *attributes;
+  guint last_start;
+  guint sorted : 1;
+};
+
+/**
+ * vogue_attr_list_builder_new:
+ * @n_attrs_hint: the number of attributes expected, or 0
+ *
+ * Creates a builder to construct a #VogueAttrList by appending
+ * attributes to it. The builder must be finished with
+ * vogue_attr_list_builder_end() or freed with
+ * vogue_attr_list_builder_free().
+ *
+ * Return value: (transfer full): the newly allocated #VogueAttrListBuilder
+ *
+ * Since: 1.46
+ */
+VogueAttrListBuilder *
+vogue_attr_list_builder_new (guint n_attrs_hint)
+{
+  VogueAttrListBuilder *builder = g_slice_new (VogueAttrListBuilder);
+
+  builder->attributes = g_ptr_array_sized_new (n_attrs_hint);
+  builder->last_start = 0;
+  builder->sorted = TRUE;
+
+  return builder;
+}
+
+/**
+ * vogue_attr_list_builder_append:
+ * @builder: a #VogueAttrListBuilder
+ * @attr: (transfer full): the attribute to append. Ownership of this
+ *        value is assumed by the builder.
+ *
+ * Appends @attr to the list being built. Appending attributes in
+ * order of their start index is cheapest; the list comes out the
+ * same as with vogue_attr_list_insert() either way.
+ *
+ * Since: 1.46
+ */
+void
+vogue_attr_list_builder_append (VogueAttrListBuilder *builder,
+                                VogueAttribute       *attr)
+{
+  g_return_if_fail (builder != NULL);
+  g_return_if_fail (attr != NULL);
+
+  if (attr->start_index < builder->last_start)
+    builder->sorted = FALSE;
+  builder->last_start = attr->start_index;
+
+  g_ptr_array_add (builder->attributes, attr);
+}
+
+/**
+ * vogue_attr_list_builder_end:
+ * @builder: (transfer full): a #VogueAttrListBuilder
+ *
+ * Finishes @builder and returns the list it built. The builder
+ * is freed.
+ *
+ * Return value: (transfer full): the newly allocated #VogueAttrList,
+ *               which should be freed with vogue_attr_list_unref().
+ *
+ * Since: 1.46
+ */
+VogueAttrList *
+vogue_attr_list_builder_end (VogueAttrListBuilder *builder)
+{
+  VogueAttrList *list;
+
+  g_return_val_if_fail (builder != NULL, NULL);
+
+  list = attr_list_new_from_array (builder->attributes, builder->sorted);
+  g_slice_free (VogueAttrListBuilder, builder);
+
+  return list;
+}
+
+/**
+ * vogue_attr_list_builder_free:
+ * @builder: (nullable) (transfer full): a #VogueAttrListBuilder, may be %NULL
+ *
+ * Frees @builder and the attributes appended to it, without
+ * building a list.
+ *
+ * Since: 1.46
+ */
+void
+vogue_attr_list_builder_free (VogueAttrListBuilder *builder)
+{
+  guint i;
+
+  if (builder == NULL)
+    return;
+
+  for (i = 0; i < builder->attributes->len; i++)
+    vogue_attribute_destroy (g_ptr_array_index (builder->attributes, i));
+
+  g_ptr_array_free (builder->attributes, TRUE);
+  g_slice_free (VogueAttrListBuilder, builder);
+}
+
+VogueAttrList *
+_vogue_attr_list_new_view (VogueAttrList   *list,
+                           VogueAttribute **prefix,
+                           guint            n_prefix,
+                           guint64          type_mask)
+{
+  VogueAttrList *view = NULL;
+  guint n_attrs;
+  guint i;
+
+  if (list)
+    attr_list_merge_pending (list);
+
+  n_attrs = n_prefix + (list ? list->attributes->len : 0);
+
+  for (i = 0; i < n_attrs; i++)
+    {
+      VogueAttribute *attr;
+
+      if (i < n_prefix)
+        attr = prefix[i];
+      else
+        attr = LIST_ATTR (list, i - n_prefix);
+
+      if (!(type_mask & PANGO_ATTR_TYPE_MASK (attr->klass->type)))
+        continue;
+
+      if (!view)
+        {
+          view = vogue_attr_list_new ();
+          view->borrowed = TRUE;
+        }
+
+      g_ptr_array_add (view->attributes, attr);
+    }
+
+  return view;
 }
 
 G_DEFINE_BOXED_TYPE (VogueAttrIterator,
@@ -1884,8 +2431,11 @@ vogue_attr_list_get_iterator (VogueAttrList  *list)
 
   g_return_val_if_fail (list != NULL, NULL);
 
-  iterator = g_slice_new (VogueAttrIterator);
-  iterator->next_attribute = list->attributes;
+  attr_list_merge_pending (list);
+
+  iterator = g_slice_new0 (VogueAttrIterator);
+  iterator->attrs = list->attributes;
+  iterator->attr_index = 0;
   iterator->attribute_stack = NULL;
 
   iterator->start_index = 0;
@@ -1933,48 +2483,73 @@ vogue_attr_iterator_range (VogueAttrIterator *iterator,
 gboolean
 vogue_attr_iterator_next (VogueAttrIterator *iterator)
 {
-  GList *tmp_list;
+  GPtrArray *stack;
+  gboolean changed = FALSE;
+  guint i, n;
 
   g_return_val_if_fail (iterator != NULL, FALSE);
 
-  if (!iterator->next_attribute && !iterator->attribute_stack)
+  stack = iterator->attribute_stack;
+
+  if (iterator->attr_index >= iterator->attrs->len &&
+      (!stack || stack->len == 0))
     return FALSE;
 
   iterator->start_index = iterator->end_index;
   iterator->end_index = G_MAXUINT;
 
-  tmp_list = iterator->attribute_stack;
-  while (tmp_list)
+  if (stack)
     {
-      GList *next = tmp_list->next;
-      VogueAttribute *attr = tmp_list->data;
+      n = 0;
+      for (i = 0; i < stack->len; i++)
+        {
+          VogueAttribute *attr = g_ptr_array_index (stack, i);
 
-      if (attr->end_index == iterator->start_index)
-	{
-	  iterator->attribute_stack = g_list_remove_link (iterator->attribute_stack, tmp_list);
-	  g_list_free_1 (tmp_list);
-	}
-      else
-	{
-	  iterator->end_index = MIN (iterator->end_index, attr->end_index);
-	}
+          if (attr->end_index == iterator->start_index)
+            {
+              changed = TRUE;
+              continue;
+            }
 
-      tmp_list = next;
+          iterator->end_index = MIN (iterator->end_index, attr->end_index);
+          g_ptr_array_index (stack, n++) = attr;
+        }
+      g_ptr_array_set_size (stack, n);
     }
 
-  while (iterator->next_attribute &&
-	 ((VogueAttribute *)iterator->next_attribute->data)->start_index == iterator->start_index)
+  while (iterator->attr_index < iterator->attrs->len)
     {
-      if (((VogueAttribute *)iterator->next_attribute->data)->end_index > iterator->start_index)
+      VogueAttribute *attr = g_ptr_array_index (iterator->attrs, iterator->attr_index);
+
+      if (attr->start_index != iterator->start_index)
+        {
+          iterator->end_index = MIN (iterator->end_index, attr->start_index);
+          break;
+        }
+
+      if (attr->end_index > iterator->start_index)
 	{
-	  iterator->attribute_stack = g_list_prepend (iterator->attribute_stack, iterator->next_attribute->data);
-	  iterator->end_index = MIN (iterator->end_index, ((VogueAttribute *)iterator->next_attribute->data)->end_index);
+          if (G_UNLIKELY (!stack))
+            stack = iterator->attribute_stack = g_ptr_array_sized_new (8);
+
+          g_ptr_array_add (stack, attr);
+	  iterator->end_index = MIN (iterator->end_index, attr->end_index);
+          changed = TRUE;
 	}
-      iterator->next_attribute = iterator->next_attribute->next;
+      iterator->attr_index++;
     }
 
-  if (iterator->next_attribute)
-    iterator->end_index = MIN (iterator->end_index, ((VogueAttribute *)iterator->next_attribute->data)->start_index);
+  if (changed)
+    {
+      memset (iterator->slots, 0, sizeof (iterator->slots));
+      for (i = 0; i < stack->len; i++)
+        {
+          VogueAttribute *attr = g_ptr_array_index (stack, i);
+
+          if ((guint) attr->klass->type < N_ATTR_SLOTS)
+            iterator->slots[attr->klass->type] = attr;
+        }
+    }
 
   return TRUE;
 }
@@ -2000,7 +2575,15 @@ vogue_attr_iterator_copy (VogueAttrIterator *iterator)
 
   *copy = *iterator;
 
-  copy->attribute_stack = g_list_copy (iterator->attribute_stack);
+  if (iterator->attribute_stack)
+    {
+      GPtrArray *stack = iterator->attribute_stack;
+
+      copy->attribute_stack = g_ptr_array_sized_new (MAX (stack->len, 8));
+      g_ptr_array_set_size (copy->attribute_stack, stack->len);
+      if (stack->len > 0)
+        memcpy (copy->attribute_stack->pdata, stack->pdata, stack->len * sizeof (gpointer));
+    }
 
   return copy;
 }
@@ -2016,7 +2599,8 @@ vogue_attr_iterator_destroy (VogueAttrIterator *iterator)
 {
   g_return_if_fail (iterator != NULL);
 
-  g_list_free (iterator->attribute_stack);
+  if (iterator->attribute_stack)
+    g_ptr_array_free (iterator->attribute_stack, TRUE);
   g_slice_free (VogueAttrIterator, iterator);
 }
 
@@ -2038,19 +2622,24 @@ VogueAttribute *
 vogue_attr_iterator_get (VogueAttrIterator *iterator,
 			 VogueAttrType      type)
 {
-  GList *tmp_list;
+  GPtrArray *stack;
+  guint i;
 
   g_return_val_if_fail (iterator != NULL, NULL);
 
-  tmp_list = iterator->attribute_stack;
-  while (tmp_list)
+  if ((guint) type < N_ATTR_SLOTS)
+    return iterator->slots[type];
+
+  stack = iterator->attribute_stack;
+  if (!stack)
+    return NULL;
+
+  for (i = stack->len; i > 0; i--)
     {
-      VogueAttribute *attr = tmp_list->data;
+      VogueAttribute *attr = g_ptr_array_index (stack, i - 1);
 
       if (attr->klass->type == type)
 	return attr;
-
-      tmp_list = tmp_list->next;
     }
 
   return NULL;
@@ -2082,8 +2671,9 @@ vogue_attr_iterator_get_font (VogueAttrIterator     *iterator,
 			      VogueLanguage        **language,
 			      GSList               **extra_attrs)
 {
-  GList *tmp_list1;
-  GSList *tmp_list2;
+  GPtrArray *stack;
+  guint i;
+  guint64 seen_types = 0;
 
   VogueFontMask mask = 0;
   gboolean have_language = FALSE;
@@ -2099,11 +2689,13 @@ vogue_attr_iterator_get_font (VogueAttrIterator     *iterator,
   if (extra_attrs)
     *extra_attrs = NULL;
 
-  tmp_list1 = iterator->attribute_stack;
-  while (tmp_list1)
+  stack = iterator->attribute_stack;
+  if (!stack)
+    return;
+
+  for (i = stack->len; i > 0; i--)
     {
-      VogueAttribute *attr = tmp_list1->data;
-      tmp_list1 = tmp_list1->next;
+      VogueAttribute *attr = g_ptr_array_index (stack, i - 1);
 
       switch ((int) attr->klass->type)
 	{
@@ -2187,22 +2779,33 @@ vogue_attr_iterator_get_font (VogueAttrIterator     *iterator,
 	    {
 	      gboolean found = FALSE;
 
-	      tmp_list2 = *extra_attrs;
 	      /* Hack: special-case FONT_FEATURES.  We don't want them to
 	       * override each other, so we never merge them.  This should
 	       * be fixed when we implement attr-merging. */
-	      if (attr->klass->type != PANGO_ATTR_FONT_FEATURES)
-		while (tmp_list2)
-		  {
-		    VogueAttribute *old_attr = tmp_list2->data;
-		    if (attr->klass->type == old_attr->klass->type)
-		      {
-			found = TRUE;
-			break;
-		      }
-
-		    tmp_list2 = tmp_list2->next;
-		  }
+	      if (attr->klass->type == PANGO_ATTR_FONT_FEATURES)
+		found = FALSE;
+	      else if ((guint) attr->klass->type < 64)
+		{
+		  /* Built-in types are tracked in a bitmask */
+		  guint64 bit = G_GUINT64_CONSTANT (1) << attr->klass->type;
+
+		  found = (seen_types & bit) != 0;
+		  seen_types |= bit;
+		}
+	      else
+		{
+		  GSList *tmp_list;
+
+		  for (tmp_list = *extra_attrs; tmp_list; tmp_list = tmp_list->next)
+		    {
+		      VogueAttribute *old_attr = tmp_list->data;
+		      if (attr->klass->type == old_attr->klass->type)
+			{
+			  found = TRUE;
+			  break;
+			}
+		    }
+		}
 
 	      if (!found)
 		*extra_attrs = g_slist_prepend (*extra_attrs, vogue_attribute_copy (attr));
@@ -2242,48 +2845,39 @@ vogue_attr_list_filter (VogueAttrList       *list,
 
 {
   VogueAttrList *new = NULL;
-  GSList *tmp_list;
-  GSList *prev;
+  guint i, n;
 
   g_return_val_if_fail (list != NULL, NULL);
 
-  tmp_list = list->attributes;
-  prev = NULL;
-  while (tmp_list)
+  attr_list_merge_pending (list);
+
+  n = 0;
+  for (i = 0; i < list->attributes->len; i++)
     {
-      GSList *next = tmp_list->next;
-      VogueAttribute *tmp_attr = tmp_list->data;
+      VogueAttribute *tmp_attr = LIST_ATTR (list, i);
 
       if ((*func) (tmp_attr, data))
 	{
-	  if (!tmp_list->next)
-	    list->attributes_tail = prev;
-
-	  if (prev)
-	    prev->next = tmp_list->next;
-	  else
-	    list->attributes = tmp_list->next;
-
-	  tmp_list->next = NULL;
-
 	  if (!new)
 	    {
+	      /* Nothing has been moved yet, so a list that is still
+	       * shared is left alone until something matches.
+	       */
+	      attr_list_make_writable (list);
+	      tmp_attr = LIST_ATTR (list, i);
 	      new = vogue_attr_list_new ();
-	      new->attributes = new->attributes_tail = tmp_list;
-	    }
-	  else
-	    {
-	      new->attributes_tail->next = tmp_list;
-	      new->attributes_tail = tmp_list;
 	    }
 
-	  goto next_attr;
+	  g_ptr_array_add (new->attributes, tmp_attr);
 	}
+      else
+	g_ptr_array_index (list->attributes, n++) = tmp_attr;
+    }
 
-      prev = tmp_list;
-
-    next_attr:
-      tmp_list = next;
+  if (new)
+    {
+      g_ptr_array_set_size (list->attributes, n);
+      invalidate_end_tree (list, 0);
     }
 
   return new;
@@ -2307,11 +2901,15 @@ GSList *
 vogue_attr_iterator_get_attrs (VogueAttrIterator *iterator)
 {
   GSList *attrs = NULL;
-  GList *tmp_list;
+  GPtrArray *stack = iterator->attribute_stack;
+  guint i;
+
+  if (!stack)
+    return NULL;
 
-  for (tmp_list = iterator->attribute_stack; tmp_list; tmp_list = tmp_list->next)
+  for (i = stack->len; i > 0; i--)
     {
-      VogueAttribute *attr = tmp_list->data;
+      VogueAttribute *attr = g_ptr_array_index (stack, i - 1);
       GSList *tmp_list2;
       gboolean found = FALSE;
 
@@ -119,6 +119,15 @@ typedef struct _VogueAttrFontFeatures VogueAttrFontFeatures;
 typedef struct _VogueAttrList     VogueAttrList;
 typedef struct _VogueAttrIterator VogueAttrIterator;
 
+/**
+ * VogueAttrListBuilder:
+ *
+ * The #VogueAttrListBuilder structure is used to construct a
+ * #VogueAttrList from attributes that are produced in order,
+ * see vogue_attr_list_builder_new().
+ */
+typedef struct _VogueAttrListBuilder VogueAttrListBuilder;
+
 /**
  * VogueAttrType:
  * @PANGO_ATTR_INVALID: does not happen
@@ -592,6 +601,21 @@ VogueAttrList *vogue_attr_list_filter (VogueAttrList       *list,
 PANGO_AVAILABLE_IN_1_44
 GSList        *vogue_attr_list_get_attributes    (VogueAttrList *list);
 
+PANGO_AVAILABLE_IN_1_46
+VogueAttrList *vogue_attr_list_new_from_sorted   (VogueAttribute **attrs,
+                                                  guint            n_attrs,
+                                                  gboolean         take_ownership);
+
+PANGO_AVAILABLE_IN_1_46
+VogueAttrListBuilder *vogue_attr_list_builder_new    (guint                 n_attrs_hint);
+PANGO_AVAILABLE_IN_1_46
+void                  vogue_attr_list_builder_append (VogueAttrListBuilder *builder,
+                                                      VogueAttribute       *attr);
+PANGO_AVAILABLE_IN_1_46
+VogueAttrList *       vogue_attr_list_builder_end    (VogueAttrListBuilder *builder);
+PANGO_AVAILABLE_IN_1_46
+void                  vogue_attr_list_builder_free   (VogueAttrListBuilder *builder);
+
 PANGO_AVAILABLE_IN_1_44
 GType              vogue_attr_iterator_get_type  (void) G_GNUC_CONST;
 
@@ -629,8 +653,39 @@ gboolean vogue_parse_markup (const char                 *markup_text,
 			     gunichar                   *accel_char,
 			     GError                    **error);
 
+PANGO_AVAILABLE_IN_1_46
+void     vogue_markup_cache_set_max_entries (guint           max_entries);
+PANGO_AVAILABLE_IN_1_46
+void     vogue_markup_cache_get_stats       (guint          *hits,
+                                             guint          *misses,
+                                             guint          *evictions);
+
 PANGO_AVAILABLE_IN_1_32
 GMarkupParseContext * vogue_markup_parser_new (gunichar               accel_marker);
+/**
+ * VogueMarkupParagraphFunc:
+ * @text: the text of the paragraph, including its delimiter. It is
+ *   not nul-terminated and is only valid during the call.
+ * @length: the length of @text in bytes
+ * @attr_list: the attributes of the paragraph, with indices relative
+ *   to the start of @text
+ * @user_data: user data passed to vogue_markup_parser_new_streaming()
+ *
+ * Type of the function that a streaming markup parser calls for each
+ * paragraph. See vogue_markup_parser_new_streaming().
+ *
+ * Since: 1.46
+ **/
+typedef void (*VogueMarkupParagraphFunc) (const char    *text,
+                                          int            length,
+                                          VogueAttrList *attr_list,
+                                          gpointer       user_data);
+
+PANGO_AVAILABLE_IN_1_46
+GMarkupParseContext * vogue_markup_parser_new_streaming (gunichar                 accel_marker,
+                                                         VogueMarkupParagraphFunc func,
+                                                         gpointer                 user_data,
+                                                         GDestroyNotify           destroy);
 PANGO_AVAILABLE_IN_1_32
 gboolean              vogue_markup_parser_finish (GMarkupParseContext   *context,
                                                   VogueAttrList        **attr_list,
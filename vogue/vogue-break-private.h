@@ -0,0 +1,131 @@
+/* Vogue
+ * vogue-break-private.h: Breaking routines, private definitions
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.	 See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+#ifndef __PANGO_BREAK_PRIVATE_H__
+#define __PANGO_BREAK_PRIVATE_H__
+
+#include <vogue/vogue-break.h>
+#include <string.h>
+
+#if defined (__AVX2__)
+#include <immintrin.h>
+#elif defined (__SSE2__)
+#include <emmintrin.h>
+#endif
+
+G_BEGIN_DECLS
+
+void _vogue_default_break_with_flags (const gchar       *text,
+                                      gint               length,
+                                      VogueLogAttr      *attrs,
+                                      VogueLogAttrFlags  flags);
+
+void _vogue_log_attrs_complete       (const char        *text,
+                                      int                length,
+                                      VogueLogAttrFlags  flags,
+                                      VogueLogAttr      *log_attrs,
+                                      int                attrs_len);
+
+/* Returns the first byte in [@p, @end) that can start a paragraph
+ * separator: \n, \r, or the lead byte of U+2029, or @end if there
+ * is none. With @stop_at_non_ascii, any byte outside of ASCII ends
+ * the scan too, so that everything before the result is plain ASCII
+ * text. This looks at 32 bytes at a time with AVX2, 16 with SSE2,
+ * or 8 elsewhere, which makes it memory bound for long texts.
+ */
+static inline const char *
+_vogue_find_separator_candidate (const char *p,
+                                 const char *end,
+                                 gboolean    stop_at_non_ascii)
+{
+#if defined (__AVX2__)
+  const __m256i nl = _mm256_set1_epi8 ('\n');
+  const __m256i cr = _mm256_set1_epi8 ('\r');
+  const __m256i ps = _mm256_set1_epi8 ((char) 0xE2);
+
+  while (end - p >= 32)
+    {
+      __m256i v = _mm256_loadu_si256 ((const __m256i *) p);
+      __m256i m = _mm256_or_si256 (_mm256_or_si256 (_mm256_cmpeq_epi8 (v, nl),
+                                                    _mm256_cmpeq_epi8 (v, cr)),
+                                   _mm256_cmpeq_epi8 (v, ps));
+      guint32 mask = (guint32) _mm256_movemask_epi8 (m);
+
+      if (stop_at_non_ascii)
+        mask |= (guint32) _mm256_movemask_epi8 (v);
+
+      if (mask)
+        return p + g_bit_nth_lsf (mask, -1);
+
+      p += 32;
+    }
+#elif defined (__SSE2__)
+  const __m128i nl = _mm_set1_epi8 ('\n');
+  const __m128i cr = _mm_set1_epi8 ('\r');
+  const __m128i ps = _mm_set1_epi8 ((char) 0xE2);
+
+  while (end - p >= 16)
+    {
+      __m128i v = _mm_loadu_si128 ((const __m128i *) p);
+      __m128i m = _mm_or_si128 (_mm_or_si128 (_mm_cmpeq_epi8 (v, nl),
+                                              _mm_cmpeq_epi8 (v, cr)),
+                                _mm_cmpeq_epi8 (v, ps));
+      int mask = _mm_movemask_epi8 (m);
+
+      if (stop_at_non_ascii)
+        mask |= _mm_movemask_epi8 (v);
+
+      if (mask)
+        return p + g_bit_nth_lsf (mask, -1);
+
+      p += 16;
+    }
+#else
+#define ONES G_GUINT64_CONSTANT (0x0101010101010101)
+#define HAS_ZERO_BYTE(x) (((x) - ONES) & ~(x) & (ONES * 0x80))
+
+  while (end - p >= 8)
+    {
+      guint64 w;
+
+      memcpy (&w, p, 8);
+      if (HAS_ZERO_BYTE (w ^ (ONES * '\n')) |
+          HAS_ZERO_BYTE (w ^ (ONES * '\r')) |
+          HAS_ZERO_BYTE (w ^ (ONES * 0xE2)) |
+          (stop_at_non_ascii ? w & (ONES * 0x80) : 0))
+        break;
+
+      p += 8;
+    }
+
+#undef HAS_ZERO_BYTE
+#undef ONES
+#endif
+
+  for (; p < end; p++)
+    if (*p == '\n' || *p == '\r' || (guchar) *p == 0xE2 ||
+        (stop_at_non_ascii && (guchar) *p >= 0x80))
+      return p;
+
+  return end;
+}
+
+G_END_DECLS
+
+#endif /* __PANGO_BREAK_PRIVATE_H__ */
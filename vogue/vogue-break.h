@@ -113,6 +113,13 @@ void vogue_find_paragraph_boundary (const gchar *text,
 				    gint        *paragraph_delimiter_index,
 				    gint        *next_paragraph_start);
 
+PANGO_AVAILABLE_IN_1_46
+void vogue_find_paragraph_boundaries (const char  *text,
+                                      int          length,
+                                      int        **delimiter_indices,
+                                      int        **paragraph_starts,
+                                      int         *n_paragraphs);
+
 PANGO_AVAILABLE_IN_ALL
 void vogue_get_log_attrs (const char    *text,
 			  int            length,
@@ -121,6 +128,63 @@ void vogue_get_log_attrs (const char    *text,
 			  VogueLogAttr  *log_attrs,
 			  int            attrs_len);
 
+/**
+ * VogueLogAttrFlags:
+ * @PANGO_LOG_ATTR_LINE_BREAKS: Line and character breaks, whitespace,
+ *     cursor positions and expandable spaces. These are always computed.
+ * @PANGO_LOG_ATTR_BACKSPACE: The @backspace_deletes_character field.
+ * @PANGO_LOG_ATTR_WORDS: Word starts, ends and boundaries.
+ * @PANGO_LOG_ATTR_SENTENCES: Sentence starts, ends and boundaries.
+ * @PANGO_LOG_ATTR_ALL: All of the above.
+ *
+ * Flags selecting which groups of #VogueLogAttr fields
+ * vogue_get_log_attrs_with_flags() computes.
+ *
+ * Since: 1.46
+ */
+typedef enum {
+  PANGO_LOG_ATTR_LINE_BREAKS = 1 << 0,
+  PANGO_LOG_ATTR_BACKSPACE   = 1 << 1,
+  PANGO_LOG_ATTR_WORDS       = 1 << 2,
+  PANGO_LOG_ATTR_SENTENCES   = 1 << 3,
+  PANGO_LOG_ATTR_ALL         = 0xf
+} VogueLogAttrFlags;
+
+PANGO_AVAILABLE_IN_1_46
+void vogue_get_log_attrs_with_flags (const char        *text,
+                                     int                length,
+                                     int                level,
+                                     VogueLanguage     *language,
+                                     VogueLogAttrFlags  flags,
+                                     VogueLogAttr      *log_attrs,
+                                     int                attrs_len);
+
+PANGO_AVAILABLE_IN_1_46
+GThreadPool *vogue_log_attrs_thread_pool_new (int max_threads);
+
+PANGO_AVAILABLE_IN_1_46
+void vogue_get_log_attrs_parallel (const char        *text,
+                                   int                length,
+                                   int                level,
+                                   VogueLanguage     *language,
+                                   VogueLogAttrFlags  flags,
+                                   VogueLogAttr      *log_attrs,
+                                   int                attrs_len,
+                                   GThreadPool       *pool);
+
+PANGO_AVAILABLE_IN_1_46
+void vogue_log_attrs_update (const char    *text,
+                             int            length,
+                             int            level,
+                             VogueLanguage *language,
+                             int            edit_start,
+                             int            edit_offset,
+                             int            n_removed,
+                             int            new_length,
+                             VogueLogAttr  *log_attrs,
+                             int            attrs_len,
+                             int           *n_attrs);
+
 /* This is the default break algorithm, used if no language
  * engine overrides it. Normally you should use vogue_break()
  * instead; this function is mostly useful for chaining up
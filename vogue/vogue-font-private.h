@@ -33,6 +33,9 @@ G_BEGIN_DECLS
 PANGO_AVAILABLE_IN_ALL
 VogueFontMetrics *vogue_font_metrics_new (void);
 
+PANGO_AVAILABLE_IN_ALL
+const char *vogue_font_description_get_variations_key (const VogueFontDescription *desc);
+
 struct _VogueFontMetrics
 {
   /* <private> */
@@ -520,6 +520,14 @@ void                  vogue_font_get_features      (VogueFont        *font,
                                                     guint            *num_features);
 PANGO_AVAILABLE_IN_1_44
 hb_font_t *           vogue_font_get_hb_font       (VogueFont        *font);
+PANGO_AVAILABLE_IN_1_46
+void                  vogue_font_get_glyph_advances (VogueFont        *font,
+                                                     const VogueGlyph *glyphs,
+                                                     guint             n_glyphs,
+                                                     int              *advances);
+PANGO_AVAILABLE_IN_1_46
+int                   vogue_font_get_glyph_advance  (VogueFont        *font,
+                                                     VogueGlyph        glyph);
 
 
 /**
@@ -227,6 +227,23 @@ void vogue_shape_with_flags (const char          *item_text,
                              VogueGlyphString    *glyphs,
                              VogueShapeFlags      flags);
 
+PANGO_AVAILABLE_IN_1_46
+GThreadPool *vogue_shape_thread_pool_new (int max_threads);
+
+PANGO_AVAILABLE_IN_1_46
+void vogue_shape_items (VogueItem         **items,
+                        guint               n_items,
+                        const char         *text,
+                        int                 length,
+                        VogueGlyphString  **glyphs,
+                        VogueShapeFlags     flags,
+                        GThreadPool        *pool);
+
+PANGO_AVAILABLE_IN_1_46
+void vogue_shape_plan_cache_get_stats (guint *hits,
+                                       guint *misses,
+                                       guint *evictions);
+
 PANGO_AVAILABLE_IN_ALL
 GList *vogue_reorder_items (GList *logical_items);
 
@@ -28,6 +28,7 @@
 
 #include "vogue-language.h"
 #include "vogue-impl-utils.h"
+#include "voguehb-private.h"
 
 #ifdef HAVE_CORE_TEXT
 #include <CoreFoundation/CoreFoundation.h>
@@ -41,6 +42,7 @@
 typedef struct {
   gconstpointer lang_info;
   gconstpointer script_for_lang;
+  gpointer hb_language;
 
   int magic; /* Used for verification */
 } VogueLanguagePrivate;
@@ -54,6 +56,7 @@ vogue_language_private_init (VogueLanguagePrivate *priv)
 
   priv->lang_info = (gconstpointer) -1;
   priv->script_for_lang = (gconstpointer) -1;
+  priv->hb_language = (gpointer) -1;
 }
 
 static VogueLanguagePrivate * vogue_language_get_private (VogueLanguage *language) G_GNUC_CONST;
@@ -385,6 +388,34 @@ const char *
   return vogue_language_to_string (language);
 }
 
+/*
+ * vogue_language_get_hb_language:
+ * @language: (nullable): a language tag
+ *
+ * Returns the HarfBuzz language corresponding to @language.
+ * The conversion is done once per #VogueLanguage and cached,
+ * since hb_language_from_string() takes a global lock.
+ */
+hb_language_t
+vogue_language_get_hb_language (VogueLanguage *language)
+{
+  VogueLanguagePrivate *priv = vogue_language_get_private (language);
+  gpointer hb_language;
+
+  if (G_UNLIKELY (!priv))
+    return hb_language_from_string (vogue_language_to_string (language), -1);
+
+  hb_language = g_atomic_pointer_get (&priv->hb_language);
+  if (G_UNLIKELY (hb_language == (gpointer) -1))
+    {
+      /* Racing threads compute the same value, so a plain store is fine */
+      hb_language = (gpointer) hb_language_from_string (vogue_language_to_string (language), -1);
+      g_atomic_pointer_set (&priv->hb_language, hb_language);
+    }
+
+  return (hb_language_t) hb_language;
+}
+
 /**
  * vogue_language_matches:
  * @language: (nullable): a language tag (see vogue_language_from_string()),
@@ -42,6 +42,8 @@ struct _VogueLayout
 
   /* Dupped */
   gchar *text;
+  int *paragraph_bounds;	/* delimiter index and next paragraph start, per delimiter */
+  int n_paragraph_bounds;
 
   /* Value fields.  These will be memcpy'd in _copy() */
   int copy_begin;
@@ -79,6 +81,7 @@ struct _VogueLayout
   /* Not copied during _copy() */
 
   VogueLogAttr *log_attrs;	/* Logical attributes for layout's text */
+  guint log_attrs_complete : 1;	/* Whether word, sentence and backspace attributes are set */
   GSList *lines;
   guint line_count;		/* Number of lines in @lines. 0 if lines is %NULL */
 };
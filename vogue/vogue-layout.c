@@ -71,6 +71,8 @@
 #include "config.h"
 #include "vogue-glyph.h"		/* For vogue_shape() */
 #include "vogue-break.h"
+#include "vogue-break-private.h"
+#include "vogue-attributes-private.h"
 #include "vogue-item.h"
 #include "vogue-engine.h"
 #include "vogue-impl-utils.h"
@@ -234,6 +236,7 @@ vogue_layout_finalize (GObject *object)
     vogue_attr_list_unref (layout->attrs);
 
   g_free (layout->text);
+  g_free (layout->paragraph_bounds);
 
   if (layout->font_desc)
     vogue_font_description_free (layout->font_desc);
@@ -303,6 +306,9 @@ vogue_layout_copy (VogueLayout *src)
 
   /* Dupped */
   layout->text = g_strdup (src->text);
+  layout->paragraph_bounds = g_memdup (src->paragraph_bounds,
+                                       2 * src->n_paragraph_bounds * sizeof (int));
+  layout->n_paragraph_bounds = src->n_paragraph_bounds;
 
   /* Value fields */
   memcpy (&layout->copy_begin, &src->copy_begin,
@@ -1068,6 +1074,160 @@ vogue_layout_is_ellipsized (VogueLayout *layout)
   return layout->is_ellipsized;
 }
 
+/* Appends the paragraph delimiter at @index, @len bytes long, to
+ * @bounds, merging a \n into a \r just before it.
+ */
+static inline void
+add_paragraph_delimiter (GArray     *bounds,
+                         const char *text,
+                         int         index,
+                         int         len)
+{
+  int bound[2];
+
+  if (text[index] == '\n' && bounds->len > 0 && text[index - 1] == '\r' &&
+      g_array_index (bounds, int, bounds->len - 1) == index)
+    {
+      g_array_index (bounds, int, bounds->len - 1)++;
+      return;
+    }
+
+  bound[0] = index;
+  bound[1] = index + len;
+  g_array_append_vals (bounds, bound, 2);
+}
+
+/* Returns the length of the valid UTF-8 character at @p, or 0 if
+ * the bytes at @p are not a valid character. Like g_utf8_validate(),
+ * this rejects overlong forms, surrogates and values past U+10FFFF.
+ */
+static inline int
+utf8_valid_char_len (const guchar *p,
+                     const guchar *end)
+{
+  guchar c = p[0];
+
+  if (c < 0xC2)
+    return 0;
+
+  if (c < 0xE0)
+    {
+      if (end - p < 2 || (p[1] & 0xC0) != 0x80)
+        return 0;
+      return 2;
+    }
+
+  if (c < 0xF0)
+    {
+      if (end - p < 3 || (p[1] & 0xC0) != 0x80 || (p[2] & 0xC0) != 0x80)
+        return 0;
+      if ((c == 0xE0 && p[1] < 0xA0) ||  /* overlong */
+          (c == 0xED && p[1] > 0x9F))    /* surrogate */
+        return 0;
+      return 3;
+    }
+
+  if (c < 0xF5)
+    {
+      if (end - p < 4 || (p[1] & 0xC0) != 0x80 ||
+          (p[2] & 0xC0) != 0x80 || (p[3] & 0xC0) != 0x80)
+        return 0;
+      if ((c == 0xF0 && p[1] < 0x90) ||  /* overlong */
+          (c == 0xF4 && p[1] > 0x8F))    /* > U+10FFFF */
+        return 0;
+      return 4;
+    }
+
+  return 0;
+}
+
+/* Validates @text in place, counts its characters and records the
+ * paragraph delimiters in @bounds, all in one pass. Invalid bytes are
+ * replaced with -1. The -1 will be converted to ((gunichar) -1) by
+ * glib, and that in turn yields a glyph value of ((VogueGlyph) -1) by
+ * PANGO_GET_UNKNOWN_GLYPH(-1), and that's PANGO_GLYPH_INVALID_INPUT.
+ *
+ * Returns: %FALSE if any bytes were replaced
+ */
+static gboolean
+scan_text (char   *text,
+           int     length,
+           int    *n_chars,
+           GArray *bounds)
+{
+  const guchar *p = (const guchar *) text;
+  const guchar *end = p + length;
+  gboolean valid = TRUE;
+  int n = 0;
+
+  while (p < end)
+    {
+      const guchar *q;
+      int len;
+
+      /* Skip over runs of plain ASCII text in bulk */
+      q = (const guchar *) _vogue_find_separator_candidate ((const char *) p,
+                                                            (const char *) end,
+                                                            TRUE);
+      n += q - p;
+      p = q;
+
+      if (p == end)
+        break;
+
+      if (*p == '\n' || *p == '\r')
+        {
+          add_paragraph_delimiter (bounds, text, (const char *) p - text, 1);
+          n++;
+          p++;
+          continue;
+        }
+
+      len = utf8_valid_char_len (p, end);
+      if (len == 0)
+        {
+          *(char *) p = -1;
+          valid = FALSE;
+          len = 1;
+        }
+      else if (len == 3 && p[0] == 0xE2 && p[1] == 0x80 && p[2] == 0xA9)
+        add_paragraph_delimiter (bounds, text, (const char *) p - text, 3);
+
+      n++;
+      p += len;
+    }
+
+  *n_chars = n;
+
+  return valid;
+}
+
+/* Looks up the boundaries of the paragraph starting at @start, which
+ * is paragraph number @para, among the delimiters recorded by
+ * vogue_layout_set_text(). The results are relative to @start, like
+ * those of vogue_find_paragraph_boundary().
+ */
+static void
+get_paragraph_boundary (VogueLayout *layout,
+                        int          para,
+                        const char  *start,
+                        int         *delimiter_index,
+                        int         *next_para_index)
+{
+  int offset = start - layout->text;
+
+  if (layout->single_paragraph || para >= layout->n_paragraph_bounds)
+    {
+      *delimiter_index = layout->length - offset;
+      *next_para_index = layout->length - offset;
+    }
+  else
+    {
+      *delimiter_index = layout->paragraph_bounds[2 * para] - offset;
+      *next_para_index = layout->paragraph_bounds[2 * para + 1] - offset;
+    }
+}
+
 /**
  * vogue_layout_set_text:
  * @layout: a #VogueLayout
@@ -1094,7 +1254,8 @@ vogue_layout_set_text (VogueLayout *layout,
 		       const char  *text,
 		       int          length)
 {
-  char *old_text, *start, *end;
+  char *old_text;
+  GArray *bounds;
 
   g_return_if_fail (layout != NULL);
   g_return_if_fail (length == 0 || text != NULL);
@@ -1102,42 +1263,30 @@ vogue_layout_set_text (VogueLayout *layout,
   old_text = layout->text;
 
   if (length < 0)
-    layout->text = g_strdup (text);
+    length = strlen (text);
   else if (length > 0)
-    /* This is not exactly what we want.  We don't need the padding...
-     */
-    layout->text = g_strndup (text, length);
-  else
-    layout->text = g_malloc0 (1);
-
-  layout->length = strlen (layout->text);
-
-  /* validate it, and replace invalid bytes with -1 */
-  start = layout->text;
-  for (;;) {
-    gboolean valid;
-
-    valid = g_utf8_validate (start, -1, (const char **)&end);
+    {
+      const char *nul = memchr (text, '\0', length);
+      if (nul)
+        length = nul - text;
+    }
 
-    if (!*end)
-      break;
+  layout->text = g_malloc (length + 1);
+  if (length > 0)
+    memcpy (layout->text, text, length);
+  layout->text[length] = '\0';
+  layout->length = length;
 
-    /* Replace invalid bytes with -1.  The -1 will be converted to
-     * ((gunichar) -1) by glib, and that in turn yields a glyph value of
-     * ((VogueGlyph) -1) by PANGO_GET_UNKNOWN_GLYPH(-1),
-     * and that's PANGO_GLYPH_INVALID_INPUT.
-     */
-    if (!valid)
-      *end++ = -1;
+  bounds = g_array_new (FALSE, FALSE, sizeof (int));
 
-    start = end;
-  }
-
-  if (start != layout->text)
+  /* validate it, count the characters and find the paragraphs in one go */
+  if (!scan_text (layout->text, layout->length, &layout->n_chars, bounds))
     /* TODO: Write out the beginning excerpt of text? */
     g_warning ("Invalid UTF-8 string passed to vogue_layout_set_text()");
 
-  layout->n_chars = vogue_utf8_strlen (layout->text, -1);
+  g_free (layout->paragraph_bounds);
+  layout->n_paragraph_bounds = bounds->len / 2;
+  layout->paragraph_bounds = (int *) g_array_free (bounds, FALSE);
 
   layout_changed (layout);
 
@@ -1382,6 +1531,52 @@ vogue_layout_get_serial (VogueLayout *layout)
   return layout->serial;
 }
 
+/* vogue_layout_check_lines() only computes the attributes needed
+ * for line breaking; fill in the rest the first time someone asks.
+ */
+static void
+ensure_complete_log_attrs (VogueLayout *layout)
+{
+  const char *start;
+  int start_offset;
+  int para = 0;
+  gboolean done = FALSE;
+
+  if (layout->log_attrs_complete)
+    return;
+
+  start = layout->text;
+  start_offset = 0;
+
+  do
+    {
+      int delimiter_index, next_para_index;
+      int n_chars;
+
+      get_paragraph_boundary (layout, para++, start,
+                              &delimiter_index, &next_para_index);
+
+      if (start + delimiter_index == layout->text + layout->length)
+        done = TRUE;
+
+      n_chars = vogue_utf8_strlen (start, next_para_index);
+
+      _vogue_log_attrs_complete (start,
+                                 next_para_index,
+                                 PANGO_LOG_ATTR_BACKSPACE |
+                                 PANGO_LOG_ATTR_WORDS |
+                                 PANGO_LOG_ATTR_SENTENCES,
+                                 layout->log_attrs + start_offset,
+                                 n_chars + 1);
+
+      start_offset += n_chars;
+      start += next_para_index;
+    }
+  while (!done);
+
+  layout->log_attrs_complete = TRUE;
+}
+
 /**
  * vogue_layout_get_log_attrs:
  * @layout: a #VogueLayout
@@ -1405,6 +1600,7 @@ vogue_layout_get_log_attrs (VogueLayout    *layout,
   g_return_if_fail (layout != NULL);
 
   vogue_layout_check_lines (layout);
+  ensure_complete_log_attrs (layout);
 
   if (attrs)
     {
@@ -1447,6 +1643,7 @@ vogue_layout_get_log_attrs_readonly (VogueLayout *layout,
   g_return_val_if_fail (layout != NULL, NULL);
 
   vogue_layout_check_lines (layout);
+  ensure_complete_log_attrs (layout);
 
   if (n_attrs)
     *n_attrs = layout->n_chars + 1;
@@ -3546,7 +3743,7 @@ find_hyphen_width (VogueItem *item)
   hb_font = vogue_font_get_hb_font (item->analysis.font);
   if (hb_font_get_nominal_glyph (hb_font, 0x2010, &glyph) ||
       hb_font_get_nominal_glyph (hb_font, '-', &glyph))
-    return hb_font_get_glyph_h_advance (hb_font, glyph);
+    return vogue_font_get_glyph_advance (item->analysis.font, glyph);
 
   return 0;
 }
@@ -4014,16 +4211,19 @@ process_line (VogueLayout    *layout,
 
 static void
 get_items_log_attrs (const char   *text,
+                     int           start,
                      int           length,
 		     GList        *items,
 		     VogueLogAttr *log_attrs,
-                     int           log_attrs_len)
+                     int           log_attrs_len G_GNUC_UNUSED)
 {
   int offset = 0;
-  int num_chars = 0;
   GList *l;
 
-  vogue_default_break (text, length, NULL, log_attrs, log_attrs_len);
+  /* Laying out only needs line breaks; the rest is
+   * filled in by ensure_complete_log_attrs() on demand.
+   */
+  _vogue_default_break_with_flags (text + start, length, log_attrs, PANGO_LOG_ATTR_LINE_BREAKS);
 
   for (l = items; l; l = l->next)
     {
@@ -4036,7 +4236,7 @@ get_items_log_attrs (const char   *text,
                           log_attrs + offset,
                           item->num_chars + 1);
 
-      offset += num_chars;
+      offset += item->num_chars;
     }
 }
 
@@ -4065,55 +4265,56 @@ vogue_layout_get_effective_attributes (VogueLayout *layout)
   return attrs;
 }
 
-static gboolean
-affects_itemization (VogueAttribute *attr,
-                     gpointer        data)
-{
-  switch (attr->klass->type)
-    {
-    /* These affect font selection */
-    case PANGO_ATTR_LANGUAGE:
-    case PANGO_ATTR_FAMILY:
-    case PANGO_ATTR_STYLE:
-    case PANGO_ATTR_WEIGHT:
-    case PANGO_ATTR_VARIANT:
-    case PANGO_ATTR_STRETCH:
-    case PANGO_ATTR_SIZE:
-    case PANGO_ATTR_FONT_DESC:
-    case PANGO_ATTR_SCALE:
-    case PANGO_ATTR_FALLBACK:
-    case PANGO_ATTR_ABSOLUTE_SIZE:
-    case PANGO_ATTR_GRAVITY:
-    case PANGO_ATTR_GRAVITY_HINT:
-    /* These are part of ItemProperties, so need to break runs */
-    case PANGO_ATTR_SHAPE:
-    case PANGO_ATTR_RISE:
-    case PANGO_ATTR_UNDERLINE:
-    case PANGO_ATTR_STRIKETHROUGH:
-    case PANGO_ATTR_LETTER_SPACING:
-      return TRUE;
-    default:
-      return FALSE;
-    }
-}
-
-static gboolean
-affects_break_or_shape (VogueAttribute *attr,
-                        gpointer        data)
+/* Collects the attributes that the layout adds in front of
+ * layout->attrs into @attrs, which must have room for two.
+ * The order matches vogue_layout_get_effective_attributes().
+ */
+static guint
+get_layout_attributes (VogueLayout     *layout,
+                       VogueAttribute **attrs)
 {
-  switch (attr->klass->type)
-    {
-    /* Affects breaks */
-    case PANGO_ATTR_ALLOW_BREAKS:
-    /* Affects shaping */
-    case PANGO_ATTR_INSERT_HYPHENS:
-    case PANGO_ATTR_FONT_FEATURES:
-    case PANGO_ATTR_SHOW:
-      return TRUE;
-    default:
-      return FALSE;
-    }
-}
+  guint n = 0;
+
+  if (layout->single_paragraph)
+    attrs[n++] = vogue_attr_show_new (PANGO_SHOW_LINE_BREAKS);
+
+  if (layout->font_desc)
+    attrs[n++] = vogue_attr_font_desc_new (layout->font_desc);
+
+  return n;
+}
+
+/* Attributes that affect itemization */
+#define ITEMIZE_ATTR_MASK \
+  (/* These affect font selection */ \
+   PANGO_ATTR_TYPE_MASK (PANGO_ATTR_LANGUAGE) | \
+   PANGO_ATTR_TYPE_MASK (PANGO_ATTR_FAMILY) | \
+   PANGO_ATTR_TYPE_MASK (PANGO_ATTR_STYLE) | \
+   PANGO_ATTR_TYPE_MASK (PANGO_ATTR_WEIGHT) | \
+   PANGO_ATTR_TYPE_MASK (PANGO_ATTR_VARIANT) | \
+   PANGO_ATTR_TYPE_MASK (PANGO_ATTR_STRETCH) | \
+   PANGO_ATTR_TYPE_MASK (PANGO_ATTR_SIZE) | \
+   PANGO_ATTR_TYPE_MASK (PANGO_ATTR_FONT_DESC) | \
+   PANGO_ATTR_TYPE_MASK (PANGO_ATTR_SCALE) | \
+   PANGO_ATTR_TYPE_MASK (PANGO_ATTR_FALLBACK) | \
+   PANGO_ATTR_TYPE_MASK (PANGO_ATTR_ABSOLUTE_SIZE) | \
+   PANGO_ATTR_TYPE_MASK (PANGO_ATTR_GRAVITY) | \
+   PANGO_ATTR_TYPE_MASK (PANGO_ATTR_GRAVITY_HINT) | \
+   /* These are part of ItemProperties, so need to break runs */ \
+   PANGO_ATTR_TYPE_MASK (PANGO_ATTR_SHAPE) | \
+   PANGO_ATTR_TYPE_MASK (PANGO_ATTR_RISE) | \
+   PANGO_ATTR_TYPE_MASK (PANGO_ATTR_UNDERLINE) | \
+   PANGO_ATTR_TYPE_MASK (PANGO_ATTR_STRIKETHROUGH) | \
+   PANGO_ATTR_TYPE_MASK (PANGO_ATTR_LETTER_SPACING))
+
+/* Attributes that affect breaking or shaping */
+#define BREAK_OR_SHAPE_ATTR_MASK \
+  (/* Affects breaks */ \
+   PANGO_ATTR_TYPE_MASK (PANGO_ATTR_ALLOW_BREAKS) | \
+   /* Affects shaping */ \
+   PANGO_ATTR_TYPE_MASK (PANGO_ATTR_INSERT_HYPHENS) | \
+   PANGO_ATTR_TYPE_MASK (PANGO_ATTR_FONT_FEATURES) | \
+   PANGO_ATTR_TYPE_MASK (PANGO_ATTR_SHOW))
 
 static void
 apply_attributes_to_items (GList         *items,
@@ -4177,6 +4378,9 @@ vogue_layout_check_lines (VogueLayout *layout)
   const char *start;
   gboolean done = FALSE;
   int start_offset;
+  int para = 0;
+  VogueAttribute *layout_attrs[2];
+  guint n_layout_attrs;
   VogueAttrList *attrs;
   VogueAttrList *itemize_attrs;
   VogueAttrList *shape_attrs;
@@ -4197,16 +4401,22 @@ vogue_layout_check_lines (VogueLayout *layout)
   if (G_UNLIKELY (!layout->text))
     vogue_layout_set_text (layout, NULL, 0);
 
-  attrs = vogue_layout_get_effective_attributes (layout);
+  /* Split the attributes by what they affect, without copying them */
+  n_layout_attrs = get_layout_attributes (layout, layout_attrs);
 
-  shape_attrs = vogue_attr_list_filter (attrs, affects_break_or_shape, NULL);
-  itemize_attrs = vogue_attr_list_filter (attrs, affects_itemization, NULL);
+  shape_attrs = _vogue_attr_list_new_view (layout->attrs, layout_attrs, n_layout_attrs,
+                                           BREAK_OR_SHAPE_ATTR_MASK);
+  itemize_attrs = _vogue_attr_list_new_view (layout->attrs, layout_attrs, n_layout_attrs,
+                                             ITEMIZE_ATTR_MASK);
+  attrs = _vogue_attr_list_new_view (layout->attrs, layout_attrs, n_layout_attrs,
+                                     ~(BREAK_OR_SHAPE_ATTR_MASK | ITEMIZE_ATTR_MASK));
   if (itemize_attrs)
     iter = vogue_attr_list_get_iterator (itemize_attrs);
   else
     iter = NULL;
 
   layout->log_attrs = g_new (VogueLogAttr, layout->n_chars + 1);
+  layout->log_attrs_complete = FALSE;
 
   start_offset = 0;
   start = layout->text;
@@ -4237,18 +4447,8 @@ vogue_layout_check_lines (VogueLayout *layout)
       const char *end;
       int delimiter_index, next_para_index;
 
-      if (layout->single_paragraph)
-	{
-	  delimiter_index = layout->length;
-	  next_para_index = layout->length;
-	}
-      else
-	{
-	  vogue_find_paragraph_boundary (start,
-					 (layout->text + layout->length) - start,
-					 &delimiter_index,
-					 &next_para_index);
-	}
+      get_paragraph_boundary (layout, para++, start,
+                              &delimiter_index, &next_para_index);
 
       g_assert (next_para_index >= delimiter_index);
 
@@ -4286,7 +4486,8 @@ vogue_layout_check_lines (VogueLayout *layout)
 
       apply_attributes_to_items (state.items, shape_attrs);
 
-      get_items_log_attrs (start,
+      get_items_log_attrs (layout->text,
+                           start - layout->text,
                            delimiter_index + delim_len,
                            state.items,
 			   layout->log_attrs + start_offset,
@@ -4350,6 +4551,9 @@ vogue_layout_check_lines (VogueLayout *layout)
 
   if (attrs)
     vogue_attr_list_unref (attrs);
+
+  while (n_layout_attrs > 0)
+    vogue_attribute_destroy (layout_attrs[--n_layout_attrs]);
 }
 
 #pragma GCC diagnostic pop
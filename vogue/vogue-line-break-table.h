@@ -0,0 +1,1205 @@
+/* == Start of generated table == */
+/*
+ * The following tables are generated by running:
+ *
+ *   ./gen-line-break-table.py > vogue-line-break-table.h
+ *
+ * Each entry holds the BreakOpportunity of the highest-ranked
+ * UAX #14 pair rule that applies in its low two bits, and the
+ * rank of that rule in the remaining bits.
+ */
+
+#ifndef PANGO_LINE_BREAK_TABLE_H
+#define PANGO_LINE_BREAK_TABLE_H
+
+#include <glib.h>
+
+#define LINE_BREAK_N_CLASSES (G_UNICODE_BREAK_ZERO_WIDTH_JOINER + 1)
+
+#define LINE_BREAK_OP(entry)   ((entry) & 3)
+#define LINE_BREAK_RANK(entry) ((entry) >> 2)
+
+/* Ranks of the rules that need more context than a pair of classes */
+#define LINE_BREAK_RANK_LB30A_RI                3 /* regional indicator pairs */
+#define LINE_BREAK_RANK_LB25_PREFIX_NUMERIC    13 /* (PR | PO) x (OP | HY) NU */
+#define LINE_BREAK_RANK_LB25_NUMERIC           16 /* NU (SY | IS)* x (NU | SY | IS | CL | CP) */
+#define LINE_BREAK_RANK_LB25_NUMERIC_POSTFIX   17 /* NU (SY | IS)* (CL | CP)? x (PO | PR) */
+#define LINE_BREAK_RANK_LB21A                  26 /* HL (HY | BA) x */
+#define LINE_BREAK_RANK_LB8A                   42 /* ZWJ x */
+
+/* Indexed by the previous and current class, for a previous class other than SP */
+static const guint8 _vogue_line_break_pair_table[LINE_BREAK_N_CLASSES][LINE_BREAK_N_CLASSES] = {
+  [G_UNICODE_BREAK_MANDATORY] = {
+    [G_UNICODE_BREAK_MANDATORY] = 0xB1, [G_UNICODE_BREAK_CARRIAGE_RETURN] = 0xB1, [G_UNICODE_BREAK_LINE_FEED] = 0xB1,
+    [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = 0xAD, [G_UNICODE_BREAK_NON_BREAKING_GLUE] = 0x99, [G_UNICODE_BREAK_CONTINGENT] = 0x73,
+    [G_UNICODE_BREAK_SPACE] = 0xAD, [G_UNICODE_BREAK_AFTER] = 0x65, [G_UNICODE_BREAK_HYPHEN] = 0x65,
+    [G_UNICODE_BREAK_NON_STARTER] = 0x65, [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = 0x91, [G_UNICODE_BREAK_QUOTATION] = 0x75,
+    [G_UNICODE_BREAK_EXCLAMATION] = 0x8D, [G_UNICODE_BREAK_INFIX_SEPARATOR] = 0x91, [G_UNICODE_BREAK_SYMBOL] = 0x91,
+    [G_UNICODE_BREAK_NEXT_LINE] = 0xB1, [G_UNICODE_BREAK_WORD_JOINER] = 0x9D, [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = 0x91,
+  },
+  [G_UNICODE_BREAK_CARRIAGE_RETURN] = {
+    [G_UNICODE_BREAK_MANDATORY] = 0xB1, [G_UNICODE_BREAK_CARRIAGE_RETURN] = 0xB1, [G_UNICODE_BREAK_LINE_FEED] = 0xB1,
+    [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = 0xAD, [G_UNICODE_BREAK_NON_BREAKING_GLUE] = 0x99, [G_UNICODE_BREAK_CONTINGENT] = 0x73,
+    [G_UNICODE_BREAK_SPACE] = 0xAD, [G_UNICODE_BREAK_AFTER] = 0x65, [G_UNICODE_BREAK_HYPHEN] = 0x65,
+    [G_UNICODE_BREAK_NON_STARTER] = 0x65, [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = 0x91, [G_UNICODE_BREAK_QUOTATION] = 0x75,
+    [G_UNICODE_BREAK_EXCLAMATION] = 0x8D, [G_UNICODE_BREAK_INFIX_SEPARATOR] = 0x91, [G_UNICODE_BREAK_SYMBOL] = 0x91,
+    [G_UNICODE_BREAK_NEXT_LINE] = 0xB1, [G_UNICODE_BREAK_WORD_JOINER] = 0x9D, [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = 0x91,
+  },
+  [G_UNICODE_BREAK_LINE_FEED] = {
+    [G_UNICODE_BREAK_MANDATORY] = 0xB1, [G_UNICODE_BREAK_CARRIAGE_RETURN] = 0xB1, [G_UNICODE_BREAK_LINE_FEED] = 0xB1,
+    [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = 0xAD, [G_UNICODE_BREAK_NON_BREAKING_GLUE] = 0x99, [G_UNICODE_BREAK_CONTINGENT] = 0x73,
+    [G_UNICODE_BREAK_SPACE] = 0xAD, [G_UNICODE_BREAK_AFTER] = 0x65, [G_UNICODE_BREAK_HYPHEN] = 0x65,
+    [G_UNICODE_BREAK_NON_STARTER] = 0x65, [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = 0x91, [G_UNICODE_BREAK_QUOTATION] = 0x75,
+    [G_UNICODE_BREAK_EXCLAMATION] = 0x8D, [G_UNICODE_BREAK_INFIX_SEPARATOR] = 0x91, [G_UNICODE_BREAK_SYMBOL] = 0x91,
+    [G_UNICODE_BREAK_NEXT_LINE] = 0xB1, [G_UNICODE_BREAK_WORD_JOINER] = 0x9D, [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = 0x91,
+  },
+  [G_UNICODE_BREAK_COMBINING_MARK] = {
+    [G_UNICODE_BREAK_MANDATORY] = 0xB1, [G_UNICODE_BREAK_CARRIAGE_RETURN] = 0xB1, [G_UNICODE_BREAK_LINE_FEED] = 0xB1,
+    [G_UNICODE_BREAK_COMBINING_MARK] = 0xA1, [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = 0xAD, [G_UNICODE_BREAK_NON_BREAKING_GLUE] = 0x99,
+    [G_UNICODE_BREAK_CONTINGENT] = 0x73, [G_UNICODE_BREAK_SPACE] = 0xAD, [G_UNICODE_BREAK_AFTER] = 0x65,
+    [G_UNICODE_BREAK_HYPHEN] = 0x65, [G_UNICODE_BREAK_NON_STARTER] = 0x65, [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = 0x91,
+    [G_UNICODE_BREAK_QUOTATION] = 0x75, [G_UNICODE_BREAK_EXCLAMATION] = 0x8D, [G_UNICODE_BREAK_INFIX_SEPARATOR] = 0x91,
+    [G_UNICODE_BREAK_SYMBOL] = 0x91, [G_UNICODE_BREAK_NEXT_LINE] = 0xB1, [G_UNICODE_BREAK_WORD_JOINER] = 0x9D,
+    [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = 0x91, [G_UNICODE_BREAK_ZERO_WIDTH_JOINER] = 0xA1,
+  },
+  [G_UNICODE_BREAK_SURROGATE] = {
+    [G_UNICODE_BREAK_MANDATORY] = 0xB1, [G_UNICODE_BREAK_CARRIAGE_RETURN] = 0xB1, [G_UNICODE_BREAK_LINE_FEED] = 0xB1,
+    [G_UNICODE_BREAK_COMBINING_MARK] = 0xA1, [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = 0xAD, [G_UNICODE_BREAK_NON_BREAKING_GLUE] = 0x99,
+    [G_UNICODE_BREAK_CONTINGENT] = 0x73, [G_UNICODE_BREAK_SPACE] = 0xAD, [G_UNICODE_BREAK_AFTER] = 0x65,
+    [G_UNICODE_BREAK_HYPHEN] = 0x65, [G_UNICODE_BREAK_NON_STARTER] = 0x65, [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = 0x91,
+    [G_UNICODE_BREAK_QUOTATION] = 0x75, [G_UNICODE_BREAK_EXCLAMATION] = 0x8D, [G_UNICODE_BREAK_INFIX_SEPARATOR] = 0x91,
+    [G_UNICODE_BREAK_SYMBOL] = 0x91, [G_UNICODE_BREAK_NEXT_LINE] = 0xB1, [G_UNICODE_BREAK_WORD_JOINER] = 0x9D,
+    [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = 0x91, [G_UNICODE_BREAK_ZERO_WIDTH_JOINER] = 0xA1,
+  },
+  [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = {
+    [G_UNICODE_BREAK_MANDATORY] = 0xB1, [G_UNICODE_BREAK_CARRIAGE_RETURN] = 0xB1, [G_UNICODE_BREAK_LINE_FEED] = 0xB1,
+    [G_UNICODE_BREAK_COMBINING_MARK] = 0xA7, [G_UNICODE_BREAK_SURROGATE] = 0xA7, [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = 0xAD,
+    [G_UNICODE_BREAK_INSEPARABLE] = 0xA7, [G_UNICODE_BREAK_NON_BREAKING_GLUE] = 0xA7, [G_UNICODE_BREAK_CONTINGENT] = 0xA7,
+    [G_UNICODE_BREAK_SPACE] = 0xAD, [G_UNICODE_BREAK_AFTER] = 0xA7, [G_UNICODE_BREAK_BEFORE] = 0xA7,
+    [G_UNICODE_BREAK_BEFORE_AND_AFTER] = 0xA7, [G_UNICODE_BREAK_HYPHEN] = 0xA7, [G_UNICODE_BREAK_NON_STARTER] = 0xA7,
+    [G_UNICODE_BREAK_OPEN_PUNCTUATION] = 0xA7, [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = 0xA7, [G_UNICODE_BREAK_QUOTATION] = 0xA7,
+    [G_UNICODE_BREAK_EXCLAMATION] = 0xA7, [G_UNICODE_BREAK_IDEOGRAPHIC] = 0xA7, [G_UNICODE_BREAK_NUMERIC] = 0xA7,
+    [G_UNICODE_BREAK_INFIX_SEPARATOR] = 0xA7, [G_UNICODE_BREAK_SYMBOL] = 0xA7, [G_UNICODE_BREAK_ALPHABETIC] = 0xA7,
+    [G_UNICODE_BREAK_PREFIX] = 0xA7, [G_UNICODE_BREAK_POSTFIX] = 0xA7, [G_UNICODE_BREAK_COMPLEX_CONTEXT] = 0xA7,
+    [G_UNICODE_BREAK_AMBIGUOUS] = 0xA7, [G_UNICODE_BREAK_UNKNOWN] = 0xA7, [G_UNICODE_BREAK_NEXT_LINE] = 0xB1,
+    [G_UNICODE_BREAK_WORD_JOINER] = 0xA7, [G_UNICODE_BREAK_HANGUL_L_JAMO] = 0xA7, [G_UNICODE_BREAK_HANGUL_V_JAMO] = 0xA7,
+    [G_UNICODE_BREAK_HANGUL_T_JAMO] = 0xA7, [G_UNICODE_BREAK_HANGUL_LV_SYLLABLE] = 0xA7, [G_UNICODE_BREAK_HANGUL_LVT_SYLLABLE] = 0xA7,
+    [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = 0xA7, [G_UNICODE_BREAK_CONDITIONAL_JAPANESE_STARTER] = 0xA7, [G_UNICODE_BREAK_HEBREW_LETTER] = 0xA7,
+    [G_UNICODE_BREAK_REGIONAL_INDICATOR] = 0xA7, [G_UNICODE_BREAK_EMOJI_BASE] = 0xA7, [G_UNICODE_BREAK_EMOJI_MODIFIER] = 0xA7,
+    [G_UNICODE_BREAK_ZERO_WIDTH_JOINER] = 0xA7,
+  },
+  [G_UNICODE_BREAK_INSEPARABLE] = {
+    [G_UNICODE_BREAK_MANDATORY] = 0xB1, [G_UNICODE_BREAK_CARRIAGE_RETURN] = 0xB1, [G_UNICODE_BREAK_LINE_FEED] = 0xB1,
+    [G_UNICODE_BREAK_COMBINING_MARK] = 0xA1, [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = 0xAD, [G_UNICODE_BREAK_INSEPARABLE] = 0x61,
+    [G_UNICODE_BREAK_NON_BREAKING_GLUE] = 0x99, [G_UNICODE_BREAK_CONTINGENT] = 0x73, [G_UNICODE_BREAK_SPACE] = 0xAD,
+    [G_UNICODE_BREAK_AFTER] = 0x65, [G_UNICODE_BREAK_HYPHEN] = 0x65, [G_UNICODE_BREAK_NON_STARTER] = 0x65,
+    [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = 0x91, [G_UNICODE_BREAK_QUOTATION] = 0x75, [G_UNICODE_BREAK_EXCLAMATION] = 0x8D,
+    [G_UNICODE_BREAK_INFIX_SEPARATOR] = 0x91, [G_UNICODE_BREAK_SYMBOL] = 0x91, [G_UNICODE_BREAK_NEXT_LINE] = 0xB1,
+    [G_UNICODE_BREAK_WORD_JOINER] = 0x9D, [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = 0x91, [G_UNICODE_BREAK_ZERO_WIDTH_JOINER] = 0xA1,
+  },
+  [G_UNICODE_BREAK_NON_BREAKING_GLUE] = {
+    [G_UNICODE_BREAK_MANDATORY] = 0xB1, [G_UNICODE_BREAK_CARRIAGE_RETURN] = 0xB1, [G_UNICODE_BREAK_LINE_FEED] = 0xB1,
+    [G_UNICODE_BREAK_COMBINING_MARK] = 0xA1, [G_UNICODE_BREAK_SURROGATE] = 0x95, [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = 0xAD,
+    [G_UNICODE_BREAK_INSEPARABLE] = 0x95, [G_UNICODE_BREAK_NON_BREAKING_GLUE] = 0x99, [G_UNICODE_BREAK_CONTINGENT] = 0x95,
+    [G_UNICODE_BREAK_SPACE] = 0xAD, [G_UNICODE_BREAK_AFTER] = 0x95, [G_UNICODE_BREAK_BEFORE] = 0x95,
+    [G_UNICODE_BREAK_BEFORE_AND_AFTER] = 0x95, [G_UNICODE_BREAK_HYPHEN] = 0x95, [G_UNICODE_BREAK_NON_STARTER] = 0x95,
+    [G_UNICODE_BREAK_OPEN_PUNCTUATION] = 0x95, [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = 0x95, [G_UNICODE_BREAK_QUOTATION] = 0x95,
+    [G_UNICODE_BREAK_EXCLAMATION] = 0x95, [G_UNICODE_BREAK_IDEOGRAPHIC] = 0x95, [G_UNICODE_BREAK_NUMERIC] = 0x95,
+    [G_UNICODE_BREAK_INFIX_SEPARATOR] = 0x95, [G_UNICODE_BREAK_SYMBOL] = 0x95, [G_UNICODE_BREAK_ALPHABETIC] = 0x95,
+    [G_UNICODE_BREAK_PREFIX] = 0x95, [G_UNICODE_BREAK_POSTFIX] = 0x95, [G_UNICODE_BREAK_COMPLEX_CONTEXT] = 0x95,
+    [G_UNICODE_BREAK_AMBIGUOUS] = 0x95, [G_UNICODE_BREAK_UNKNOWN] = 0x95, [G_UNICODE_BREAK_NEXT_LINE] = 0xB1,
+    [G_UNICODE_BREAK_WORD_JOINER] = 0x9D, [G_UNICODE_BREAK_HANGUL_L_JAMO] = 0x95, [G_UNICODE_BREAK_HANGUL_V_JAMO] = 0x95,
+    [G_UNICODE_BREAK_HANGUL_T_JAMO] = 0x95, [G_UNICODE_BREAK_HANGUL_LV_SYLLABLE] = 0x95, [G_UNICODE_BREAK_HANGUL_LVT_SYLLABLE] = 0x95,
+    [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = 0x95, [G_UNICODE_BREAK_CONDITIONAL_JAPANESE_STARTER] = 0x95, [G_UNICODE_BREAK_HEBREW_LETTER] = 0x95,
+    [G_UNICODE_BREAK_REGIONAL_INDICATOR] = 0x95, [G_UNICODE_BREAK_EMOJI_BASE] = 0x95, [G_UNICODE_BREAK_EMOJI_MODIFIER] = 0x95,
+    [G_UNICODE_BREAK_ZERO_WIDTH_JOINER] = 0xA1,
+  },
+  [G_UNICODE_BREAK_CONTINGENT] = {
+    [G_UNICODE_BREAK_MANDATORY] = 0xB1, [G_UNICODE_BREAK_CARRIAGE_RETURN] = 0xB1, [G_UNICODE_BREAK_LINE_FEED] = 0xB1,
+    [G_UNICODE_BREAK_COMBINING_MARK] = 0xA1, [G_UNICODE_BREAK_SURROGATE] = 0x73, [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = 0xAD,
+    [G_UNICODE_BREAK_INSEPARABLE] = 0x73, [G_UNICODE_BREAK_NON_BREAKING_GLUE] = 0x99, [G_UNICODE_BREAK_CONTINGENT] = 0x73,
+    [G_UNICODE_BREAK_SPACE] = 0xAD, [G_UNICODE_BREAK_AFTER] = 0x73, [G_UNICODE_BREAK_BEFORE] = 0x73,
+    [G_UNICODE_BREAK_BEFORE_AND_AFTER] = 0x73, [G_UNICODE_BREAK_HYPHEN] = 0x73, [G_UNICODE_BREAK_NON_STARTER] = 0x73,
+    [G_UNICODE_BREAK_OPEN_PUNCTUATION] = 0x73, [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = 0x91, [G_UNICODE_BREAK_QUOTATION] = 0x75,
+    [G_UNICODE_BREAK_EXCLAMATION] = 0x8D, [G_UNICODE_BREAK_IDEOGRAPHIC] = 0x73, [G_UNICODE_BREAK_NUMERIC] = 0x73,
+    [G_UNICODE_BREAK_INFIX_SEPARATOR] = 0x91, [G_UNICODE_BREAK_SYMBOL] = 0x91, [G_UNICODE_BREAK_ALPHABETIC] = 0x73,
+    [G_UNICODE_BREAK_PREFIX] = 0x73, [G_UNICODE_BREAK_POSTFIX] = 0x73, [G_UNICODE_BREAK_COMPLEX_CONTEXT] = 0x73,
+    [G_UNICODE_BREAK_AMBIGUOUS] = 0x73, [G_UNICODE_BREAK_UNKNOWN] = 0x73, [G_UNICODE_BREAK_NEXT_LINE] = 0xB1,
+    [G_UNICODE_BREAK_WORD_JOINER] = 0x9D, [G_UNICODE_BREAK_HANGUL_L_JAMO] = 0x73, [G_UNICODE_BREAK_HANGUL_V_JAMO] = 0x73,
+    [G_UNICODE_BREAK_HANGUL_T_JAMO] = 0x73, [G_UNICODE_BREAK_HANGUL_LV_SYLLABLE] = 0x73, [G_UNICODE_BREAK_HANGUL_LVT_SYLLABLE] = 0x73,
+    [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = 0x91, [G_UNICODE_BREAK_CONDITIONAL_JAPANESE_STARTER] = 0x73, [G_UNICODE_BREAK_HEBREW_LETTER] = 0x73,
+    [G_UNICODE_BREAK_REGIONAL_INDICATOR] = 0x73, [G_UNICODE_BREAK_EMOJI_BASE] = 0x73, [G_UNICODE_BREAK_EMOJI_MODIFIER] = 0x73,
+    [G_UNICODE_BREAK_ZERO_WIDTH_JOINER] = 0xA1,
+  },
+  [G_UNICODE_BREAK_AFTER] = {
+    [G_UNICODE_BREAK_MANDATORY] = 0xB1, [G_UNICODE_BREAK_CARRIAGE_RETURN] = 0xB1, [G_UNICODE_BREAK_LINE_FEED] = 0xB1,
+    [G_UNICODE_BREAK_COMBINING_MARK] = 0xA1, [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = 0xAD, [G_UNICODE_BREAK_CONTINGENT] = 0x73,
+    [G_UNICODE_BREAK_SPACE] = 0xAD, [G_UNICODE_BREAK_AFTER] = 0x65, [G_UNICODE_BREAK_HYPHEN] = 0x65,
+    [G_UNICODE_BREAK_NON_STARTER] = 0x65, [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = 0x91, [G_UNICODE_BREAK_QUOTATION] = 0x75,
+    [G_UNICODE_BREAK_EXCLAMATION] = 0x8D, [G_UNICODE_BREAK_INFIX_SEPARATOR] = 0x91, [G_UNICODE_BREAK_SYMBOL] = 0x91,
+    [G_UNICODE_BREAK_NEXT_LINE] = 0xB1, [G_UNICODE_BREAK_WORD_JOINER] = 0x9D, [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = 0x91,
+    [G_UNICODE_BREAK_ZERO_WIDTH_JOINER] = 0xA1,
+  },
+  [G_UNICODE_BREAK_BEFORE] = {
+    [G_UNICODE_BREAK_MANDATORY] = 0xB1, [G_UNICODE_BREAK_CARRIAGE_RETURN] = 0xB1, [G_UNICODE_BREAK_LINE_FEED] = 0xB1,
+    [G_UNICODE_BREAK_COMBINING_MARK] = 0xA1, [G_UNICODE_BREAK_SURROGATE] = 0x65, [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = 0xAD,
+    [G_UNICODE_BREAK_INSEPARABLE] = 0x65, [G_UNICODE_BREAK_NON_BREAKING_GLUE] = 0x99, [G_UNICODE_BREAK_CONTINGENT] = 0x73,
+    [G_UNICODE_BREAK_SPACE] = 0xAD, [G_UNICODE_BREAK_AFTER] = 0x65, [G_UNICODE_BREAK_BEFORE] = 0x65,
+    [G_UNICODE_BREAK_BEFORE_AND_AFTER] = 0x65, [G_UNICODE_BREAK_HYPHEN] = 0x65, [G_UNICODE_BREAK_NON_STARTER] = 0x65,
+    [G_UNICODE_BREAK_OPEN_PUNCTUATION] = 0x65, [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = 0x91, [G_UNICODE_BREAK_QUOTATION] = 0x75,
+    [G_UNICODE_BREAK_EXCLAMATION] = 0x8D, [G_UNICODE_BREAK_IDEOGRAPHIC] = 0x65, [G_UNICODE_BREAK_NUMERIC] = 0x65,
+    [G_UNICODE_BREAK_INFIX_SEPARATOR] = 0x91, [G_UNICODE_BREAK_SYMBOL] = 0x91, [G_UNICODE_BREAK_ALPHABETIC] = 0x65,
+    [G_UNICODE_BREAK_PREFIX] = 0x65, [G_UNICODE_BREAK_POSTFIX] = 0x65, [G_UNICODE_BREAK_COMPLEX_CONTEXT] = 0x65,
+    [G_UNICODE_BREAK_AMBIGUOUS] = 0x65, [G_UNICODE_BREAK_UNKNOWN] = 0x65, [G_UNICODE_BREAK_NEXT_LINE] = 0xB1,
+    [G_UNICODE_BREAK_WORD_JOINER] = 0x9D, [G_UNICODE_BREAK_HANGUL_L_JAMO] = 0x65, [G_UNICODE_BREAK_HANGUL_V_JAMO] = 0x65,
+    [G_UNICODE_BREAK_HANGUL_T_JAMO] = 0x65, [G_UNICODE_BREAK_HANGUL_LV_SYLLABLE] = 0x65, [G_UNICODE_BREAK_HANGUL_LVT_SYLLABLE] = 0x65,
+    [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = 0x91, [G_UNICODE_BREAK_CONDITIONAL_JAPANESE_STARTER] = 0x65, [G_UNICODE_BREAK_HEBREW_LETTER] = 0x65,
+    [G_UNICODE_BREAK_REGIONAL_INDICATOR] = 0x65, [G_UNICODE_BREAK_EMOJI_BASE] = 0x65, [G_UNICODE_BREAK_EMOJI_MODIFIER] = 0x65,
+    [G_UNICODE_BREAK_ZERO_WIDTH_JOINER] = 0xA1,
+  },
+  [G_UNICODE_BREAK_BEFORE_AND_AFTER] = {
+    [G_UNICODE_BREAK_MANDATORY] = 0xB1, [G_UNICODE_BREAK_CARRIAGE_RETURN] = 0xB1, [G_UNICODE_BREAK_LINE_FEED] = 0xB1,
+    [G_UNICODE_BREAK_COMBINING_MARK] = 0xA1, [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = 0xAD, [G_UNICODE_BREAK_NON_BREAKING_GLUE] = 0x99,
+    [G_UNICODE_BREAK_CONTINGENT] = 0x73, [G_UNICODE_BREAK_SPACE] = 0xAD, [G_UNICODE_BREAK_AFTER] = 0x65,
+    [G_UNICODE_BREAK_BEFORE_AND_AFTER] = 0x7D, [G_UNICODE_BREAK_HYPHEN] = 0x65, [G_UNICODE_BREAK_NON_STARTER] = 0x65,
+    [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = 0x91, [G_UNICODE_BREAK_QUOTATION] = 0x75, [G_UNICODE_BREAK_EXCLAMATION] = 0x8D,
+    [G_UNICODE_BREAK_INFIX_SEPARATOR] = 0x91, [G_UNICODE_BREAK_SYMBOL] = 0x91, [G_UNICODE_BREAK_NEXT_LINE] = 0xB1,
+    [G_UNICODE_BREAK_WORD_JOINER] = 0x9D, [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = 0x91, [G_UNICODE_BREAK_ZERO_WIDTH_JOINER] = 0xA1,
+  },
+  [G_UNICODE_BREAK_HYPHEN] = {
+    [G_UNICODE_BREAK_MANDATORY] = 0xB1, [G_UNICODE_BREAK_CARRIAGE_RETURN] = 0xB1, [G_UNICODE_BREAK_LINE_FEED] = 0xB1,
+    [G_UNICODE_BREAK_COMBINING_MARK] = 0xA1, [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = 0xAD, [G_UNICODE_BREAK_CONTINGENT] = 0x73,
+    [G_UNICODE_BREAK_SPACE] = 0xAD, [G_UNICODE_BREAK_AFTER] = 0x65, [G_UNICODE_BREAK_HYPHEN] = 0x65,
+    [G_UNICODE_BREAK_NON_STARTER] = 0x65, [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = 0x91, [G_UNICODE_BREAK_QUOTATION] = 0x75,
+    [G_UNICODE_BREAK_EXCLAMATION] = 0x8D, [G_UNICODE_BREAK_NUMERIC] = 0x39, [G_UNICODE_BREAK_INFIX_SEPARATOR] = 0x91,
+    [G_UNICODE_BREAK_SYMBOL] = 0x91, [G_UNICODE_BREAK_NEXT_LINE] = 0xB1, [G_UNICODE_BREAK_WORD_JOINER] = 0x9D,
+    [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = 0x91, [G_UNICODE_BREAK_ZERO_WIDTH_JOINER] = 0xA1,
+  },
+  [G_UNICODE_BREAK_NON_STARTER] = {
+    [G_UNICODE_BREAK_MANDATORY] = 0xB1, [G_UNICODE_BREAK_CARRIAGE_RETURN] = 0xB1, [G_UNICODE_BREAK_LINE_FEED] = 0xB1,
+    [G_UNICODE_BREAK_COMBINING_MARK] = 0xA1, [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = 0xAD, [G_UNICODE_BREAK_NON_BREAKING_GLUE] = 0x99,
+    [G_UNICODE_BREAK_CONTINGENT] = 0x73, [G_UNICODE_BREAK_SPACE] = 0xAD, [G_UNICODE_BREAK_AFTER] = 0x65,
+    [G_UNICODE_BREAK_HYPHEN] = 0x65, [G_UNICODE_BREAK_NON_STARTER] = 0x65, [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = 0x91,
+    [G_UNICODE_BREAK_QUOTATION] = 0x75, [G_UNICODE_BREAK_EXCLAMATION] = 0x8D, [G_UNICODE_BREAK_INFIX_SEPARATOR] = 0x91,
+    [G_UNICODE_BREAK_SYMBOL] = 0x91, [G_UNICODE_BREAK_NEXT_LINE] = 0xB1, [G_UNICODE_BREAK_WORD_JOINER] = 0x9D,
+    [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = 0x91, [G_UNICODE_BREAK_ZERO_WIDTH_JOINER] = 0xA1,
+  },
+  [G_UNICODE_BREAK_OPEN_PUNCTUATION] = {
+    [G_UNICODE_BREAK_MANDATORY] = 0xB1, [G_UNICODE_BREAK_CARRIAGE_RETURN] = 0xB1, [G_UNICODE_BREAK_LINE_FEED] = 0xB1,
+    [G_UNICODE_BREAK_COMBINING_MARK] = 0xA1, [G_UNICODE_BREAK_SURROGATE] = 0x89, [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = 0xAD,
+    [G_UNICODE_BREAK_INSEPARABLE] = 0x89, [G_UNICODE_BREAK_NON_BREAKING_GLUE] = 0x99, [G_UNICODE_BREAK_CONTINGENT] = 0x89,
+    [G_UNICODE_BREAK_SPACE] = 0xAD, [G_UNICODE_BREAK_AFTER] = 0x89, [G_UNICODE_BREAK_BEFORE] = 0x89,
+    [G_UNICODE_BREAK_BEFORE_AND_AFTER] = 0x89, [G_UNICODE_BREAK_HYPHEN] = 0x89, [G_UNICODE_BREAK_NON_STARTER] = 0x89,
+    [G_UNICODE_BREAK_OPEN_PUNCTUATION] = 0x89, [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = 0x91, [G_UNICODE_BREAK_QUOTATION] = 0x89,
+    [G_UNICODE_BREAK_EXCLAMATION] = 0x8D, [G_UNICODE_BREAK_IDEOGRAPHIC] = 0x89, [G_UNICODE_BREAK_NUMERIC] = 0x89,
+    [G_UNICODE_BREAK_INFIX_SEPARATOR] = 0x91, [G_UNICODE_BREAK_SYMBOL] = 0x91, [G_UNICODE_BREAK_ALPHABETIC] = 0x89,
+    [G_UNICODE_BREAK_PREFIX] = 0x89, [G_UNICODE_BREAK_POSTFIX] = 0x89, [G_UNICODE_BREAK_COMPLEX_CONTEXT] = 0x89,
+    [G_UNICODE_BREAK_AMBIGUOUS] = 0x89, [G_UNICODE_BREAK_UNKNOWN] = 0x89, [G_UNICODE_BREAK_NEXT_LINE] = 0xB1,
+    [G_UNICODE_BREAK_WORD_JOINER] = 0x9D, [G_UNICODE_BREAK_HANGUL_L_JAMO] = 0x89, [G_UNICODE_BREAK_HANGUL_V_JAMO] = 0x89,
+    [G_UNICODE_BREAK_HANGUL_T_JAMO] = 0x89, [G_UNICODE_BREAK_HANGUL_LV_SYLLABLE] = 0x89, [G_UNICODE_BREAK_HANGUL_LVT_SYLLABLE] = 0x89,
+    [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = 0x91, [G_UNICODE_BREAK_CONDITIONAL_JAPANESE_STARTER] = 0x89, [G_UNICODE_BREAK_HEBREW_LETTER] = 0x89,
+    [G_UNICODE_BREAK_REGIONAL_INDICATOR] = 0x89, [G_UNICODE_BREAK_EMOJI_BASE] = 0x89, [G_UNICODE_BREAK_EMOJI_MODIFIER] = 0x89,
+    [G_UNICODE_BREAK_ZERO_WIDTH_JOINER] = 0xA1,
+  },
+  [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = {
+    [G_UNICODE_BREAK_MANDATORY] = 0xB1, [G_UNICODE_BREAK_CARRIAGE_RETURN] = 0xB1, [G_UNICODE_BREAK_LINE_FEED] = 0xB1,
+    [G_UNICODE_BREAK_COMBINING_MARK] = 0xA1, [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = 0xAD, [G_UNICODE_BREAK_NON_BREAKING_GLUE] = 0x99,
+    [G_UNICODE_BREAK_CONTINGENT] = 0x73, [G_UNICODE_BREAK_SPACE] = 0xAD, [G_UNICODE_BREAK_AFTER] = 0x65,
+    [G_UNICODE_BREAK_HYPHEN] = 0x65, [G_UNICODE_BREAK_NON_STARTER] = 0x81, [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = 0x91,
+    [G_UNICODE_BREAK_QUOTATION] = 0x75, [G_UNICODE_BREAK_EXCLAMATION] = 0x8D, [G_UNICODE_BREAK_INFIX_SEPARATOR] = 0x91,
+    [G_UNICODE_BREAK_SYMBOL] = 0x91, [G_UNICODE_BREAK_NEXT_LINE] = 0xB1, [G_UNICODE_BREAK_WORD_JOINER] = 0x9D,
+    [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = 0x91, [G_UNICODE_BREAK_ZERO_WIDTH_JOINER] = 0xA1,
+  },
+  [G_UNICODE_BREAK_QUOTATION] = {
+    [G_UNICODE_BREAK_MANDATORY] = 0xB1, [G_UNICODE_BREAK_CARRIAGE_RETURN] = 0xB1, [G_UNICODE_BREAK_LINE_FEED] = 0xB1,
+    [G_UNICODE_BREAK_COMBINING_MARK] = 0xA1, [G_UNICODE_BREAK_SURROGATE] = 0x75, [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = 0xAD,
+    [G_UNICODE_BREAK_INSEPARABLE] = 0x75, [G_UNICODE_BREAK_NON_BREAKING_GLUE] = 0x99, [G_UNICODE_BREAK_CONTINGENT] = 0x75,
+    [G_UNICODE_BREAK_SPACE] = 0xAD, [G_UNICODE_BREAK_AFTER] = 0x75, [G_UNICODE_BREAK_BEFORE] = 0x75,
+    [G_UNICODE_BREAK_BEFORE_AND_AFTER] = 0x75, [G_UNICODE_BREAK_HYPHEN] = 0x75, [G_UNICODE_BREAK_NON_STARTER] = 0x75,
+    [G_UNICODE_BREAK_OPEN_PUNCTUATION] = 0x85, [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = 0x91, [G_UNICODE_BREAK_QUOTATION] = 0x75,
+    [G_UNICODE_BREAK_EXCLAMATION] = 0x8D, [G_UNICODE_BREAK_IDEOGRAPHIC] = 0x75, [G_UNICODE_BREAK_NUMERIC] = 0x75,
+    [G_UNICODE_BREAK_INFIX_SEPARATOR] = 0x91, [G_UNICODE_BREAK_SYMBOL] = 0x91, [G_UNICODE_BREAK_ALPHABETIC] = 0x75,
+    [G_UNICODE_BREAK_PREFIX] = 0x75, [G_UNICODE_BREAK_POSTFIX] = 0x75, [G_UNICODE_BREAK_COMPLEX_CONTEXT] = 0x75,
+    [G_UNICODE_BREAK_AMBIGUOUS] = 0x75, [G_UNICODE_BREAK_UNKNOWN] = 0x75, [G_UNICODE_BREAK_NEXT_LINE] = 0xB1,
+    [G_UNICODE_BREAK_WORD_JOINER] = 0x9D, [G_UNICODE_BREAK_HANGUL_L_JAMO] = 0x75, [G_UNICODE_BREAK_HANGUL_V_JAMO] = 0x75,
+    [G_UNICODE_BREAK_HANGUL_T_JAMO] = 0x75, [G_UNICODE_BREAK_HANGUL_LV_SYLLABLE] = 0x75, [G_UNICODE_BREAK_HANGUL_LVT_SYLLABLE] = 0x75,
+    [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = 0x91, [G_UNICODE_BREAK_CONDITIONAL_JAPANESE_STARTER] = 0x75, [G_UNICODE_BREAK_HEBREW_LETTER] = 0x75,
+    [G_UNICODE_BREAK_REGIONAL_INDICATOR] = 0x75, [G_UNICODE_BREAK_EMOJI_BASE] = 0x75, [G_UNICODE_BREAK_EMOJI_MODIFIER] = 0x75,
+    [G_UNICODE_BREAK_ZERO_WIDTH_JOINER] = 0xA1,
+  },
+  [G_UNICODE_BREAK_EXCLAMATION] = {
+    [G_UNICODE_BREAK_MANDATORY] = 0xB1, [G_UNICODE_BREAK_CARRIAGE_RETURN] = 0xB1, [G_UNICODE_BREAK_LINE_FEED] = 0xB1,
+    [G_UNICODE_BREAK_COMBINING_MARK] = 0xA1, [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = 0xAD, [G_UNICODE_BREAK_INSEPARABLE] = 0x61,
+    [G_UNICODE_BREAK_NON_BREAKING_GLUE] = 0x99, [G_UNICODE_BREAK_CONTINGENT] = 0x73, [G_UNICODE_BREAK_SPACE] = 0xAD,
+    [G_UNICODE_BREAK_AFTER] = 0x65, [G_UNICODE_BREAK_HYPHEN] = 0x65, [G_UNICODE_BREAK_NON_STARTER] = 0x65,
+    [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = 0x91, [G_UNICODE_BREAK_QUOTATION] = 0x75, [G_UNICODE_BREAK_EXCLAMATION] = 0x8D,
+    [G_UNICODE_BREAK_INFIX_SEPARATOR] = 0x91, [G_UNICODE_BREAK_SYMBOL] = 0x91, [G_UNICODE_BREAK_NEXT_LINE] = 0xB1,
+    [G_UNICODE_BREAK_WORD_JOINER] = 0x9D, [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = 0x91, [G_UNICODE_BREAK_ZERO_WIDTH_JOINER] = 0xA1,
+  },
+  [G_UNICODE_BREAK_IDEOGRAPHIC] = {
+    [G_UNICODE_BREAK_MANDATORY] = 0xB1, [G_UNICODE_BREAK_CARRIAGE_RETURN] = 0xB1, [G_UNICODE_BREAK_LINE_FEED] = 0xB1,
+    [G_UNICODE_BREAK_COMBINING_MARK] = 0xA1, [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = 0xAD, [G_UNICODE_BREAK_INSEPARABLE] = 0x61,
+    [G_UNICODE_BREAK_NON_BREAKING_GLUE] = 0x99, [G_UNICODE_BREAK_CONTINGENT] = 0x73, [G_UNICODE_BREAK_SPACE] = 0xAD,
+    [G_UNICODE_BREAK_AFTER] = 0x65, [G_UNICODE_BREAK_HYPHEN] = 0x65, [G_UNICODE_BREAK_NON_STARTER] = 0x65,
+    [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = 0x91, [G_UNICODE_BREAK_QUOTATION] = 0x75, [G_UNICODE_BREAK_EXCLAMATION] = 0x8D,
+    [G_UNICODE_BREAK_INFIX_SEPARATOR] = 0x91, [G_UNICODE_BREAK_SYMBOL] = 0x91, [G_UNICODE_BREAK_POSTFIX] = 0x5D,
+    [G_UNICODE_BREAK_NEXT_LINE] = 0xB1, [G_UNICODE_BREAK_WORD_JOINER] = 0x9D, [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = 0x91,
+    [G_UNICODE_BREAK_ZERO_WIDTH_JOINER] = 0xA1,
+  },
+  [G_UNICODE_BREAK_NUMERIC] = {
+    [G_UNICODE_BREAK_MANDATORY] = 0xB1, [G_UNICODE_BREAK_CARRIAGE_RETURN] = 0xB1, [G_UNICODE_BREAK_LINE_FEED] = 0xB1,
+    [G_UNICODE_BREAK_COMBINING_MARK] = 0xA1, [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = 0xAD, [G_UNICODE_BREAK_INSEPARABLE] = 0x61,
+    [G_UNICODE_BREAK_NON_BREAKING_GLUE] = 0x99, [G_UNICODE_BREAK_CONTINGENT] = 0x73, [G_UNICODE_BREAK_SPACE] = 0xAD,
+    [G_UNICODE_BREAK_AFTER] = 0x65, [G_UNICODE_BREAK_HYPHEN] = 0x65, [G_UNICODE_BREAK_NON_STARTER] = 0x65,
+    [G_UNICODE_BREAK_OPEN_PUNCTUATION] = 0x05, [G_UNICODE_BREAK_QUOTATION] = 0x75, [G_UNICODE_BREAK_EXCLAMATION] = 0x8D,
+    [G_UNICODE_BREAK_NUMERIC] = 0x3D, [G_UNICODE_BREAK_INFIX_SEPARATOR] = 0x3D, [G_UNICODE_BREAK_SYMBOL] = 0x3D,
+    [G_UNICODE_BREAK_ALPHABETIC] = 0x55, [G_UNICODE_BREAK_NEXT_LINE] = 0xB1, [G_UNICODE_BREAK_WORD_JOINER] = 0x9D,
+    [G_UNICODE_BREAK_HEBREW_LETTER] = 0x55, [G_UNICODE_BREAK_ZERO_WIDTH_JOINER] = 0xA1,
+  },
+  [G_UNICODE_BREAK_INFIX_SEPARATOR] = {
+    [G_UNICODE_BREAK_MANDATORY] = 0xB1, [G_UNICODE_BREAK_CARRIAGE_RETURN] = 0xB1, [G_UNICODE_BREAK_LINE_FEED] = 0xB1,
+    [G_UNICODE_BREAK_COMBINING_MARK] = 0xA1, [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = 0xAD, [G_UNICODE_BREAK_NON_BREAKING_GLUE] = 0x99,
+    [G_UNICODE_BREAK_CONTINGENT] = 0x73, [G_UNICODE_BREAK_SPACE] = 0xAD, [G_UNICODE_BREAK_AFTER] = 0x65,
+    [G_UNICODE_BREAK_HYPHEN] = 0x65, [G_UNICODE_BREAK_NON_STARTER] = 0x65, [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = 0x91,
+    [G_UNICODE_BREAK_QUOTATION] = 0x75, [G_UNICODE_BREAK_EXCLAMATION] = 0x8D, [G_UNICODE_BREAK_INFIX_SEPARATOR] = 0x91,
+    [G_UNICODE_BREAK_SYMBOL] = 0x91, [G_UNICODE_BREAK_ALPHABETIC] = 0x15, [G_UNICODE_BREAK_NEXT_LINE] = 0xB1,
+    [G_UNICODE_BREAK_WORD_JOINER] = 0x9D, [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = 0x91, [G_UNICODE_BREAK_HEBREW_LETTER] = 0x15,
+    [G_UNICODE_BREAK_ZERO_WIDTH_JOINER] = 0xA1,
+  },
+  [G_UNICODE_BREAK_SYMBOL] = {
+    [G_UNICODE_BREAK_MANDATORY] = 0xB1, [G_UNICODE_BREAK_CARRIAGE_RETURN] = 0xB1, [G_UNICODE_BREAK_LINE_FEED] = 0xB1,
+    [G_UNICODE_BREAK_COMBINING_MARK] = 0xA1, [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = 0xAD, [G_UNICODE_BREAK_NON_BREAKING_GLUE] = 0x99,
+    [G_UNICODE_BREAK_CONTINGENT] = 0x73, [G_UNICODE_BREAK_SPACE] = 0xAD, [G_UNICODE_BREAK_AFTER] = 0x65,
+    [G_UNICODE_BREAK_HYPHEN] = 0x65, [G_UNICODE_BREAK_NON_STARTER] = 0x65, [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = 0x91,
+    [G_UNICODE_BREAK_QUOTATION] = 0x75, [G_UNICODE_BREAK_EXCLAMATION] = 0x8D, [G_UNICODE_BREAK_INFIX_SEPARATOR] = 0x91,
+    [G_UNICODE_BREAK_SYMBOL] = 0x91, [G_UNICODE_BREAK_NEXT_LINE] = 0xB1, [G_UNICODE_BREAK_WORD_JOINER] = 0x9D,
+    [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = 0x91, [G_UNICODE_BREAK_HEBREW_LETTER] = 0x6D, [G_UNICODE_BREAK_ZERO_WIDTH_JOINER] = 0xA1,
+  },
+  [G_UNICODE_BREAK_ALPHABETIC] = {
+    [G_UNICODE_BREAK_MANDATORY] = 0xB1, [G_UNICODE_BREAK_CARRIAGE_RETURN] = 0xB1, [G_UNICODE_BREAK_LINE_FEED] = 0xB1,
+    [G_UNICODE_BREAK_COMBINING_MARK] = 0xA1, [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = 0xAD, [G_UNICODE_BREAK_INSEPARABLE] = 0x61,
+    [G_UNICODE_BREAK_NON_BREAKING_GLUE] = 0x99, [G_UNICODE_BREAK_CONTINGENT] = 0x73, [G_UNICODE_BREAK_SPACE] = 0xAD,
+    [G_UNICODE_BREAK_AFTER] = 0x65, [G_UNICODE_BREAK_HYPHEN] = 0x65, [G_UNICODE_BREAK_NON_STARTER] = 0x65,
+    [G_UNICODE_BREAK_OPEN_PUNCTUATION] = 0x05, [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = 0x91, [G_UNICODE_BREAK_QUOTATION] = 0x75,
+    [G_UNICODE_BREAK_EXCLAMATION] = 0x8D, [G_UNICODE_BREAK_NUMERIC] = 0x51, [G_UNICODE_BREAK_INFIX_SEPARATOR] = 0x91,
+    [G_UNICODE_BREAK_SYMBOL] = 0x91, [G_UNICODE_BREAK_ALPHABETIC] = 0x19, [G_UNICODE_BREAK_PREFIX] = 0x4D,
+    [G_UNICODE_BREAK_POSTFIX] = 0x4D, [G_UNICODE_BREAK_NEXT_LINE] = 0xB1, [G_UNICODE_BREAK_WORD_JOINER] = 0x9D,
+    [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = 0x91, [G_UNICODE_BREAK_HEBREW_LETTER] = 0x19, [G_UNICODE_BREAK_ZERO_WIDTH_JOINER] = 0xA1,
+  },
+  [G_UNICODE_BREAK_PREFIX] = {
+    [G_UNICODE_BREAK_MANDATORY] = 0xB1, [G_UNICODE_BREAK_CARRIAGE_RETURN] = 0xB1, [G_UNICODE_BREAK_LINE_FEED] = 0xB1,
+    [G_UNICODE_BREAK_COMBINING_MARK] = 0xA1, [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = 0xAD, [G_UNICODE_BREAK_NON_BREAKING_GLUE] = 0x99,
+    [G_UNICODE_BREAK_CONTINGENT] = 0x73, [G_UNICODE_BREAK_SPACE] = 0xAD, [G_UNICODE_BREAK_AFTER] = 0x65,
+    [G_UNICODE_BREAK_HYPHEN] = 0x65, [G_UNICODE_BREAK_NON_STARTER] = 0x65, [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = 0x91,
+    [G_UNICODE_BREAK_QUOTATION] = 0x75, [G_UNICODE_BREAK_EXCLAMATION] = 0x8D, [G_UNICODE_BREAK_IDEOGRAPHIC] = 0x59,
+    [G_UNICODE_BREAK_NUMERIC] = 0x31, [G_UNICODE_BREAK_INFIX_SEPARATOR] = 0x91, [G_UNICODE_BREAK_SYMBOL] = 0x91,
+    [G_UNICODE_BREAK_ALPHABETIC] = 0x49, [G_UNICODE_BREAK_NEXT_LINE] = 0xB1, [G_UNICODE_BREAK_WORD_JOINER] = 0x9D,
+    [G_UNICODE_BREAK_HANGUL_L_JAMO] = 0x21, [G_UNICODE_BREAK_HANGUL_V_JAMO] = 0x21, [G_UNICODE_BREAK_HANGUL_T_JAMO] = 0x21,
+    [G_UNICODE_BREAK_HANGUL_LV_SYLLABLE] = 0x21, [G_UNICODE_BREAK_HANGUL_LVT_SYLLABLE] = 0x21, [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = 0x91,
+    [G_UNICODE_BREAK_HEBREW_LETTER] = 0x49, [G_UNICODE_BREAK_EMOJI_BASE] = 0x59, [G_UNICODE_BREAK_EMOJI_MODIFIER] = 0x59,
+    [G_UNICODE_BREAK_ZERO_WIDTH_JOINER] = 0xA1,
+  },
+  [G_UNICODE_BREAK_POSTFIX] = {
+    [G_UNICODE_BREAK_MANDATORY] = 0xB1, [G_UNICODE_BREAK_CARRIAGE_RETURN] = 0xB1, [G_UNICODE_BREAK_LINE_FEED] = 0xB1,
+    [G_UNICODE_BREAK_COMBINING_MARK] = 0xA1, [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = 0xAD, [G_UNICODE_BREAK_NON_BREAKING_GLUE] = 0x99,
+    [G_UNICODE_BREAK_CONTINGENT] = 0x73, [G_UNICODE_BREAK_SPACE] = 0xAD, [G_UNICODE_BREAK_AFTER] = 0x65,
+    [G_UNICODE_BREAK_HYPHEN] = 0x65, [G_UNICODE_BREAK_NON_STARTER] = 0x65, [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = 0x91,
+    [G_UNICODE_BREAK_QUOTATION] = 0x75, [G_UNICODE_BREAK_EXCLAMATION] = 0x8D, [G_UNICODE_BREAK_NUMERIC] = 0x31,
+    [G_UNICODE_BREAK_INFIX_SEPARATOR] = 0x91, [G_UNICODE_BREAK_SYMBOL] = 0x91, [G_UNICODE_BREAK_ALPHABETIC] = 0x49,
+    [G_UNICODE_BREAK_NEXT_LINE] = 0xB1, [G_UNICODE_BREAK_WORD_JOINER] = 0x9D, [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = 0x91,
+    [G_UNICODE_BREAK_HEBREW_LETTER] = 0x49, [G_UNICODE_BREAK_ZERO_WIDTH_JOINER] = 0xA1,
+  },
+  [G_UNICODE_BREAK_COMPLEX_CONTEXT] = {
+    [G_UNICODE_BREAK_MANDATORY] = 0xB1, [G_UNICODE_BREAK_CARRIAGE_RETURN] = 0xB1, [G_UNICODE_BREAK_LINE_FEED] = 0xB1,
+    [G_UNICODE_BREAK_COMBINING_MARK] = 0xA1, [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = 0xAD, [G_UNICODE_BREAK_NON_BREAKING_GLUE] = 0x99,
+    [G_UNICODE_BREAK_CONTINGENT] = 0x73, [G_UNICODE_BREAK_SPACE] = 0xAD, [G_UNICODE_BREAK_AFTER] = 0x65,
+    [G_UNICODE_BREAK_HYPHEN] = 0x65, [G_UNICODE_BREAK_NON_STARTER] = 0x65, [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = 0x91,
+    [G_UNICODE_BREAK_QUOTATION] = 0x75, [G_UNICODE_BREAK_EXCLAMATION] = 0x8D, [G_UNICODE_BREAK_INFIX_SEPARATOR] = 0x91,
+    [G_UNICODE_BREAK_SYMBOL] = 0x91, [G_UNICODE_BREAK_NEXT_LINE] = 0xB1, [G_UNICODE_BREAK_WORD_JOINER] = 0x9D,
+    [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = 0x91, [G_UNICODE_BREAK_ZERO_WIDTH_JOINER] = 0xA1,
+  },
+  [G_UNICODE_BREAK_AMBIGUOUS] = {
+    [G_UNICODE_BREAK_MANDATORY] = 0xB1, [G_UNICODE_BREAK_CARRIAGE_RETURN] = 0xB1, [G_UNICODE_BREAK_LINE_FEED] = 0xB1,
+    [G_UNICODE_BREAK_COMBINING_MARK] = 0xA1, [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = 0xAD, [G_UNICODE_BREAK_NON_BREAKING_GLUE] = 0x99,
+    [G_UNICODE_BREAK_CONTINGENT] = 0x73, [G_UNICODE_BREAK_SPACE] = 0xAD, [G_UNICODE_BREAK_AFTER] = 0x65,
+    [G_UNICODE_BREAK_HYPHEN] = 0x65, [G_UNICODE_BREAK_NON_STARTER] = 0x65, [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = 0x91,
+    [G_UNICODE_BREAK_QUOTATION] = 0x75, [G_UNICODE_BREAK_EXCLAMATION] = 0x8D, [G_UNICODE_BREAK_INFIX_SEPARATOR] = 0x91,
+    [G_UNICODE_BREAK_SYMBOL] = 0x91, [G_UNICODE_BREAK_NEXT_LINE] = 0xB1, [G_UNICODE_BREAK_WORD_JOINER] = 0x9D,
+    [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = 0x91, [G_UNICODE_BREAK_ZERO_WIDTH_JOINER] = 0xA1,
+  },
+  [G_UNICODE_BREAK_UNKNOWN] = {
+    [G_UNICODE_BREAK_MANDATORY] = 0xB1, [G_UNICODE_BREAK_CARRIAGE_RETURN] = 0xB1, [G_UNICODE_BREAK_LINE_FEED] = 0xB1,
+    [G_UNICODE_BREAK_COMBINING_MARK] = 0xA1, [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = 0xAD, [G_UNICODE_BREAK_NON_BREAKING_GLUE] = 0x99,
+    [G_UNICODE_BREAK_CONTINGENT] = 0x73, [G_UNICODE_BREAK_SPACE] = 0xAD, [G_UNICODE_BREAK_AFTER] = 0x65,
+    [G_UNICODE_BREAK_HYPHEN] = 0x65, [G_UNICODE_BREAK_NON_STARTER] = 0x65, [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = 0x91,
+    [G_UNICODE_BREAK_QUOTATION] = 0x75, [G_UNICODE_BREAK_EXCLAMATION] = 0x8D, [G_UNICODE_BREAK_INFIX_SEPARATOR] = 0x91,
+    [G_UNICODE_BREAK_SYMBOL] = 0x91, [G_UNICODE_BREAK_NEXT_LINE] = 0xB1, [G_UNICODE_BREAK_WORD_JOINER] = 0x9D,
+    [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = 0x91, [G_UNICODE_BREAK_ZERO_WIDTH_JOINER] = 0xA1,
+  },
+  [G_UNICODE_BREAK_NEXT_LINE] = {
+    [G_UNICODE_BREAK_MANDATORY] = 0xB1, [G_UNICODE_BREAK_CARRIAGE_RETURN] = 0xB1, [G_UNICODE_BREAK_LINE_FEED] = 0xB1,
+    [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = 0xAD, [G_UNICODE_BREAK_NON_BREAKING_GLUE] = 0x99, [G_UNICODE_BREAK_CONTINGENT] = 0x73,
+    [G_UNICODE_BREAK_SPACE] = 0xAD, [G_UNICODE_BREAK_AFTER] = 0x65, [G_UNICODE_BREAK_HYPHEN] = 0x65,
+    [G_UNICODE_BREAK_NON_STARTER] = 0x65, [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = 0x91, [G_UNICODE_BREAK_QUOTATION] = 0x75,
+    [G_UNICODE_BREAK_EXCLAMATION] = 0x8D, [G_UNICODE_BREAK_INFIX_SEPARATOR] = 0x91, [G_UNICODE_BREAK_SYMBOL] = 0x91,
+    [G_UNICODE_BREAK_NEXT_LINE] = 0xB1, [G_UNICODE_BREAK_WORD_JOINER] = 0x9D, [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = 0x91,
+  },
+  [G_UNICODE_BREAK_WORD_JOINER] = {
+    [G_UNICODE_BREAK_MANDATORY] = 0xB1, [G_UNICODE_BREAK_CARRIAGE_RETURN] = 0xB1, [G_UNICODE_BREAK_LINE_FEED] = 0xB1,
+    [G_UNICODE_BREAK_COMBINING_MARK] = 0xA1, [G_UNICODE_BREAK_SURROGATE] = 0x9D, [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = 0xAD,
+    [G_UNICODE_BREAK_INSEPARABLE] = 0x9D, [G_UNICODE_BREAK_NON_BREAKING_GLUE] = 0x9D, [G_UNICODE_BREAK_CONTINGENT] = 0x9D,
+    [G_UNICODE_BREAK_SPACE] = 0xAD, [G_UNICODE_BREAK_AFTER] = 0x9D, [G_UNICODE_BREAK_BEFORE] = 0x9D,
+    [G_UNICODE_BREAK_BEFORE_AND_AFTER] = 0x9D, [G_UNICODE_BREAK_HYPHEN] = 0x9D, [G_UNICODE_BREAK_NON_STARTER] = 0x9D,
+    [G_UNICODE_BREAK_OPEN_PUNCTUATION] = 0x9D, [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = 0x9D, [G_UNICODE_BREAK_QUOTATION] = 0x9D,
+    [G_UNICODE_BREAK_EXCLAMATION] = 0x9D, [G_UNICODE_BREAK_IDEOGRAPHIC] = 0x9D, [G_UNICODE_BREAK_NUMERIC] = 0x9D,
+    [G_UNICODE_BREAK_INFIX_SEPARATOR] = 0x9D, [G_UNICODE_BREAK_SYMBOL] = 0x9D, [G_UNICODE_BREAK_ALPHABETIC] = 0x9D,
+    [G_UNICODE_BREAK_PREFIX] = 0x9D, [G_UNICODE_BREAK_POSTFIX] = 0x9D, [G_UNICODE_BREAK_COMPLEX_CONTEXT] = 0x9D,
+    [G_UNICODE_BREAK_AMBIGUOUS] = 0x9D, [G_UNICODE_BREAK_UNKNOWN] = 0x9D, [G_UNICODE_BREAK_NEXT_LINE] = 0xB1,
+    [G_UNICODE_BREAK_WORD_JOINER] = 0x9D, [G_UNICODE_BREAK_HANGUL_L_JAMO] = 0x9D, [G_UNICODE_BREAK_HANGUL_V_JAMO] = 0x9D,
+    [G_UNICODE_BREAK_HANGUL_T_JAMO] = 0x9D, [G_UNICODE_BREAK_HANGUL_LV_SYLLABLE] = 0x9D, [G_UNICODE_BREAK_HANGUL_LVT_SYLLABLE] = 0x9D,
+    [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = 0x9D, [G_UNICODE_BREAK_CONDITIONAL_JAPANESE_STARTER] = 0x9D, [G_UNICODE_BREAK_HEBREW_LETTER] = 0x9D,
+    [G_UNICODE_BREAK_REGIONAL_INDICATOR] = 0x9D, [G_UNICODE_BREAK_EMOJI_BASE] = 0x9D, [G_UNICODE_BREAK_EMOJI_MODIFIER] = 0x9D,
+    [G_UNICODE_BREAK_ZERO_WIDTH_JOINER] = 0xA1,
+  },
+  [G_UNICODE_BREAK_HANGUL_L_JAMO] = {
+    [G_UNICODE_BREAK_MANDATORY] = 0xB1, [G_UNICODE_BREAK_CARRIAGE_RETURN] = 0xB1, [G_UNICODE_BREAK_LINE_FEED] = 0xB1,
+    [G_UNICODE_BREAK_COMBINING_MARK] = 0xA1, [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = 0xAD, [G_UNICODE_BREAK_INSEPARABLE] = 0x1D,
+    [G_UNICODE_BREAK_NON_BREAKING_GLUE] = 0x99, [G_UNICODE_BREAK_CONTINGENT] = 0x73, [G_UNICODE_BREAK_SPACE] = 0xAD,
+    [G_UNICODE_BREAK_AFTER] = 0x65, [G_UNICODE_BREAK_HYPHEN] = 0x65, [G_UNICODE_BREAK_NON_STARTER] = 0x65,
+    [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = 0x91, [G_UNICODE_BREAK_QUOTATION] = 0x75, [G_UNICODE_BREAK_EXCLAMATION] = 0x8D,
+    [G_UNICODE_BREAK_INFIX_SEPARATOR] = 0x91, [G_UNICODE_BREAK_SYMBOL] = 0x91, [G_UNICODE_BREAK_POSTFIX] = 0x1D,
+    [G_UNICODE_BREAK_NEXT_LINE] = 0xB1, [G_UNICODE_BREAK_WORD_JOINER] = 0x9D, [G_UNICODE_BREAK_HANGUL_L_JAMO] = 0x25,
+    [G_UNICODE_BREAK_HANGUL_V_JAMO] = 0x25, [G_UNICODE_BREAK_HANGUL_LV_SYLLABLE] = 0x25, [G_UNICODE_BREAK_HANGUL_LVT_SYLLABLE] = 0x25,
+    [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = 0x91, [G_UNICODE_BREAK_ZERO_WIDTH_JOINER] = 0xA1,
+  },
+  [G_UNICODE_BREAK_HANGUL_V_JAMO] = {
+    [G_UNICODE_BREAK_MANDATORY] = 0xB1, [G_UNICODE_BREAK_CARRIAGE_RETURN] = 0xB1, [G_UNICODE_BREAK_LINE_FEED] = 0xB1,
+    [G_UNICODE_BREAK_COMBINING_MARK] = 0xA1, [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = 0xAD, [G_UNICODE_BREAK_INSEPARABLE] = 0x1D,
+    [G_UNICODE_BREAK_NON_BREAKING_GLUE] = 0x99, [G_UNICODE_BREAK_CONTINGENT] = 0x73, [G_UNICODE_BREAK_SPACE] = 0xAD,
+    [G_UNICODE_BREAK_AFTER] = 0x65, [G_UNICODE_BREAK_HYPHEN] = 0x65, [G_UNICODE_BREAK_NON_STARTER] = 0x65,
+    [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = 0x91, [G_UNICODE_BREAK_QUOTATION] = 0x75, [G_UNICODE_BREAK_EXCLAMATION] = 0x8D,
+    [G_UNICODE_BREAK_INFIX_SEPARATOR] = 0x91, [G_UNICODE_BREAK_SYMBOL] = 0x91, [G_UNICODE_BREAK_POSTFIX] = 0x1D,
+    [G_UNICODE_BREAK_NEXT_LINE] = 0xB1, [G_UNICODE_BREAK_WORD_JOINER] = 0x9D, [G_UNICODE_BREAK_HANGUL_V_JAMO] = 0x29,
+    [G_UNICODE_BREAK_HANGUL_T_JAMO] = 0x29, [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = 0x91, [G_UNICODE_BREAK_ZERO_WIDTH_JOINER] = 0xA1,
+  },
+  [G_UNICODE_BREAK_HANGUL_T_JAMO] = {
+    [G_UNICODE_BREAK_MANDATORY] = 0xB1, [G_UNICODE_BREAK_CARRIAGE_RETURN] = 0xB1, [G_UNICODE_BREAK_LINE_FEED] = 0xB1,
+    [G_UNICODE_BREAK_COMBINING_MARK] = 0xA1, [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = 0xAD, [G_UNICODE_BREAK_INSEPARABLE] = 0x1D,
+    [G_UNICODE_BREAK_NON_BREAKING_GLUE] = 0x99, [G_UNICODE_BREAK_CONTINGENT] = 0x73, [G_UNICODE_BREAK_SPACE] = 0xAD,
+    [G_UNICODE_BREAK_AFTER] = 0x65, [G_UNICODE_BREAK_HYPHEN] = 0x65, [G_UNICODE_BREAK_NON_STARTER] = 0x65,
+    [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = 0x91, [G_UNICODE_BREAK_QUOTATION] = 0x75, [G_UNICODE_BREAK_EXCLAMATION] = 0x8D,
+    [G_UNICODE_BREAK_INFIX_SEPARATOR] = 0x91, [G_UNICODE_BREAK_SYMBOL] = 0x91, [G_UNICODE_BREAK_POSTFIX] = 0x1D,
+    [G_UNICODE_BREAK_NEXT_LINE] = 0xB1, [G_UNICODE_BREAK_WORD_JOINER] = 0x9D, [G_UNICODE_BREAK_HANGUL_T_JAMO] = 0x2D,
+    [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = 0x91, [G_UNICODE_BREAK_ZERO_WIDTH_JOINER] = 0xA1,
+  },
+  [G_UNICODE_BREAK_HANGUL_LV_SYLLABLE] = {
+    [G_UNICODE_BREAK_MANDATORY] = 0xB1, [G_UNICODE_BREAK_CARRIAGE_RETURN] = 0xB1, [G_UNICODE_BREAK_LINE_FEED] = 0xB1,
+    [G_UNICODE_BREAK_COMBINING_MARK] = 0xA1, [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = 0xAD, [G_UNICODE_BREAK_INSEPARABLE] = 0x1D,
+    [G_UNICODE_BREAK_NON_BREAKING_GLUE] = 0x99, [G_UNICODE_BREAK_CONTINGENT] = 0x73, [G_UNICODE_BREAK_SPACE] = 0xAD,
+    [G_UNICODE_BREAK_AFTER] = 0x65, [G_UNICODE_BREAK_HYPHEN] = 0x65, [G_UNICODE_BREAK_NON_STARTER] = 0x65,
+    [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = 0x91, [G_UNICODE_BREAK_QUOTATION] = 0x75, [G_UNICODE_BREAK_EXCLAMATION] = 0x8D,
+    [G_UNICODE_BREAK_INFIX_SEPARATOR] = 0x91, [G_UNICODE_BREAK_SYMBOL] = 0x91, [G_UNICODE_BREAK_POSTFIX] = 0x1D,
+    [G_UNICODE_BREAK_NEXT_LINE] = 0xB1, [G_UNICODE_BREAK_WORD_JOINER] = 0x9D, [G_UNICODE_BREAK_HANGUL_V_JAMO] = 0x29,
+    [G_UNICODE_BREAK_HANGUL_T_JAMO] = 0x29, [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = 0x91, [G_UNICODE_BREAK_ZERO_WIDTH_JOINER] = 0xA1,
+  },
+  [G_UNICODE_BREAK_HANGUL_LVT_SYLLABLE] = {
+    [G_UNICODE_BREAK_MANDATORY] = 0xB1, [G_UNICODE_BREAK_CARRIAGE_RETURN] = 0xB1, [G_UNICODE_BREAK_LINE_FEED] = 0xB1,
+    [G_UNICODE_BREAK_COMBINING_MARK] = 0xA1, [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = 0xAD, [G_UNICODE_BREAK_INSEPARABLE] = 0x1D,
+    [G_UNICODE_BREAK_NON_BREAKING_GLUE] = 0x99, [G_UNICODE_BREAK_CONTINGENT] = 0x73, [G_UNICODE_BREAK_SPACE] = 0xAD,
+    [G_UNICODE_BREAK_AFTER] = 0x65, [G_UNICODE_BREAK_HYPHEN] = 0x65, [G_UNICODE_BREAK_NON_STARTER] = 0x65,
+    [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = 0x91, [G_UNICODE_BREAK_QUOTATION] = 0x75, [G_UNICODE_BREAK_EXCLAMATION] = 0x8D,
+    [G_UNICODE_BREAK_INFIX_SEPARATOR] = 0x91, [G_UNICODE_BREAK_SYMBOL] = 0x91, [G_UNICODE_BREAK_POSTFIX] = 0x1D,
+    [G_UNICODE_BREAK_NEXT_LINE] = 0xB1, [G_UNICODE_BREAK_WORD_JOINER] = 0x9D, [G_UNICODE_BREAK_HANGUL_T_JAMO] = 0x2D,
+    [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = 0x91, [G_UNICODE_BREAK_ZERO_WIDTH_JOINER] = 0xA1,
+  },
+  [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = {
+    [G_UNICODE_BREAK_MANDATORY] = 0xB1, [G_UNICODE_BREAK_CARRIAGE_RETURN] = 0xB1, [G_UNICODE_BREAK_LINE_FEED] = 0xB1,
+    [G_UNICODE_BREAK_COMBINING_MARK] = 0xA1, [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = 0xAD, [G_UNICODE_BREAK_NON_BREAKING_GLUE] = 0x99,
+    [G_UNICODE_BREAK_CONTINGENT] = 0x73, [G_UNICODE_BREAK_SPACE] = 0xAD, [G_UNICODE_BREAK_AFTER] = 0x65,
+    [G_UNICODE_BREAK_HYPHEN] = 0x65, [G_UNICODE_BREAK_NON_STARTER] = 0x81, [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = 0x91,
+    [G_UNICODE_BREAK_QUOTATION] = 0x75, [G_UNICODE_BREAK_EXCLAMATION] = 0x8D, [G_UNICODE_BREAK_NUMERIC] = 0x09,
+    [G_UNICODE_BREAK_INFIX_SEPARATOR] = 0x91, [G_UNICODE_BREAK_SYMBOL] = 0x91, [G_UNICODE_BREAK_ALPHABETIC] = 0x09,
+    [G_UNICODE_BREAK_NEXT_LINE] = 0xB1, [G_UNICODE_BREAK_WORD_JOINER] = 0x9D, [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = 0x91,
+    [G_UNICODE_BREAK_HEBREW_LETTER] = 0x09, [G_UNICODE_BREAK_ZERO_WIDTH_JOINER] = 0xA1,
+  },
+  [G_UNICODE_BREAK_CONDITIONAL_JAPANESE_STARTER] = {
+    [G_UNICODE_BREAK_MANDATORY] = 0xB1, [G_UNICODE_BREAK_CARRIAGE_RETURN] = 0xB1, [G_UNICODE_BREAK_LINE_FEED] = 0xB1,
+    [G_UNICODE_BREAK_COMBINING_MARK] = 0xA1, [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = 0xAD, [G_UNICODE_BREAK_NON_BREAKING_GLUE] = 0x99,
+    [G_UNICODE_BREAK_CONTINGENT] = 0x73, [G_UNICODE_BREAK_SPACE] = 0xAD, [G_UNICODE_BREAK_AFTER] = 0x65,
+    [G_UNICODE_BREAK_HYPHEN] = 0x65, [G_UNICODE_BREAK_NON_STARTER] = 0x65, [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = 0x91,
+    [G_UNICODE_BREAK_QUOTATION] = 0x75, [G_UNICODE_BREAK_EXCLAMATION] = 0x8D, [G_UNICODE_BREAK_INFIX_SEPARATOR] = 0x91,
+    [G_UNICODE_BREAK_SYMBOL] = 0x91, [G_UNICODE_BREAK_NEXT_LINE] = 0xB1, [G_UNICODE_BREAK_WORD_JOINER] = 0x9D,
+    [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = 0x91, [G_UNICODE_BREAK_ZERO_WIDTH_JOINER] = 0xA1,
+  },
+  [G_UNICODE_BREAK_HEBREW_LETTER] = {
+    [G_UNICODE_BREAK_MANDATORY] = 0xB1, [G_UNICODE_BREAK_CARRIAGE_RETURN] = 0xB1, [G_UNICODE_BREAK_LINE_FEED] = 0xB1,
+    [G_UNICODE_BREAK_COMBINING_MARK] = 0xA1, [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = 0xAD, [G_UNICODE_BREAK_INSEPARABLE] = 0x61,
+    [G_UNICODE_BREAK_NON_BREAKING_GLUE] = 0x99, [G_UNICODE_BREAK_CONTINGENT] = 0x73, [G_UNICODE_BREAK_SPACE] = 0xAD,
+    [G_UNICODE_BREAK_AFTER] = 0x65, [G_UNICODE_BREAK_HYPHEN] = 0x65, [G_UNICODE_BREAK_NON_STARTER] = 0x65,
+    [G_UNICODE_BREAK_OPEN_PUNCTUATION] = 0x05, [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = 0x91, [G_UNICODE_BREAK_QUOTATION] = 0x75,
+    [G_UNICODE_BREAK_EXCLAMATION] = 0x8D, [G_UNICODE_BREAK_NUMERIC] = 0x51, [G_UNICODE_BREAK_INFIX_SEPARATOR] = 0x91,
+    [G_UNICODE_BREAK_SYMBOL] = 0x91, [G_UNICODE_BREAK_ALPHABETIC] = 0x19, [G_UNICODE_BREAK_PREFIX] = 0x4D,
+    [G_UNICODE_BREAK_POSTFIX] = 0x4D, [G_UNICODE_BREAK_NEXT_LINE] = 0xB1, [G_UNICODE_BREAK_WORD_JOINER] = 0x9D,
+    [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = 0x91, [G_UNICODE_BREAK_HEBREW_LETTER] = 0x19, [G_UNICODE_BREAK_ZERO_WIDTH_JOINER] = 0xA1,
+  },
+  [G_UNICODE_BREAK_REGIONAL_INDICATOR] = {
+    [G_UNICODE_BREAK_MANDATORY] = 0xB1, [G_UNICODE_BREAK_CARRIAGE_RETURN] = 0xB1, [G_UNICODE_BREAK_LINE_FEED] = 0xB1,
+    [G_UNICODE_BREAK_COMBINING_MARK] = 0xA1, [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = 0xAD, [G_UNICODE_BREAK_NON_BREAKING_GLUE] = 0x99,
+    [G_UNICODE_BREAK_CONTINGENT] = 0x73, [G_UNICODE_BREAK_SPACE] = 0xAD, [G_UNICODE_BREAK_AFTER] = 0x65,
+    [G_UNICODE_BREAK_HYPHEN] = 0x65, [G_UNICODE_BREAK_NON_STARTER] = 0x65, [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = 0x91,
+    [G_UNICODE_BREAK_QUOTATION] = 0x75, [G_UNICODE_BREAK_EXCLAMATION] = 0x8D, [G_UNICODE_BREAK_INFIX_SEPARATOR] = 0x91,
+    [G_UNICODE_BREAK_SYMBOL] = 0x91, [G_UNICODE_BREAK_NEXT_LINE] = 0xB1, [G_UNICODE_BREAK_WORD_JOINER] = 0x9D,
+    [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = 0x91, [G_UNICODE_BREAK_ZERO_WIDTH_JOINER] = 0xA1,
+  },
+  [G_UNICODE_BREAK_EMOJI_BASE] = {
+    [G_UNICODE_BREAK_MANDATORY] = 0xB1, [G_UNICODE_BREAK_CARRIAGE_RETURN] = 0xB1, [G_UNICODE_BREAK_LINE_FEED] = 0xB1,
+    [G_UNICODE_BREAK_COMBINING_MARK] = 0xA1, [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = 0xAD, [G_UNICODE_BREAK_INSEPARABLE] = 0x61,
+    [G_UNICODE_BREAK_NON_BREAKING_GLUE] = 0x99, [G_UNICODE_BREAK_CONTINGENT] = 0x73, [G_UNICODE_BREAK_SPACE] = 0xAD,
+    [G_UNICODE_BREAK_AFTER] = 0x65, [G_UNICODE_BREAK_HYPHEN] = 0x65, [G_UNICODE_BREAK_NON_STARTER] = 0x65,
+    [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = 0x91, [G_UNICODE_BREAK_QUOTATION] = 0x75, [G_UNICODE_BREAK_EXCLAMATION] = 0x8D,
+    [G_UNICODE_BREAK_INFIX_SEPARATOR] = 0x91, [G_UNICODE_BREAK_SYMBOL] = 0x91, [G_UNICODE_BREAK_POSTFIX] = 0x5D,
+    [G_UNICODE_BREAK_NEXT_LINE] = 0xB1, [G_UNICODE_BREAK_WORD_JOINER] = 0x9D, [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = 0x91,
+    [G_UNICODE_BREAK_EMOJI_MODIFIER] = 0x11, [G_UNICODE_BREAK_ZERO_WIDTH_JOINER] = 0xA1,
+  },
+  [G_UNICODE_BREAK_EMOJI_MODIFIER] = {
+    [G_UNICODE_BREAK_MANDATORY] = 0xB1, [G_UNICODE_BREAK_CARRIAGE_RETURN] = 0xB1, [G_UNICODE_BREAK_LINE_FEED] = 0xB1,
+    [G_UNICODE_BREAK_COMBINING_MARK] = 0xA1, [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = 0xAD, [G_UNICODE_BREAK_INSEPARABLE] = 0x61,
+    [G_UNICODE_BREAK_NON_BREAKING_GLUE] = 0x99, [G_UNICODE_BREAK_CONTINGENT] = 0x73, [G_UNICODE_BREAK_SPACE] = 0xAD,
+    [G_UNICODE_BREAK_AFTER] = 0x65, [G_UNICODE_BREAK_HYPHEN] = 0x65, [G_UNICODE_BREAK_NON_STARTER] = 0x65,
+    [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = 0x91, [G_UNICODE_BREAK_QUOTATION] = 0x75, [G_UNICODE_BREAK_EXCLAMATION] = 0x8D,
+    [G_UNICODE_BREAK_INFIX_SEPARATOR] = 0x91, [G_UNICODE_BREAK_SYMBOL] = 0x91, [G_UNICODE_BREAK_POSTFIX] = 0x5D,
+    [G_UNICODE_BREAK_NEXT_LINE] = 0xB1, [G_UNICODE_BREAK_WORD_JOINER] = 0x9D, [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = 0x91,
+    [G_UNICODE_BREAK_ZERO_WIDTH_JOINER] = 0xA1,
+  },
+  [G_UNICODE_BREAK_ZERO_WIDTH_JOINER] = {
+    [G_UNICODE_BREAK_MANDATORY] = 0xB1, [G_UNICODE_BREAK_CARRIAGE_RETURN] = 0xB1, [G_UNICODE_BREAK_LINE_FEED] = 0xB1,
+    [G_UNICODE_BREAK_COMBINING_MARK] = 0xA1, [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = 0xAD, [G_UNICODE_BREAK_NON_BREAKING_GLUE] = 0x99,
+    [G_UNICODE_BREAK_CONTINGENT] = 0x73, [G_UNICODE_BREAK_SPACE] = 0xAD, [G_UNICODE_BREAK_AFTER] = 0x65,
+    [G_UNICODE_BREAK_HYPHEN] = 0x65, [G_UNICODE_BREAK_NON_STARTER] = 0x65, [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = 0x91,
+    [G_UNICODE_BREAK_QUOTATION] = 0x75, [G_UNICODE_BREAK_EXCLAMATION] = 0x8D, [G_UNICODE_BREAK_INFIX_SEPARATOR] = 0x91,
+    [G_UNICODE_BREAK_SYMBOL] = 0x91, [G_UNICODE_BREAK_NEXT_LINE] = 0xB1, [G_UNICODE_BREAK_WORD_JOINER] = 0x9D,
+    [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = 0x91, [G_UNICODE_BREAK_ZERO_WIDTH_JOINER] = 0xA1,
+  },
+};
+
+/* Indexed by the class before the spaces and the current class, for a previous class of SP */
+static const guint8 _vogue_line_break_space_table[LINE_BREAK_N_CLASSES][LINE_BREAK_N_CLASSES] = {
+  [G_UNICODE_BREAK_MANDATORY] = {
+    [G_UNICODE_BREAK_MANDATORY] = 0xB1, [G_UNICODE_BREAK_CARRIAGE_RETURN] = 0xB1, [G_UNICODE_BREAK_LINE_FEED] = 0xB1,
+    [G_UNICODE_BREAK_COMBINING_MARK] = 0x7B, [G_UNICODE_BREAK_SURROGATE] = 0x7B, [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = 0xAD,
+    [G_UNICODE_BREAK_INSEPARABLE] = 0x7B, [G_UNICODE_BREAK_NON_BREAKING_GLUE] = 0x7B, [G_UNICODE_BREAK_CONTINGENT] = 0x7B,
+    [G_UNICODE_BREAK_SPACE] = 0xAD, [G_UNICODE_BREAK_AFTER] = 0x7B, [G_UNICODE_BREAK_BEFORE] = 0x7B,
+    [G_UNICODE_BREAK_BEFORE_AND_AFTER] = 0x7B, [G_UNICODE_BREAK_HYPHEN] = 0x7B, [G_UNICODE_BREAK_NON_STARTER] = 0x7B,
+    [G_UNICODE_BREAK_OPEN_PUNCTUATION] = 0x7B, [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = 0x91, [G_UNICODE_BREAK_QUOTATION] = 0x7B,
+    [G_UNICODE_BREAK_EXCLAMATION] = 0x8D, [G_UNICODE_BREAK_IDEOGRAPHIC] = 0x7B, [G_UNICODE_BREAK_NUMERIC] = 0x7B,
+    [G_UNICODE_BREAK_INFIX_SEPARATOR] = 0x91, [G_UNICODE_BREAK_SYMBOL] = 0x91, [G_UNICODE_BREAK_ALPHABETIC] = 0x7B,
+    [G_UNICODE_BREAK_PREFIX] = 0x7B, [G_UNICODE_BREAK_POSTFIX] = 0x7B, [G_UNICODE_BREAK_COMPLEX_CONTEXT] = 0x7B,
+    [G_UNICODE_BREAK_AMBIGUOUS] = 0x7B, [G_UNICODE_BREAK_UNKNOWN] = 0x7B, [G_UNICODE_BREAK_NEXT_LINE] = 0xB1,
+    [G_UNICODE_BREAK_WORD_JOINER] = 0x9D, [G_UNICODE_BREAK_HANGUL_L_JAMO] = 0x7B, [G_UNICODE_BREAK_HANGUL_V_JAMO] = 0x7B,
+    [G_UNICODE_BREAK_HANGUL_T_JAMO] = 0x7B, [G_UNICODE_BREAK_HANGUL_LV_SYLLABLE] = 0x7B, [G_UNICODE_BREAK_HANGUL_LVT_SYLLABLE] = 0x7B,
+    [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = 0x91, [G_UNICODE_BREAK_CONDITIONAL_JAPANESE_STARTER] = 0x7B, [G_UNICODE_BREAK_HEBREW_LETTER] = 0x7B,
+    [G_UNICODE_BREAK_REGIONAL_INDICATOR] = 0x7B, [G_UNICODE_BREAK_EMOJI_BASE] = 0x7B, [G_UNICODE_BREAK_EMOJI_MODIFIER] = 0x7B,
+    [G_UNICODE_BREAK_ZERO_WIDTH_JOINER] = 0x7B,
+  },
+  [G_UNICODE_BREAK_CARRIAGE_RETURN] = {
+    [G_UNICODE_BREAK_MANDATORY] = 0xB1, [G_UNICODE_BREAK_CARRIAGE_RETURN] = 0xB1, [G_UNICODE_BREAK_LINE_FEED] = 0xB1,
+    [G_UNICODE_BREAK_COMBINING_MARK] = 0x7B, [G_UNICODE_BREAK_SURROGATE] = 0x7B, [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = 0xAD,
+    [G_UNICODE_BREAK_INSEPARABLE] = 0x7B, [G_UNICODE_BREAK_NON_BREAKING_GLUE] = 0x7B, [G_UNICODE_BREAK_CONTINGENT] = 0x7B,
+    [G_UNICODE_BREAK_SPACE] = 0xAD, [G_UNICODE_BREAK_AFTER] = 0x7B, [G_UNICODE_BREAK_BEFORE] = 0x7B,
+    [G_UNICODE_BREAK_BEFORE_AND_AFTER] = 0x7B, [G_UNICODE_BREAK_HYPHEN] = 0x7B, [G_UNICODE_BREAK_NON_STARTER] = 0x7B,
+    [G_UNICODE_BREAK_OPEN_PUNCTUATION] = 0x7B, [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = 0x91, [G_UNICODE_BREAK_QUOTATION] = 0x7B,
+    [G_UNICODE_BREAK_EXCLAMATION] = 0x8D, [G_UNICODE_BREAK_IDEOGRAPHIC] = 0x7B, [G_UNICODE_BREAK_NUMERIC] = 0x7B,
+    [G_UNICODE_BREAK_INFIX_SEPARATOR] = 0x91, [G_UNICODE_BREAK_SYMBOL] = 0x91, [G_UNICODE_BREAK_ALPHABETIC] = 0x7B,
+    [G_UNICODE_BREAK_PREFIX] = 0x7B, [G_UNICODE_BREAK_POSTFIX] = 0x7B, [G_UNICODE_BREAK_COMPLEX_CONTEXT] = 0x7B,
+    [G_UNICODE_BREAK_AMBIGUOUS] = 0x7B, [G_UNICODE_BREAK_UNKNOWN] = 0x7B, [G_UNICODE_BREAK_NEXT_LINE] = 0xB1,
+    [G_UNICODE_BREAK_WORD_JOINER] = 0x9D, [G_UNICODE_BREAK_HANGUL_L_JAMO] = 0x7B, [G_UNICODE_BREAK_HANGUL_V_JAMO] = 0x7B,
+    [G_UNICODE_BREAK_HANGUL_T_JAMO] = 0x7B, [G_UNICODE_BREAK_HANGUL_LV_SYLLABLE] = 0x7B, [G_UNICODE_BREAK_HANGUL_LVT_SYLLABLE] = 0x7B,
+    [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = 0x91, [G_UNICODE_BREAK_CONDITIONAL_JAPANESE_STARTER] = 0x7B, [G_UNICODE_BREAK_HEBREW_LETTER] = 0x7B,
+    [G_UNICODE_BREAK_REGIONAL_INDICATOR] = 0x7B, [G_UNICODE_BREAK_EMOJI_BASE] = 0x7B, [G_UNICODE_BREAK_EMOJI_MODIFIER] = 0x7B,
+    [G_UNICODE_BREAK_ZERO_WIDTH_JOINER] = 0x7B,
+  },
+  [G_UNICODE_BREAK_LINE_FEED] = {
+    [G_UNICODE_BREAK_MANDATORY] = 0xB1, [G_UNICODE_BREAK_CARRIAGE_RETURN] = 0xB1, [G_UNICODE_BREAK_LINE_FEED] = 0xB1,
+    [G_UNICODE_BREAK_COMBINING_MARK] = 0x7B, [G_UNICODE_BREAK_SURROGATE] = 0x7B, [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = 0xAD,
+    [G_UNICODE_BREAK_INSEPARABLE] = 0x7B, [G_UNICODE_BREAK_NON_BREAKING_GLUE] = 0x7B, [G_UNICODE_BREAK_CONTINGENT] = 0x7B,
+    [G_UNICODE_BREAK_SPACE] = 0xAD, [G_UNICODE_BREAK_AFTER] = 0x7B, [G_UNICODE_BREAK_BEFORE] = 0x7B,
+    [G_UNICODE_BREAK_BEFORE_AND_AFTER] = 0x7B, [G_UNICODE_BREAK_HYPHEN] = 0x7B, [G_UNICODE_BREAK_NON_STARTER] = 0x7B,
+    [G_UNICODE_BREAK_OPEN_PUNCTUATION] = 0x7B, [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = 0x91, [G_UNICODE_BREAK_QUOTATION] = 0x7B,
+    [G_UNICODE_BREAK_EXCLAMATION] = 0x8D, [G_UNICODE_BREAK_IDEOGRAPHIC] = 0x7B, [G_UNICODE_BREAK_NUMERIC] = 0x7B,
+    [G_UNICODE_BREAK_INFIX_SEPARATOR] = 0x91, [G_UNICODE_BREAK_SYMBOL] = 0x91, [G_UNICODE_BREAK_ALPHABETIC] = 0x7B,
+    [G_UNICODE_BREAK_PREFIX] = 0x7B, [G_UNICODE_BREAK_POSTFIX] = 0x7B, [G_UNICODE_BREAK_COMPLEX_CONTEXT] = 0x7B,
+    [G_UNICODE_BREAK_AMBIGUOUS] = 0x7B, [G_UNICODE_BREAK_UNKNOWN] = 0x7B, [G_UNICODE_BREAK_NEXT_LINE] = 0xB1,
+    [G_UNICODE_BREAK_WORD_JOINER] = 0x9D, [G_UNICODE_BREAK_HANGUL_L_JAMO] = 0x7B, [G_UNICODE_BREAK_HANGUL_V_JAMO] = 0x7B,
+    [G_UNICODE_BREAK_HANGUL_T_JAMO] = 0x7B, [G_UNICODE_BREAK_HANGUL_LV_SYLLABLE] = 0x7B, [G_UNICODE_BREAK_HANGUL_LVT_SYLLABLE] = 0x7B,
+    [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = 0x91, [G_UNICODE_BREAK_CONDITIONAL_JAPANESE_STARTER] = 0x7B, [G_UNICODE_BREAK_HEBREW_LETTER] = 0x7B,
+    [G_UNICODE_BREAK_REGIONAL_INDICATOR] = 0x7B, [G_UNICODE_BREAK_EMOJI_BASE] = 0x7B, [G_UNICODE_BREAK_EMOJI_MODIFIER] = 0x7B,
+    [G_UNICODE_BREAK_ZERO_WIDTH_JOINER] = 0x7B,
+  },
+  [G_UNICODE_BREAK_COMBINING_MARK] = {
+    [G_UNICODE_BREAK_MANDATORY] = 0xB1, [G_UNICODE_BREAK_CARRIAGE_RETURN] = 0xB1, [G_UNICODE_BREAK_LINE_FEED] = 0xB1,
+    [G_UNICODE_BREAK_COMBINING_MARK] = 0x7B, [G_UNICODE_BREAK_SURROGATE] = 0x7B, [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = 0xAD,
+    [G_UNICODE_BREAK_INSEPARABLE] = 0x7B, [G_UNICODE_BREAK_NON_BREAKING_GLUE] = 0x7B, [G_UNICODE_BREAK_CONTINGENT] = 0x7B,
+    [G_UNICODE_BREAK_SPACE] = 0xAD, [G_UNICODE_BREAK_AFTER] = 0x7B, [G_UNICODE_BREAK_BEFORE] = 0x7B,
+    [G_UNICODE_BREAK_BEFORE_AND_AFTER] = 0x7B, [G_UNICODE_BREAK_HYPHEN] = 0x7B, [G_UNICODE_BREAK_NON_STARTER] = 0x7B,
+    [G_UNICODE_BREAK_OPEN_PUNCTUATION] = 0x7B, [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = 0x91, [G_UNICODE_BREAK_QUOTATION] = 0x7B,
+    [G_UNICODE_BREAK_EXCLAMATION] = 0x8D, [G_UNICODE_BREAK_IDEOGRAPHIC] = 0x7B, [G_UNICODE_BREAK_NUMERIC] = 0x7B,
+    [G_UNICODE_BREAK_INFIX_SEPARATOR] = 0x91, [G_UNICODE_BREAK_SYMBOL] = 0x91, [G_UNICODE_BREAK_ALPHABETIC] = 0x7B,
+    [G_UNICODE_BREAK_PREFIX] = 0x7B, [G_UNICODE_BREAK_POSTFIX] = 0x7B, [G_UNICODE_BREAK_COMPLEX_CONTEXT] = 0x7B,
+    [G_UNICODE_BREAK_AMBIGUOUS] = 0x7B, [G_UNICODE_BREAK_UNKNOWN] = 0x7B, [G_UNICODE_BREAK_NEXT_LINE] = 0xB1,
+    [G_UNICODE_BREAK_WORD_JOINER] = 0x9D, [G_UNICODE_BREAK_HANGUL_L_JAMO] = 0x7B, [G_UNICODE_BREAK_HANGUL_V_JAMO] = 0x7B,
+    [G_UNICODE_BREAK_HANGUL_T_JAMO] = 0x7B, [G_UNICODE_BREAK_HANGUL_LV_SYLLABLE] = 0x7B, [G_UNICODE_BREAK_HANGUL_LVT_SYLLABLE] = 0x7B,
+    [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = 0x91, [G_UNICODE_BREAK_CONDITIONAL_JAPANESE_STARTER] = 0x7B, [G_UNICODE_BREAK_HEBREW_LETTER] = 0x7B,
+    [G_UNICODE_BREAK_REGIONAL_INDICATOR] = 0x7B, [G_UNICODE_BREAK_EMOJI_BASE] = 0x7B, [G_UNICODE_BREAK_EMOJI_MODIFIER] = 0x7B,
+    [G_UNICODE_BREAK_ZERO_WIDTH_JOINER] = 0x7B,
+  },
+  [G_UNICODE_BREAK_SURROGATE] = {
+    [G_UNICODE_BREAK_MANDATORY] = 0xB1, [G_UNICODE_BREAK_CARRIAGE_RETURN] = 0xB1, [G_UNICODE_BREAK_LINE_FEED] = 0xB1,
+    [G_UNICODE_BREAK_COMBINING_MARK] = 0x7B, [G_UNICODE_BREAK_SURROGATE] = 0x7B, [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = 0xAD,
+    [G_UNICODE_BREAK_INSEPARABLE] = 0x7B, [G_UNICODE_BREAK_NON_BREAKING_GLUE] = 0x7B, [G_UNICODE_BREAK_CONTINGENT] = 0x7B,
+    [G_UNICODE_BREAK_SPACE] = 0xAD, [G_UNICODE_BREAK_AFTER] = 0x7B, [G_UNICODE_BREAK_BEFORE] = 0x7B,
+    [G_UNICODE_BREAK_BEFORE_AND_AFTER] = 0x7B, [G_UNICODE_BREAK_HYPHEN] = 0x7B, [G_UNICODE_BREAK_NON_STARTER] = 0x7B,
+    [G_UNICODE_BREAK_OPEN_PUNCTUATION] = 0x7B, [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = 0x91, [G_UNICODE_BREAK_QUOTATION] = 0x7B,
+    [G_UNICODE_BREAK_EXCLAMATION] = 0x8D, [G_UNICODE_BREAK_IDEOGRAPHIC] = 0x7B, [G_UNICODE_BREAK_NUMERIC] = 0x7B,
+    [G_UNICODE_BREAK_INFIX_SEPARATOR] = 0x91, [G_UNICODE_BREAK_SYMBOL] = 0x91, [G_UNICODE_BREAK_ALPHABETIC] = 0x7B,
+    [G_UNICODE_BREAK_PREFIX] = 0x7B, [G_UNICODE_BREAK_POSTFIX] = 0x7B, [G_UNICODE_BREAK_COMPLEX_CONTEXT] = 0x7B,
+    [G_UNICODE_BREAK_AMBIGUOUS] = 0x7B, [G_UNICODE_BREAK_UNKNOWN] = 0x7B, [G_UNICODE_BREAK_NEXT_LINE] = 0xB1,
+    [G_UNICODE_BREAK_WORD_JOINER] = 0x9D, [G_UNICODE_BREAK_HANGUL_L_JAMO] = 0x7B, [G_UNICODE_BREAK_HANGUL_V_JAMO] = 0x7B,
+    [G_UNICODE_BREAK_HANGUL_T_JAMO] = 0x7B, [G_UNICODE_BREAK_HANGUL_LV_SYLLABLE] = 0x7B, [G_UNICODE_BREAK_HANGUL_LVT_SYLLABLE] = 0x7B,
+    [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = 0x91, [G_UNICODE_BREAK_CONDITIONAL_JAPANESE_STARTER] = 0x7B, [G_UNICODE_BREAK_HEBREW_LETTER] = 0x7B,
+    [G_UNICODE_BREAK_REGIONAL_INDICATOR] = 0x7B, [G_UNICODE_BREAK_EMOJI_BASE] = 0x7B, [G_UNICODE_BREAK_EMOJI_MODIFIER] = 0x7B,
+    [G_UNICODE_BREAK_ZERO_WIDTH_JOINER] = 0x7B,
+  },
+  [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = {
+    [G_UNICODE_BREAK_MANDATORY] = 0xB1, [G_UNICODE_BREAK_CARRIAGE_RETURN] = 0xB1, [G_UNICODE_BREAK_LINE_FEED] = 0xB1,
+    [G_UNICODE_BREAK_COMBINING_MARK] = 0xA7, [G_UNICODE_BREAK_SURROGATE] = 0xA7, [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = 0xAD,
+    [G_UNICODE_BREAK_INSEPARABLE] = 0xA7, [G_UNICODE_BREAK_NON_BREAKING_GLUE] = 0xA7, [G_UNICODE_BREAK_CONTINGENT] = 0xA7,
+    [G_UNICODE_BREAK_SPACE] = 0xAD, [G_UNICODE_BREAK_AFTER] = 0xA7, [G_UNICODE_BREAK_BEFORE] = 0xA7,
+    [G_UNICODE_BREAK_BEFORE_AND_AFTER] = 0xA7, [G_UNICODE_BREAK_HYPHEN] = 0xA7, [G_UNICODE_BREAK_NON_STARTER] = 0xA7,
+    [G_UNICODE_BREAK_OPEN_PUNCTUATION] = 0xA7, [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = 0xA7, [G_UNICODE_BREAK_QUOTATION] = 0xA7,
+    [G_UNICODE_BREAK_EXCLAMATION] = 0xA7, [G_UNICODE_BREAK_IDEOGRAPHIC] = 0xA7, [G_UNICODE_BREAK_NUMERIC] = 0xA7,
+    [G_UNICODE_BREAK_INFIX_SEPARATOR] = 0xA7, [G_UNICODE_BREAK_SYMBOL] = 0xA7, [G_UNICODE_BREAK_ALPHABETIC] = 0xA7,
+    [G_UNICODE_BREAK_PREFIX] = 0xA7, [G_UNICODE_BREAK_POSTFIX] = 0xA7, [G_UNICODE_BREAK_COMPLEX_CONTEXT] = 0xA7,
+    [G_UNICODE_BREAK_AMBIGUOUS] = 0xA7, [G_UNICODE_BREAK_UNKNOWN] = 0xA7, [G_UNICODE_BREAK_NEXT_LINE] = 0xB1,
+    [G_UNICODE_BREAK_WORD_JOINER] = 0xA7, [G_UNICODE_BREAK_HANGUL_L_JAMO] = 0xA7, [G_UNICODE_BREAK_HANGUL_V_JAMO] = 0xA7,
+    [G_UNICODE_BREAK_HANGUL_T_JAMO] = 0xA7, [G_UNICODE_BREAK_HANGUL_LV_SYLLABLE] = 0xA7, [G_UNICODE_BREAK_HANGUL_LVT_SYLLABLE] = 0xA7,
+    [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = 0xA7, [G_UNICODE_BREAK_CONDITIONAL_JAPANESE_STARTER] = 0xA7, [G_UNICODE_BREAK_HEBREW_LETTER] = 0xA7,
+    [G_UNICODE_BREAK_REGIONAL_INDICATOR] = 0xA7, [G_UNICODE_BREAK_EMOJI_BASE] = 0xA7, [G_UNICODE_BREAK_EMOJI_MODIFIER] = 0xA7,
+    [G_UNICODE_BREAK_ZERO_WIDTH_JOINER] = 0xA7,
+  },
+  [G_UNICODE_BREAK_INSEPARABLE] = {
+    [G_UNICODE_BREAK_MANDATORY] = 0xB1, [G_UNICODE_BREAK_CARRIAGE_RETURN] = 0xB1, [G_UNICODE_BREAK_LINE_FEED] = 0xB1,
+    [G_UNICODE_BREAK_COMBINING_MARK] = 0x7B, [G_UNICODE_BREAK_SURROGATE] = 0x7B, [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = 0xAD,
+    [G_UNICODE_BREAK_INSEPARABLE] = 0x7B, [G_UNICODE_BREAK_NON_BREAKING_GLUE] = 0x7B, [G_UNICODE_BREAK_CONTINGENT] = 0x7B,
+    [G_UNICODE_BREAK_SPACE] = 0xAD, [G_UNICODE_BREAK_AFTER] = 0x7B, [G_UNICODE_BREAK_BEFORE] = 0x7B,
+    [G_UNICODE_BREAK_BEFORE_AND_AFTER] = 0x7B, [G_UNICODE_BREAK_HYPHEN] = 0x7B, [G_UNICODE_BREAK_NON_STARTER] = 0x7B,
+    [G_UNICODE_BREAK_OPEN_PUNCTUATION] = 0x7B, [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = 0x91, [G_UNICODE_BREAK_QUOTATION] = 0x7B,
+    [G_UNICODE_BREAK_EXCLAMATION] = 0x8D, [G_UNICODE_BREAK_IDEOGRAPHIC] = 0x7B, [G_UNICODE_BREAK_NUMERIC] = 0x7B,
+    [G_UNICODE_BREAK_INFIX_SEPARATOR] = 0x91, [G_UNICODE_BREAK_SYMBOL] = 0x91, [G_UNICODE_BREAK_ALPHABETIC] = 0x7B,
+    [G_UNICODE_BREAK_PREFIX] = 0x7B, [G_UNICODE_BREAK_POSTFIX] = 0x7B, [G_UNICODE_BREAK_COMPLEX_CONTEXT] = 0x7B,
+    [G_UNICODE_BREAK_AMBIGUOUS] = 0x7B, [G_UNICODE_BREAK_UNKNOWN] = 0x7B, [G_UNICODE_BREAK_NEXT_LINE] = 0xB1,
+    [G_UNICODE_BREAK_WORD_JOINER] = 0x9D, [G_UNICODE_BREAK_HANGUL_L_JAMO] = 0x7B, [G_UNICODE_BREAK_HANGUL_V_JAMO] = 0x7B,
+    [G_UNICODE_BREAK_HANGUL_T_JAMO] = 0x7B, [G_UNICODE_BREAK_HANGUL_LV_SYLLABLE] = 0x7B, [G_UNICODE_BREAK_HANGUL_LVT_SYLLABLE] = 0x7B,
+    [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = 0x91, [G_UNICODE_BREAK_CONDITIONAL_JAPANESE_STARTER] = 0x7B, [G_UNICODE_BREAK_HEBREW_LETTER] = 0x7B,
+    [G_UNICODE_BREAK_REGIONAL_INDICATOR] = 0x7B, [G_UNICODE_BREAK_EMOJI_BASE] = 0x7B, [G_UNICODE_BREAK_EMOJI_MODIFIER] = 0x7B,
+    [G_UNICODE_BREAK_ZERO_WIDTH_JOINER] = 0x7B,
+  },
+  [G_UNICODE_BREAK_NON_BREAKING_GLUE] = {
+    [G_UNICODE_BREAK_MANDATORY] = 0xB1, [G_UNICODE_BREAK_CARRIAGE_RETURN] = 0xB1, [G_UNICODE_BREAK_LINE_FEED] = 0xB1,
+    [G_UNICODE_BREAK_COMBINING_MARK] = 0x7B, [G_UNICODE_BREAK_SURROGATE] = 0x7B, [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = 0xAD,
+    [G_UNICODE_BREAK_INSEPARABLE] = 0x7B, [G_UNICODE_BREAK_NON_BREAKING_GLUE] = 0x7B, [G_UNICODE_BREAK_CONTINGENT] = 0x7B,
+    [G_UNICODE_BREAK_SPACE] = 0xAD, [G_UNICODE_BREAK_AFTER] = 0x7B, [G_UNICODE_BREAK_BEFORE] = 0x7B,
+    [G_UNICODE_BREAK_BEFORE_AND_AFTER] = 0x7B, [G_UNICODE_BREAK_HYPHEN] = 0x7B, [G_UNICODE_BREAK_NON_STARTER] = 0x7B,
+    [G_UNICODE_BREAK_OPEN_PUNCTUATION] = 0x7B, [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = 0x91, [G_UNICODE_BREAK_QUOTATION] = 0x7B,
+    [G_UNICODE_BREAK_EXCLAMATION] = 0x8D, [G_UNICODE_BREAK_IDEOGRAPHIC] = 0x7B, [G_UNICODE_BREAK_NUMERIC] = 0x7B,
+    [G_UNICODE_BREAK_INFIX_SEPARATOR] = 0x91, [G_UNICODE_BREAK_SYMBOL] = 0x91, [G_UNICODE_BREAK_ALPHABETIC] = 0x7B,
+    [G_UNICODE_BREAK_PREFIX] = 0x7B, [G_UNICODE_BREAK_POSTFIX] = 0x7B, [G_UNICODE_BREAK_COMPLEX_CONTEXT] = 0x7B,
+    [G_UNICODE_BREAK_AMBIGUOUS] = 0x7B, [G_UNICODE_BREAK_UNKNOWN] = 0x7B, [G_UNICODE_BREAK_NEXT_LINE] = 0xB1,
+    [G_UNICODE_BREAK_WORD_JOINER] = 0x9D, [G_UNICODE_BREAK_HANGUL_L_JAMO] = 0x7B, [G_UNICODE_BREAK_HANGUL_V_JAMO] = 0x7B,
+    [G_UNICODE_BREAK_HANGUL_T_JAMO] = 0x7B, [G_UNICODE_BREAK_HANGUL_LV_SYLLABLE] = 0x7B, [G_UNICODE_BREAK_HANGUL_LVT_SYLLABLE] = 0x7B,
+    [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = 0x91, [G_UNICODE_BREAK_CONDITIONAL_JAPANESE_STARTER] = 0x7B, [G_UNICODE_BREAK_HEBREW_LETTER] = 0x7B,
+    [G_UNICODE_BREAK_REGIONAL_INDICATOR] = 0x7B, [G_UNICODE_BREAK_EMOJI_BASE] = 0x7B, [G_UNICODE_BREAK_EMOJI_MODIFIER] = 0x7B,
+    [G_UNICODE_BREAK_ZERO_WIDTH_JOINER] = 0x7B,
+  },
+  [G_UNICODE_BREAK_CONTINGENT] = {
+    [G_UNICODE_BREAK_MANDATORY] = 0xB1, [G_UNICODE_BREAK_CARRIAGE_RETURN] = 0xB1, [G_UNICODE_BREAK_LINE_FEED] = 0xB1,
+    [G_UNICODE_BREAK_COMBINING_MARK] = 0x7B, [G_UNICODE_BREAK_SURROGATE] = 0x7B, [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = 0xAD,
+    [G_UNICODE_BREAK_INSEPARABLE] = 0x7B, [G_UNICODE_BREAK_NON_BREAKING_GLUE] = 0x7B, [G_UNICODE_BREAK_CONTINGENT] = 0x7B,
+    [G_UNICODE_BREAK_SPACE] = 0xAD, [G_UNICODE_BREAK_AFTER] = 0x7B, [G_UNICODE_BREAK_BEFORE] = 0x7B,
+    [G_UNICODE_BREAK_BEFORE_AND_AFTER] = 0x7B, [G_UNICODE_BREAK_HYPHEN] = 0x7B, [G_UNICODE_BREAK_NON_STARTER] = 0x7B,
+    [G_UNICODE_BREAK_OPEN_PUNCTUATION] = 0x7B, [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = 0x91, [G_UNICODE_BREAK_QUOTATION] = 0x7B,
+    [G_UNICODE_BREAK_EXCLAMATION] = 0x8D, [G_UNICODE_BREAK_IDEOGRAPHIC] = 0x7B, [G_UNICODE_BREAK_NUMERIC] = 0x7B,
+    [G_UNICODE_BREAK_INFIX_SEPARATOR] = 0x91, [G_UNICODE_BREAK_SYMBOL] = 0x91, [G_UNICODE_BREAK_ALPHABETIC] = 0x7B,
+    [G_UNICODE_BREAK_PREFIX] = 0x7B, [G_UNICODE_BREAK_POSTFIX] = 0x7B, [G_UNICODE_BREAK_COMPLEX_CONTEXT] = 0x7B,
+    [G_UNICODE_BREAK_AMBIGUOUS] = 0x7B, [G_UNICODE_BREAK_UNKNOWN] = 0x7B, [G_UNICODE_BREAK_NEXT_LINE] = 0xB1,
+    [G_UNICODE_BREAK_WORD_JOINER] = 0x9D, [G_UNICODE_BREAK_HANGUL_L_JAMO] = 0x7B, [G_UNICODE_BREAK_HANGUL_V_JAMO] = 0x7B,
+    [G_UNICODE_BREAK_HANGUL_T_JAMO] = 0x7B, [G_UNICODE_BREAK_HANGUL_LV_SYLLABLE] = 0x7B, [G_UNICODE_BREAK_HANGUL_LVT_SYLLABLE] = 0x7B,
+    [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = 0x91, [G_UNICODE_BREAK_CONDITIONAL_JAPANESE_STARTER] = 0x7B, [G_UNICODE_BREAK_HEBREW_LETTER] = 0x7B,
+    [G_UNICODE_BREAK_REGIONAL_INDICATOR] = 0x7B, [G_UNICODE_BREAK_EMOJI_BASE] = 0x7B, [G_UNICODE_BREAK_EMOJI_MODIFIER] = 0x7B,
+    [G_UNICODE_BREAK_ZERO_WIDTH_JOINER] = 0x7B,
+  },
+  [G_UNICODE_BREAK_AFTER] = {
+    [G_UNICODE_BREAK_MANDATORY] = 0xB1, [G_UNICODE_BREAK_CARRIAGE_RETURN] = 0xB1, [G_UNICODE_BREAK_LINE_FEED] = 0xB1,
+    [G_UNICODE_BREAK_COMBINING_MARK] = 0x7B, [G_UNICODE_BREAK_SURROGATE] = 0x7B, [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = 0xAD,
+    [G_UNICODE_BREAK_INSEPARABLE] = 0x7B, [G_UNICODE_BREAK_NON_BREAKING_GLUE] = 0x7B, [G_UNICODE_BREAK_CONTINGENT] = 0x7B,
+    [G_UNICODE_BREAK_SPACE] = 0xAD, [G_UNICODE_BREAK_AFTER] = 0x7B, [G_UNICODE_BREAK_BEFORE] = 0x7B,
+    [G_UNICODE_BREAK_BEFORE_AND_AFTER] = 0x7B, [G_UNICODE_BREAK_HYPHEN] = 0x7B, [G_UNICODE_BREAK_NON_STARTER] = 0x7B,
+    [G_UNICODE_BREAK_OPEN_PUNCTUATION] = 0x7B, [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = 0x91, [G_UNICODE_BREAK_QUOTATION] = 0x7B,
+    [G_UNICODE_BREAK_EXCLAMATION] = 0x8D, [G_UNICODE_BREAK_IDEOGRAPHIC] = 0x7B, [G_UNICODE_BREAK_NUMERIC] = 0x7B,
+    [G_UNICODE_BREAK_INFIX_SEPARATOR] = 0x91, [G_UNICODE_BREAK_SYMBOL] = 0x91, [G_UNICODE_BREAK_ALPHABETIC] = 0x7B,
+    [G_UNICODE_BREAK_PREFIX] = 0x7B, [G_UNICODE_BREAK_POSTFIX] = 0x7B, [G_UNICODE_BREAK_COMPLEX_CONTEXT] = 0x7B,
+    [G_UNICODE_BREAK_AMBIGUOUS] = 0x7B, [G_UNICODE_BREAK_UNKNOWN] = 0x7B, [G_UNICODE_BREAK_NEXT_LINE] = 0xB1,
+    [G_UNICODE_BREAK_WORD_JOINER] = 0x9D, [G_UNICODE_BREAK_HANGUL_L_JAMO] = 0x7B, [G_UNICODE_BREAK_HANGUL_V_JAMO] = 0x7B,
+    [G_UNICODE_BREAK_HANGUL_T_JAMO] = 0x7B, [G_UNICODE_BREAK_HANGUL_LV_SYLLABLE] = 0x7B, [G_UNICODE_BREAK_HANGUL_LVT_SYLLABLE] = 0x7B,
+    [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = 0x91, [G_UNICODE_BREAK_CONDITIONAL_JAPANESE_STARTER] = 0x7B, [G_UNICODE_BREAK_HEBREW_LETTER] = 0x7B,
+    [G_UNICODE_BREAK_REGIONAL_INDICATOR] = 0x7B, [G_UNICODE_BREAK_EMOJI_BASE] = 0x7B, [G_UNICODE_BREAK_EMOJI_MODIFIER] = 0x7B,
+    [G_UNICODE_BREAK_ZERO_WIDTH_JOINER] = 0x7B,
+  },
+  [G_UNICODE_BREAK_BEFORE] = {
+    [G_UNICODE_BREAK_MANDATORY] = 0xB1, [G_UNICODE_BREAK_CARRIAGE_RETURN] = 0xB1, [G_UNICODE_BREAK_LINE_FEED] = 0xB1,
+    [G_UNICODE_BREAK_COMBINING_MARK] = 0x7B, [G_UNICODE_BREAK_SURROGATE] = 0x7B, [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = 0xAD,
+    [G_UNICODE_BREAK_INSEPARABLE] = 0x7B, [G_UNICODE_BREAK_NON_BREAKING_GLUE] = 0x7B, [G_UNICODE_BREAK_CONTINGENT] = 0x7B,
+    [G_UNICODE_BREAK_SPACE] = 0xAD, [G_UNICODE_BREAK_AFTER] = 0x7B, [G_UNICODE_BREAK_BEFORE] = 0x7B,
+    [G_UNICODE_BREAK_BEFORE_AND_AFTER] = 0x7B, [G_UNICODE_BREAK_HYPHEN] = 0x7B, [G_UNICODE_BREAK_NON_STARTER] = 0x7B,
+    [G_UNICODE_BREAK_OPEN_PUNCTUATION] = 0x7B, [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = 0x91, [G_UNICODE_BREAK_QUOTATION] = 0x7B,
+    [G_UNICODE_BREAK_EXCLAMATION] = 0x8D, [G_UNICODE_BREAK_IDEOGRAPHIC] = 0x7B, [G_UNICODE_BREAK_NUMERIC] = 0x7B,
+    [G_UNICODE_BREAK_INFIX_SEPARATOR] = 0x91, [G_UNICODE_BREAK_SYMBOL] = 0x91, [G_UNICODE_BREAK_ALPHABETIC] = 0x7B,
+    [G_UNICODE_BREAK_PREFIX] = 0x7B, [G_UNICODE_BREAK_POSTFIX] = 0x7B, [G_UNICODE_BREAK_COMPLEX_CONTEXT] = 0x7B,
+    [G_UNICODE_BREAK_AMBIGUOUS] = 0x7B, [G_UNICODE_BREAK_UNKNOWN] = 0x7B, [G_UNICODE_BREAK_NEXT_LINE] = 0xB1,
+    [G_UNICODE_BREAK_WORD_JOINER] = 0x9D, [G_UNICODE_BREAK_HANGUL_L_JAMO] = 0x7B, [G_UNICODE_BREAK_HANGUL_V_JAMO] = 0x7B,
+    [G_UNICODE_BREAK_HANGUL_T_JAMO] = 0x7B, [G_UNICODE_BREAK_HANGUL_LV_SYLLABLE] = 0x7B, [G_UNICODE_BREAK_HANGUL_LVT_SYLLABLE] = 0x7B,
+    [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = 0x91, [G_UNICODE_BREAK_CONDITIONAL_JAPANESE_STARTER] = 0x7B, [G_UNICODE_BREAK_HEBREW_LETTER] = 0x7B,
+    [G_UNICODE_BREAK_REGIONAL_INDICATOR] = 0x7B, [G_UNICODE_BREAK_EMOJI_BASE] = 0x7B, [G_UNICODE_BREAK_EMOJI_MODIFIER] = 0x7B,
+    [G_UNICODE_BREAK_ZERO_WIDTH_JOINER] = 0x7B,
+  },
+  [G_UNICODE_BREAK_BEFORE_AND_AFTER] = {
+    [G_UNICODE_BREAK_MANDATORY] = 0xB1, [G_UNICODE_BREAK_CARRIAGE_RETURN] = 0xB1, [G_UNICODE_BREAK_LINE_FEED] = 0xB1,
+    [G_UNICODE_BREAK_COMBINING_MARK] = 0x7B, [G_UNICODE_BREAK_SURROGATE] = 0x7B, [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = 0xAD,
+    [G_UNICODE_BREAK_INSEPARABLE] = 0x7B, [G_UNICODE_BREAK_NON_BREAKING_GLUE] = 0x7B, [G_UNICODE_BREAK_CONTINGENT] = 0x7B,
+    [G_UNICODE_BREAK_SPACE] = 0xAD, [G_UNICODE_BREAK_AFTER] = 0x7B, [G_UNICODE_BREAK_BEFORE] = 0x7B,
+    [G_UNICODE_BREAK_BEFORE_AND_AFTER] = 0x7D, [G_UNICODE_BREAK_HYPHEN] = 0x7B, [G_UNICODE_BREAK_NON_STARTER] = 0x7B,
+    [G_UNICODE_BREAK_OPEN_PUNCTUATION] = 0x7B, [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = 0x91, [G_UNICODE_BREAK_QUOTATION] = 0x7B,
+    [G_UNICODE_BREAK_EXCLAMATION] = 0x8D, [G_UNICODE_BREAK_IDEOGRAPHIC] = 0x7B, [G_UNICODE_BREAK_NUMERIC] = 0x7B,
+    [G_UNICODE_BREAK_INFIX_SEPARATOR] = 0x91, [G_UNICODE_BREAK_SYMBOL] = 0x91, [G_UNICODE_BREAK_ALPHABETIC] = 0x7B,
+    [G_UNICODE_BREAK_PREFIX] = 0x7B, [G_UNICODE_BREAK_POSTFIX] = 0x7B, [G_UNICODE_BREAK_COMPLEX_CONTEXT] = 0x7B,
+    [G_UNICODE_BREAK_AMBIGUOUS] = 0x7B, [G_UNICODE_BREAK_UNKNOWN] = 0x7B, [G_UNICODE_BREAK_NEXT_LINE] = 0xB1,
+    [G_UNICODE_BREAK_WORD_JOINER] = 0x9D, [G_UNICODE_BREAK_HANGUL_L_JAMO] = 0x7B, [G_UNICODE_BREAK_HANGUL_V_JAMO] = 0x7B,
+    [G_UNICODE_BREAK_HANGUL_T_JAMO] = 0x7B, [G_UNICODE_BREAK_HANGUL_LV_SYLLABLE] = 0x7B, [G_UNICODE_BREAK_HANGUL_LVT_SYLLABLE] = 0x7B,
+    [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = 0x91, [G_UNICODE_BREAK_CONDITIONAL_JAPANESE_STARTER] = 0x7B, [G_UNICODE_BREAK_HEBREW_LETTER] = 0x7B,
+    [G_UNICODE_BREAK_REGIONAL_INDICATOR] = 0x7B, [G_UNICODE_BREAK_EMOJI_BASE] = 0x7B, [G_UNICODE_BREAK_EMOJI_MODIFIER] = 0x7B,
+    [G_UNICODE_BREAK_ZERO_WIDTH_JOINER] = 0x7B,
+  },
+  [G_UNICODE_BREAK_HYPHEN] = {
+    [G_UNICODE_BREAK_MANDATORY] = 0xB1, [G_UNICODE_BREAK_CARRIAGE_RETURN] = 0xB1, [G_UNICODE_BREAK_LINE_FEED] = 0xB1,
+    [G_UNICODE_BREAK_COMBINING_MARK] = 0x7B, [G_UNICODE_BREAK_SURROGATE] = 0x7B, [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = 0xAD,
+    [G_UNICODE_BREAK_INSEPARABLE] = 0x7B, [G_UNICODE_BREAK_NON_BREAKING_GLUE] = 0x7B, [G_UNICODE_BREAK_CONTINGENT] = 0x7B,
+    [G_UNICODE_BREAK_SPACE] = 0xAD, [G_UNICODE_BREAK_AFTER] = 0x7B, [G_UNICODE_BREAK_BEFORE] = 0x7B,
+    [G_UNICODE_BREAK_BEFORE_AND_AFTER] = 0x7B, [G_UNICODE_BREAK_HYPHEN] = 0x7B, [G_UNICODE_BREAK_NON_STARTER] = 0x7B,
+    [G_UNICODE_BREAK_OPEN_PUNCTUATION] = 0x7B, [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = 0x91, [G_UNICODE_BREAK_QUOTATION] = 0x7B,
+    [G_UNICODE_BREAK_EXCLAMATION] = 0x8D, [G_UNICODE_BREAK_IDEOGRAPHIC] = 0x7B, [G_UNICODE_BREAK_NUMERIC] = 0x7B,
+    [G_UNICODE_BREAK_INFIX_SEPARATOR] = 0x91, [G_UNICODE_BREAK_SYMBOL] = 0x91, [G_UNICODE_BREAK_ALPHABETIC] = 0x7B,
+    [G_UNICODE_BREAK_PREFIX] = 0x7B, [G_UNICODE_BREAK_POSTFIX] = 0x7B, [G_UNICODE_BREAK_COMPLEX_CONTEXT] = 0x7B,
+    [G_UNICODE_BREAK_AMBIGUOUS] = 0x7B, [G_UNICODE_BREAK_UNKNOWN] = 0x7B, [G_UNICODE_BREAK_NEXT_LINE] = 0xB1,
+    [G_UNICODE_BREAK_WORD_JOINER] = 0x9D, [G_UNICODE_BREAK_HANGUL_L_JAMO] = 0x7B, [G_UNICODE_BREAK_HANGUL_V_JAMO] = 0x7B,
+    [G_UNICODE_BREAK_HANGUL_T_JAMO] = 0x7B, [G_UNICODE_BREAK_HANGUL_LV_SYLLABLE] = 0x7B, [G_UNICODE_BREAK_HANGUL_LVT_SYLLABLE] = 0x7B,
+    [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = 0x91, [G_UNICODE_BREAK_CONDITIONAL_JAPANESE_STARTER] = 0x7B, [G_UNICODE_BREAK_HEBREW_LETTER] = 0x7B,
+    [G_UNICODE_BREAK_REGIONAL_INDICATOR] = 0x7B, [G_UNICODE_BREAK_EMOJI_BASE] = 0x7B, [G_UNICODE_BREAK_EMOJI_MODIFIER] = 0x7B,
+    [G_UNICODE_BREAK_ZERO_WIDTH_JOINER] = 0x7B,
+  },
+  [G_UNICODE_BREAK_NON_STARTER] = {
+    [G_UNICODE_BREAK_MANDATORY] = 0xB1, [G_UNICODE_BREAK_CARRIAGE_RETURN] = 0xB1, [G_UNICODE_BREAK_LINE_FEED] = 0xB1,
+    [G_UNICODE_BREAK_COMBINING_MARK] = 0x7B, [G_UNICODE_BREAK_SURROGATE] = 0x7B, [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = 0xAD,
+    [G_UNICODE_BREAK_INSEPARABLE] = 0x7B, [G_UNICODE_BREAK_NON_BREAKING_GLUE] = 0x7B, [G_UNICODE_BREAK_CONTINGENT] = 0x7B,
+    [G_UNICODE_BREAK_SPACE] = 0xAD, [G_UNICODE_BREAK_AFTER] = 0x7B, [G_UNICODE_BREAK_BEFORE] = 0x7B,
+    [G_UNICODE_BREAK_BEFORE_AND_AFTER] = 0x7B, [G_UNICODE_BREAK_HYPHEN] = 0x7B, [G_UNICODE_BREAK_NON_STARTER] = 0x7B,
+    [G_UNICODE_BREAK_OPEN_PUNCTUATION] = 0x7B, [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = 0x91, [G_UNICODE_BREAK_QUOTATION] = 0x7B,
+    [G_UNICODE_BREAK_EXCLAMATION] = 0x8D, [G_UNICODE_BREAK_IDEOGRAPHIC] = 0x7B, [G_UNICODE_BREAK_NUMERIC] = 0x7B,
+    [G_UNICODE_BREAK_INFIX_SEPARATOR] = 0x91, [G_UNICODE_BREAK_SYMBOL] = 0x91, [G_UNICODE_BREAK_ALPHABETIC] = 0x7B,
+    [G_UNICODE_BREAK_PREFIX] = 0x7B, [G_UNICODE_BREAK_POSTFIX] = 0x7B, [G_UNICODE_BREAK_COMPLEX_CONTEXT] = 0x7B,
+    [G_UNICODE_BREAK_AMBIGUOUS] = 0x7B, [G_UNICODE_BREAK_UNKNOWN] = 0x7B, [G_UNICODE_BREAK_NEXT_LINE] = 0xB1,
+    [G_UNICODE_BREAK_WORD_JOINER] = 0x9D, [G_UNICODE_BREAK_HANGUL_L_JAMO] = 0x7B, [G_UNICODE_BREAK_HANGUL_V_JAMO] = 0x7B,
+    [G_UNICODE_BREAK_HANGUL_T_JAMO] = 0x7B, [G_UNICODE_BREAK_HANGUL_LV_SYLLABLE] = 0x7B, [G_UNICODE_BREAK_HANGUL_LVT_SYLLABLE] = 0x7B,
+    [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = 0x91, [G_UNICODE_BREAK_CONDITIONAL_JAPANESE_STARTER] = 0x7B, [G_UNICODE_BREAK_HEBREW_LETTER] = 0x7B,
+    [G_UNICODE_BREAK_REGIONAL_INDICATOR] = 0x7B, [G_UNICODE_BREAK_EMOJI_BASE] = 0x7B, [G_UNICODE_BREAK_EMOJI_MODIFIER] = 0x7B,
+    [G_UNICODE_BREAK_ZERO_WIDTH_JOINER] = 0x7B,
+  },
+  [G_UNICODE_BREAK_OPEN_PUNCTUATION] = {
+    [G_UNICODE_BREAK_MANDATORY] = 0xB1, [G_UNICODE_BREAK_CARRIAGE_RETURN] = 0xB1, [G_UNICODE_BREAK_LINE_FEED] = 0xB1,
+    [G_UNICODE_BREAK_COMBINING_MARK] = 0x89, [G_UNICODE_BREAK_SURROGATE] = 0x89, [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = 0xAD,
+    [G_UNICODE_BREAK_INSEPARABLE] = 0x89, [G_UNICODE_BREAK_NON_BREAKING_GLUE] = 0x89, [G_UNICODE_BREAK_CONTINGENT] = 0x89,
+    [G_UNICODE_BREAK_SPACE] = 0xAD, [G_UNICODE_BREAK_AFTER] = 0x89, [G_UNICODE_BREAK_BEFORE] = 0x89,
+    [G_UNICODE_BREAK_BEFORE_AND_AFTER] = 0x89, [G_UNICODE_BREAK_HYPHEN] = 0x89, [G_UNICODE_BREAK_NON_STARTER] = 0x89,
+    [G_UNICODE_BREAK_OPEN_PUNCTUATION] = 0x89, [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = 0x91, [G_UNICODE_BREAK_QUOTATION] = 0x89,
+    [G_UNICODE_BREAK_EXCLAMATION] = 0x8D, [G_UNICODE_BREAK_IDEOGRAPHIC] = 0x89, [G_UNICODE_BREAK_NUMERIC] = 0x89,
+    [G_UNICODE_BREAK_INFIX_SEPARATOR] = 0x91, [G_UNICODE_BREAK_SYMBOL] = 0x91, [G_UNICODE_BREAK_ALPHABETIC] = 0x89,
+    [G_UNICODE_BREAK_PREFIX] = 0x89, [G_UNICODE_BREAK_POSTFIX] = 0x89, [G_UNICODE_BREAK_COMPLEX_CONTEXT] = 0x89,
+    [G_UNICODE_BREAK_AMBIGUOUS] = 0x89, [G_UNICODE_BREAK_UNKNOWN] = 0x89, [G_UNICODE_BREAK_NEXT_LINE] = 0xB1,
+    [G_UNICODE_BREAK_WORD_JOINER] = 0x9D, [G_UNICODE_BREAK_HANGUL_L_JAMO] = 0x89, [G_UNICODE_BREAK_HANGUL_V_JAMO] = 0x89,
+    [G_UNICODE_BREAK_HANGUL_T_JAMO] = 0x89, [G_UNICODE_BREAK_HANGUL_LV_SYLLABLE] = 0x89, [G_UNICODE_BREAK_HANGUL_LVT_SYLLABLE] = 0x89,
+    [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = 0x91, [G_UNICODE_BREAK_CONDITIONAL_JAPANESE_STARTER] = 0x89, [G_UNICODE_BREAK_HEBREW_LETTER] = 0x89,
+    [G_UNICODE_BREAK_REGIONAL_INDICATOR] = 0x89, [G_UNICODE_BREAK_EMOJI_BASE] = 0x89, [G_UNICODE_BREAK_EMOJI_MODIFIER] = 0x89,
+    [G_UNICODE_BREAK_ZERO_WIDTH_JOINER] = 0x89,
+  },
+  [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = {
+    [G_UNICODE_BREAK_MANDATORY] = 0xB1, [G_UNICODE_BREAK_CARRIAGE_RETURN] = 0xB1, [G_UNICODE_BREAK_LINE_FEED] = 0xB1,
+    [G_UNICODE_BREAK_COMBINING_MARK] = 0x7B, [G_UNICODE_BREAK_SURROGATE] = 0x7B, [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = 0xAD,
+    [G_UNICODE_BREAK_INSEPARABLE] = 0x7B, [G_UNICODE_BREAK_NON_BREAKING_GLUE] = 0x7B, [G_UNICODE_BREAK_CONTINGENT] = 0x7B,
+    [G_UNICODE_BREAK_SPACE] = 0xAD, [G_UNICODE_BREAK_AFTER] = 0x7B, [G_UNICODE_BREAK_BEFORE] = 0x7B,
+    [G_UNICODE_BREAK_BEFORE_AND_AFTER] = 0x7B, [G_UNICODE_BREAK_HYPHEN] = 0x7B, [G_UNICODE_BREAK_NON_STARTER] = 0x81,
+    [G_UNICODE_BREAK_OPEN_PUNCTUATION] = 0x7B, [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = 0x91, [G_UNICODE_BREAK_QUOTATION] = 0x7B,
+    [G_UNICODE_BREAK_EXCLAMATION] = 0x8D, [G_UNICODE_BREAK_IDEOGRAPHIC] = 0x7B, [G_UNICODE_BREAK_NUMERIC] = 0x7B,
+    [G_UNICODE_BREAK_INFIX_SEPARATOR] = 0x91, [G_UNICODE_BREAK_SYMBOL] = 0x91, [G_UNICODE_BREAK_ALPHABETIC] = 0x7B,
+    [G_UNICODE_BREAK_PREFIX] = 0x7B, [G_UNICODE_BREAK_POSTFIX] = 0x7B, [G_UNICODE_BREAK_COMPLEX_CONTEXT] = 0x7B,
+    [G_UNICODE_BREAK_AMBIGUOUS] = 0x7B, [G_UNICODE_BREAK_UNKNOWN] = 0x7B, [G_UNICODE_BREAK_NEXT_LINE] = 0xB1,
+    [G_UNICODE_BREAK_WORD_JOINER] = 0x9D, [G_UNICODE_BREAK_HANGUL_L_JAMO] = 0x7B, [G_UNICODE_BREAK_HANGUL_V_JAMO] = 0x7B,
+    [G_UNICODE_BREAK_HANGUL_T_JAMO] = 0x7B, [G_UNICODE_BREAK_HANGUL_LV_SYLLABLE] = 0x7B, [G_UNICODE_BREAK_HANGUL_LVT_SYLLABLE] = 0x7B,
+    [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = 0x91, [G_UNICODE_BREAK_CONDITIONAL_JAPANESE_STARTER] = 0x7B, [G_UNICODE_BREAK_HEBREW_LETTER] = 0x7B,
+    [G_UNICODE_BREAK_REGIONAL_INDICATOR] = 0x7B, [G_UNICODE_BREAK_EMOJI_BASE] = 0x7B, [G_UNICODE_BREAK_EMOJI_MODIFIER] = 0x7B,
+    [G_UNICODE_BREAK_ZERO_WIDTH_JOINER] = 0x7B,
+  },
+  [G_UNICODE_BREAK_QUOTATION] = {
+    [G_UNICODE_BREAK_MANDATORY] = 0xB1, [G_UNICODE_BREAK_CARRIAGE_RETURN] = 0xB1, [G_UNICODE_BREAK_LINE_FEED] = 0xB1,
+    [G_UNICODE_BREAK_COMBINING_MARK] = 0x7B, [G_UNICODE_BREAK_SURROGATE] = 0x7B, [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = 0xAD,
+    [G_UNICODE_BREAK_INSEPARABLE] = 0x7B, [G_UNICODE_BREAK_NON_BREAKING_GLUE] = 0x7B, [G_UNICODE_BREAK_CONTINGENT] = 0x7B,
+    [G_UNICODE_BREAK_SPACE] = 0xAD, [G_UNICODE_BREAK_AFTER] = 0x7B, [G_UNICODE_BREAK_BEFORE] = 0x7B,
+    [G_UNICODE_BREAK_BEFORE_AND_AFTER] = 0x7B, [G_UNICODE_BREAK_HYPHEN] = 0x7B, [G_UNICODE_BREAK_NON_STARTER] = 0x7B,
+    [G_UNICODE_BREAK_OPEN_PUNCTUATION] = 0x85, [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = 0x91, [G_UNICODE_BREAK_QUOTATION] = 0x7B,
+    [G_UNICODE_BREAK_EXCLAMATION] = 0x8D, [G_UNICODE_BREAK_IDEOGRAPHIC] = 0x7B, [G_UNICODE_BREAK_NUMERIC] = 0x7B,
+    [G_UNICODE_BREAK_INFIX_SEPARATOR] = 0x91, [G_UNICODE_BREAK_SYMBOL] = 0x91, [G_UNICODE_BREAK_ALPHABETIC] = 0x7B,
+    [G_UNICODE_BREAK_PREFIX] = 0x7B, [G_UNICODE_BREAK_POSTFIX] = 0x7B, [G_UNICODE_BREAK_COMPLEX_CONTEXT] = 0x7B,
+    [G_UNICODE_BREAK_AMBIGUOUS] = 0x7B, [G_UNICODE_BREAK_UNKNOWN] = 0x7B, [G_UNICODE_BREAK_NEXT_LINE] = 0xB1,
+    [G_UNICODE_BREAK_WORD_JOINER] = 0x9D, [G_UNICODE_BREAK_HANGUL_L_JAMO] = 0x7B, [G_UNICODE_BREAK_HANGUL_V_JAMO] = 0x7B,
+    [G_UNICODE_BREAK_HANGUL_T_JAMO] = 0x7B, [G_UNICODE_BREAK_HANGUL_LV_SYLLABLE] = 0x7B, [G_UNICODE_BREAK_HANGUL_LVT_SYLLABLE] = 0x7B,
+    [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = 0x91, [G_UNICODE_BREAK_CONDITIONAL_JAPANESE_STARTER] = 0x7B, [G_UNICODE_BREAK_HEBREW_LETTER] = 0x7B,
+    [G_UNICODE_BREAK_REGIONAL_INDICATOR] = 0x7B, [G_UNICODE_BREAK_EMOJI_BASE] = 0x7B, [G_UNICODE_BREAK_EMOJI_MODIFIER] = 0x7B,
+    [G_UNICODE_BREAK_ZERO_WIDTH_JOINER] = 0x7B,
+  },
+  [G_UNICODE_BREAK_EXCLAMATION] = {
+    [G_UNICODE_BREAK_MANDATORY] = 0xB1, [G_UNICODE_BREAK_CARRIAGE_RETURN] = 0xB1, [G_UNICODE_BREAK_LINE_FEED] = 0xB1,
+    [G_UNICODE_BREAK_COMBINING_MARK] = 0x7B, [G_UNICODE_BREAK_SURROGATE] = 0x7B, [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = 0xAD,
+    [G_UNICODE_BREAK_INSEPARABLE] = 0x7B, [G_UNICODE_BREAK_NON_BREAKING_GLUE] = 0x7B, [G_UNICODE_BREAK_CONTINGENT] = 0x7B,
+    [G_UNICODE_BREAK_SPACE] = 0xAD, [G_UNICODE_BREAK_AFTER] = 0x7B, [G_UNICODE_BREAK_BEFORE] = 0x7B,
+    [G_UNICODE_BREAK_BEFORE_AND_AFTER] = 0x7B, [G_UNICODE_BREAK_HYPHEN] = 0x7B, [G_UNICODE_BREAK_NON_STARTER] = 0x7B,
+    [G_UNICODE_BREAK_OPEN_PUNCTUATION] = 0x7B, [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = 0x91, [G_UNICODE_BREAK_QUOTATION] = 0x7B,
+    [G_UNICODE_BREAK_EXCLAMATION] = 0x8D, [G_UNICODE_BREAK_IDEOGRAPHIC] = 0x7B, [G_UNICODE_BREAK_NUMERIC] = 0x7B,
+    [G_UNICODE_BREAK_INFIX_SEPARATOR] = 0x91, [G_UNICODE_BREAK_SYMBOL] = 0x91, [G_UNICODE_BREAK_ALPHABETIC] = 0x7B,
+    [G_UNICODE_BREAK_PREFIX] = 0x7B, [G_UNICODE_BREAK_POSTFIX] = 0x7B, [G_UNICODE_BREAK_COMPLEX_CONTEXT] = 0x7B,
+    [G_UNICODE_BREAK_AMBIGUOUS] = 0x7B, [G_UNICODE_BREAK_UNKNOWN] = 0x7B, [G_UNICODE_BREAK_NEXT_LINE] = 0xB1,
+    [G_UNICODE_BREAK_WORD_JOINER] = 0x9D, [G_UNICODE_BREAK_HANGUL_L_JAMO] = 0x7B, [G_UNICODE_BREAK_HANGUL_V_JAMO] = 0x7B,
+    [G_UNICODE_BREAK_HANGUL_T_JAMO] = 0x7B, [G_UNICODE_BREAK_HANGUL_LV_SYLLABLE] = 0x7B, [G_UNICODE_BREAK_HANGUL_LVT_SYLLABLE] = 0x7B,
+    [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = 0x91, [G_UNICODE_BREAK_CONDITIONAL_JAPANESE_STARTER] = 0x7B, [G_UNICODE_BREAK_HEBREW_LETTER] = 0x7B,
+    [G_UNICODE_BREAK_REGIONAL_INDICATOR] = 0x7B, [G_UNICODE_BREAK_EMOJI_BASE] = 0x7B, [G_UNICODE_BREAK_EMOJI_MODIFIER] = 0x7B,
+    [G_UNICODE_BREAK_ZERO_WIDTH_JOINER] = 0x7B,
+  },
+  [G_UNICODE_BREAK_IDEOGRAPHIC] = {
+    [G_UNICODE_BREAK_MANDATORY] = 0xB1, [G_UNICODE_BREAK_CARRIAGE_RETURN] = 0xB1, [G_UNICODE_BREAK_LINE_FEED] = 0xB1,
+    [G_UNICODE_BREAK_COMBINING_MARK] = 0x7B, [G_UNICODE_BREAK_SURROGATE] = 0x7B, [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = 0xAD,
+    [G_UNICODE_BREAK_INSEPARABLE] = 0x7B, [G_UNICODE_BREAK_NON_BREAKING_GLUE] = 0x7B, [G_UNICODE_BREAK_CONTINGENT] = 0x7B,
+    [G_UNICODE_BREAK_SPACE] = 0xAD, [G_UNICODE_BREAK_AFTER] = 0x7B, [G_UNICODE_BREAK_BEFORE] = 0x7B,
+    [G_UNICODE_BREAK_BEFORE_AND_AFTER] = 0x7B, [G_UNICODE_BREAK_HYPHEN] = 0x7B, [G_UNICODE_BREAK_NON_STARTER] = 0x7B,
+    [G_UNICODE_BREAK_OPEN_PUNCTUATION] = 0x7B, [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = 0x91, [G_UNICODE_BREAK_QUOTATION] = 0x7B,
+    [G_UNICODE_BREAK_EXCLAMATION] = 0x8D, [G_UNICODE_BREAK_IDEOGRAPHIC] = 0x7B, [G_UNICODE_BREAK_NUMERIC] = 0x7B,
+    [G_UNICODE_BREAK_INFIX_SEPARATOR] = 0x91, [G_UNICODE_BREAK_SYMBOL] = 0x91, [G_UNICODE_BREAK_ALPHABETIC] = 0x7B,
+    [G_UNICODE_BREAK_PREFIX] = 0x7B, [G_UNICODE_BREAK_POSTFIX] = 0x7B, [G_UNICODE_BREAK_COMPLEX_CONTEXT] = 0x7B,
+    [G_UNICODE_BREAK_AMBIGUOUS] = 0x7B, [G_UNICODE_BREAK_UNKNOWN] = 0x7B, [G_UNICODE_BREAK_NEXT_LINE] = 0xB1,
+    [G_UNICODE_BREAK_WORD_JOINER] = 0x9D, [G_UNICODE_BREAK_HANGUL_L_JAMO] = 0x7B, [G_UNICODE_BREAK_HANGUL_V_JAMO] = 0x7B,
+    [G_UNICODE_BREAK_HANGUL_T_JAMO] = 0x7B, [G_UNICODE_BREAK_HANGUL_LV_SYLLABLE] = 0x7B, [G_UNICODE_BREAK_HANGUL_LVT_SYLLABLE] = 0x7B,
+    [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = 0x91, [G_UNICODE_BREAK_CONDITIONAL_JAPANESE_STARTER] = 0x7B, [G_UNICODE_BREAK_HEBREW_LETTER] = 0x7B,
+    [G_UNICODE_BREAK_REGIONAL_INDICATOR] = 0x7B, [G_UNICODE_BREAK_EMOJI_BASE] = 0x7B, [G_UNICODE_BREAK_EMOJI_MODIFIER] = 0x7B,
+    [G_UNICODE_BREAK_ZERO_WIDTH_JOINER] = 0x7B,
+  },
+  [G_UNICODE_BREAK_NUMERIC] = {
+    [G_UNICODE_BREAK_MANDATORY] = 0xB1, [G_UNICODE_BREAK_CARRIAGE_RETURN] = 0xB1, [G_UNICODE_BREAK_LINE_FEED] = 0xB1,
+    [G_UNICODE_BREAK_COMBINING_MARK] = 0x7B, [G_UNICODE_BREAK_SURROGATE] = 0x7B, [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = 0xAD,
+    [G_UNICODE_BREAK_INSEPARABLE] = 0x7B, [G_UNICODE_BREAK_NON_BREAKING_GLUE] = 0x7B, [G_UNICODE_BREAK_CONTINGENT] = 0x7B,
+    [G_UNICODE_BREAK_SPACE] = 0xAD, [G_UNICODE_BREAK_AFTER] = 0x7B, [G_UNICODE_BREAK_BEFORE] = 0x7B,
+    [G_UNICODE_BREAK_BEFORE_AND_AFTER] = 0x7B, [G_UNICODE_BREAK_HYPHEN] = 0x7B, [G_UNICODE_BREAK_NON_STARTER] = 0x7B,
+    [G_UNICODE_BREAK_OPEN_PUNCTUATION] = 0x7B, [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = 0x91, [G_UNICODE_BREAK_QUOTATION] = 0x7B,
+    [G_UNICODE_BREAK_EXCLAMATION] = 0x8D, [G_UNICODE_BREAK_IDEOGRAPHIC] = 0x7B, [G_UNICODE_BREAK_NUMERIC] = 0x7B,
+    [G_UNICODE_BREAK_INFIX_SEPARATOR] = 0x91, [G_UNICODE_BREAK_SYMBOL] = 0x91, [G_UNICODE_BREAK_ALPHABETIC] = 0x7B,
+    [G_UNICODE_BREAK_PREFIX] = 0x7B, [G_UNICODE_BREAK_POSTFIX] = 0x7B, [G_UNICODE_BREAK_COMPLEX_CONTEXT] = 0x7B,
+    [G_UNICODE_BREAK_AMBIGUOUS] = 0x7B, [G_UNICODE_BREAK_UNKNOWN] = 0x7B, [G_UNICODE_BREAK_NEXT_LINE] = 0xB1,
+    [G_UNICODE_BREAK_WORD_JOINER] = 0x9D, [G_UNICODE_BREAK_HANGUL_L_JAMO] = 0x7B, [G_UNICODE_BREAK_HANGUL_V_JAMO] = 0x7B,
+    [G_UNICODE_BREAK_HANGUL_T_JAMO] = 0x7B, [G_UNICODE_BREAK_HANGUL_LV_SYLLABLE] = 0x7B, [G_UNICODE_BREAK_HANGUL_LVT_SYLLABLE] = 0x7B,
+    [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = 0x91, [G_UNICODE_BREAK_CONDITIONAL_JAPANESE_STARTER] = 0x7B, [G_UNICODE_BREAK_HEBREW_LETTER] = 0x7B,
+    [G_UNICODE_BREAK_REGIONAL_INDICATOR] = 0x7B, [G_UNICODE_BREAK_EMOJI_BASE] = 0x7B, [G_UNICODE_BREAK_EMOJI_MODIFIER] = 0x7B,
+    [G_UNICODE_BREAK_ZERO_WIDTH_JOINER] = 0x7B,
+  },
+  [G_UNICODE_BREAK_INFIX_SEPARATOR] = {
+    [G_UNICODE_BREAK_MANDATORY] = 0xB1, [G_UNICODE_BREAK_CARRIAGE_RETURN] = 0xB1, [G_UNICODE_BREAK_LINE_FEED] = 0xB1,
+    [G_UNICODE_BREAK_COMBINING_MARK] = 0x7B, [G_UNICODE_BREAK_SURROGATE] = 0x7B, [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = 0xAD,
+    [G_UNICODE_BREAK_INSEPARABLE] = 0x7B, [G_UNICODE_BREAK_NON_BREAKING_GLUE] = 0x7B, [G_UNICODE_BREAK_CONTINGENT] = 0x7B,
+    [G_UNICODE_BREAK_SPACE] = 0xAD, [G_UNICODE_BREAK_AFTER] = 0x7B, [G_UNICODE_BREAK_BEFORE] = 0x7B,
+    [G_UNICODE_BREAK_BEFORE_AND_AFTER] = 0x7B, [G_UNICODE_BREAK_HYPHEN] = 0x7B, [G_UNICODE_BREAK_NON_STARTER] = 0x7B,
+    [G_UNICODE_BREAK_OPEN_PUNCTUATION] = 0x7B, [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = 0x91, [G_UNICODE_BREAK_QUOTATION] = 0x7B,
+    [G_UNICODE_BREAK_EXCLAMATION] = 0x8D, [G_UNICODE_BREAK_IDEOGRAPHIC] = 0x7B, [G_UNICODE_BREAK_NUMERIC] = 0x7B,
+    [G_UNICODE_BREAK_INFIX_SEPARATOR] = 0x91, [G_UNICODE_BREAK_SYMBOL] = 0x91, [G_UNICODE_BREAK_ALPHABETIC] = 0x7B,
+    [G_UNICODE_BREAK_PREFIX] = 0x7B, [G_UNICODE_BREAK_POSTFIX] = 0x7B, [G_UNICODE_BREAK_COMPLEX_CONTEXT] = 0x7B,
+    [G_UNICODE_BREAK_AMBIGUOUS] = 0x7B, [G_UNICODE_BREAK_UNKNOWN] = 0x7B, [G_UNICODE_BREAK_NEXT_LINE] = 0xB1,
+    [G_UNICODE_BREAK_WORD_JOINER] = 0x9D, [G_UNICODE_BREAK_HANGUL_L_JAMO] = 0x7B, [G_UNICODE_BREAK_HANGUL_V_JAMO] = 0x7B,
+    [G_UNICODE_BREAK_HANGUL_T_JAMO] = 0x7B, [G_UNICODE_BREAK_HANGUL_LV_SYLLABLE] = 0x7B, [G_UNICODE_BREAK_HANGUL_LVT_SYLLABLE] = 0x7B,
+    [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = 0x91, [G_UNICODE_BREAK_CONDITIONAL_JAPANESE_STARTER] = 0x7B, [G_UNICODE_BREAK_HEBREW_LETTER] = 0x7B,
+    [G_UNICODE_BREAK_REGIONAL_INDICATOR] = 0x7B, [G_UNICODE_BREAK_EMOJI_BASE] = 0x7B, [G_UNICODE_BREAK_EMOJI_MODIFIER] = 0x7B,
+    [G_UNICODE_BREAK_ZERO_WIDTH_JOINER] = 0x7B,
+  },
+  [G_UNICODE_BREAK_SYMBOL] = {
+    [G_UNICODE_BREAK_MANDATORY] = 0xB1, [G_UNICODE_BREAK_CARRIAGE_RETURN] = 0xB1, [G_UNICODE_BREAK_LINE_FEED] = 0xB1,
+    [G_UNICODE_BREAK_COMBINING_MARK] = 0x7B, [G_UNICODE_BREAK_SURROGATE] = 0x7B, [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = 0xAD,
+    [G_UNICODE_BREAK_INSEPARABLE] = 0x7B, [G_UNICODE_BREAK_NON_BREAKING_GLUE] = 0x7B, [G_UNICODE_BREAK_CONTINGENT] = 0x7B,
+    [G_UNICODE_BREAK_SPACE] = 0xAD, [G_UNICODE_BREAK_AFTER] = 0x7B, [G_UNICODE_BREAK_BEFORE] = 0x7B,
+    [G_UNICODE_BREAK_BEFORE_AND_AFTER] = 0x7B, [G_UNICODE_BREAK_HYPHEN] = 0x7B, [G_UNICODE_BREAK_NON_STARTER] = 0x7B,
+    [G_UNICODE_BREAK_OPEN_PUNCTUATION] = 0x7B, [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = 0x91, [G_UNICODE_BREAK_QUOTATION] = 0x7B,
+    [G_UNICODE_BREAK_EXCLAMATION] = 0x8D, [G_UNICODE_BREAK_IDEOGRAPHIC] = 0x7B, [G_UNICODE_BREAK_NUMERIC] = 0x7B,
+    [G_UNICODE_BREAK_INFIX_SEPARATOR] = 0x91, [G_UNICODE_BREAK_SYMBOL] = 0x91, [G_UNICODE_BREAK_ALPHABETIC] = 0x7B,
+    [G_UNICODE_BREAK_PREFIX] = 0x7B, [G_UNICODE_BREAK_POSTFIX] = 0x7B, [G_UNICODE_BREAK_COMPLEX_CONTEXT] = 0x7B,
+    [G_UNICODE_BREAK_AMBIGUOUS] = 0x7B, [G_UNICODE_BREAK_UNKNOWN] = 0x7B, [G_UNICODE_BREAK_NEXT_LINE] = 0xB1,
+    [G_UNICODE_BREAK_WORD_JOINER] = 0x9D, [G_UNICODE_BREAK_HANGUL_L_JAMO] = 0x7B, [G_UNICODE_BREAK_HANGUL_V_JAMO] = 0x7B,
+    [G_UNICODE_BREAK_HANGUL_T_JAMO] = 0x7B, [G_UNICODE_BREAK_HANGUL_LV_SYLLABLE] = 0x7B, [G_UNICODE_BREAK_HANGUL_LVT_SYLLABLE] = 0x7B,
+    [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = 0x91, [G_UNICODE_BREAK_CONDITIONAL_JAPANESE_STARTER] = 0x7B, [G_UNICODE_BREAK_HEBREW_LETTER] = 0x7B,
+    [G_UNICODE_BREAK_REGIONAL_INDICATOR] = 0x7B, [G_UNICODE_BREAK_EMOJI_BASE] = 0x7B, [G_UNICODE_BREAK_EMOJI_MODIFIER] = 0x7B,
+    [G_UNICODE_BREAK_ZERO_WIDTH_JOINER] = 0x7B,
+  },
+  [G_UNICODE_BREAK_ALPHABETIC] = {
+    [G_UNICODE_BREAK_MANDATORY] = 0xB1, [G_UNICODE_BREAK_CARRIAGE_RETURN] = 0xB1, [G_UNICODE_BREAK_LINE_FEED] = 0xB1,
+    [G_UNICODE_BREAK_COMBINING_MARK] = 0x7B, [G_UNICODE_BREAK_SURROGATE] = 0x7B, [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = 0xAD,
+    [G_UNICODE_BREAK_INSEPARABLE] = 0x7B, [G_UNICODE_BREAK_NON_BREAKING_GLUE] = 0x7B, [G_UNICODE_BREAK_CONTINGENT] = 0x7B,
+    [G_UNICODE_BREAK_SPACE] = 0xAD, [G_UNICODE_BREAK_AFTER] = 0x7B, [G_UNICODE_BREAK_BEFORE] = 0x7B,
+    [G_UNICODE_BREAK_BEFORE_AND_AFTER] = 0x7B, [G_UNICODE_BREAK_HYPHEN] = 0x7B, [G_UNICODE_BREAK_NON_STARTER] = 0x7B,
+    [G_UNICODE_BREAK_OPEN_PUNCTUATION] = 0x7B, [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = 0x91, [G_UNICODE_BREAK_QUOTATION] = 0x7B,
+    [G_UNICODE_BREAK_EXCLAMATION] = 0x8D, [G_UNICODE_BREAK_IDEOGRAPHIC] = 0x7B, [G_UNICODE_BREAK_NUMERIC] = 0x7B,
+    [G_UNICODE_BREAK_INFIX_SEPARATOR] = 0x91, [G_UNICODE_BREAK_SYMBOL] = 0x91, [G_UNICODE_BREAK_ALPHABETIC] = 0x7B,
+    [G_UNICODE_BREAK_PREFIX] = 0x7B, [G_UNICODE_BREAK_POSTFIX] = 0x7B, [G_UNICODE_BREAK_COMPLEX_CONTEXT] = 0x7B,
+    [G_UNICODE_BREAK_AMBIGUOUS] = 0x7B, [G_UNICODE_BREAK_UNKNOWN] = 0x7B, [G_UNICODE_BREAK_NEXT_LINE] = 0xB1,
+    [G_UNICODE_BREAK_WORD_JOINER] = 0x9D, [G_UNICODE_BREAK_HANGUL_L_JAMO] = 0x7B, [G_UNICODE_BREAK_HANGUL_V_JAMO] = 0x7B,
+    [G_UNICODE_BREAK_HANGUL_T_JAMO] = 0x7B, [G_UNICODE_BREAK_HANGUL_LV_SYLLABLE] = 0x7B, [G_UNICODE_BREAK_HANGUL_LVT_SYLLABLE] = 0x7B,
+    [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = 0x91, [G_UNICODE_BREAK_CONDITIONAL_JAPANESE_STARTER] = 0x7B, [G_UNICODE_BREAK_HEBREW_LETTER] = 0x7B,
+    [G_UNICODE_BREAK_REGIONAL_INDICATOR] = 0x7B, [G_UNICODE_BREAK_EMOJI_BASE] = 0x7B, [G_UNICODE_BREAK_EMOJI_MODIFIER] = 0x7B,
+    [G_UNICODE_BREAK_ZERO_WIDTH_JOINER] = 0x7B,
+  },
+  [G_UNICODE_BREAK_PREFIX] = {
+    [G_UNICODE_BREAK_MANDATORY] = 0xB1, [G_UNICODE_BREAK_CARRIAGE_RETURN] = 0xB1, [G_UNICODE_BREAK_LINE_FEED] = 0xB1,
+    [G_UNICODE_BREAK_COMBINING_MARK] = 0x7B, [G_UNICODE_BREAK_SURROGATE] = 0x7B, [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = 0xAD,
+    [G_UNICODE_BREAK_INSEPARABLE] = 0x7B, [G_UNICODE_BREAK_NON_BREAKING_GLUE] = 0x7B, [G_UNICODE_BREAK_CONTINGENT] = 0x7B,
+    [G_UNICODE_BREAK_SPACE] = 0xAD, [G_UNICODE_BREAK_AFTER] = 0x7B, [G_UNICODE_BREAK_BEFORE] = 0x7B,
+    [G_UNICODE_BREAK_BEFORE_AND_AFTER] = 0x7B, [G_UNICODE_BREAK_HYPHEN] = 0x7B, [G_UNICODE_BREAK_NON_STARTER] = 0x7B,
+    [G_UNICODE_BREAK_OPEN_PUNCTUATION] = 0x7B, [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = 0x91, [G_UNICODE_BREAK_QUOTATION] = 0x7B,
+    [G_UNICODE_BREAK_EXCLAMATION] = 0x8D, [G_UNICODE_BREAK_IDEOGRAPHIC] = 0x7B, [G_UNICODE_BREAK_NUMERIC] = 0x7B,
+    [G_UNICODE_BREAK_INFIX_SEPARATOR] = 0x91, [G_UNICODE_BREAK_SYMBOL] = 0x91, [G_UNICODE_BREAK_ALPHABETIC] = 0x7B,
+    [G_UNICODE_BREAK_PREFIX] = 0x7B, [G_UNICODE_BREAK_POSTFIX] = 0x7B, [G_UNICODE_BREAK_COMPLEX_CONTEXT] = 0x7B,
+    [G_UNICODE_BREAK_AMBIGUOUS] = 0x7B, [G_UNICODE_BREAK_UNKNOWN] = 0x7B, [G_UNICODE_BREAK_NEXT_LINE] = 0xB1,
+    [G_UNICODE_BREAK_WORD_JOINER] = 0x9D, [G_UNICODE_BREAK_HANGUL_L_JAMO] = 0x7B, [G_UNICODE_BREAK_HANGUL_V_JAMO] = 0x7B,
+    [G_UNICODE_BREAK_HANGUL_T_JAMO] = 0x7B, [G_UNICODE_BREAK_HANGUL_LV_SYLLABLE] = 0x7B, [G_UNICODE_BREAK_HANGUL_LVT_SYLLABLE] = 0x7B,
+    [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = 0x91, [G_UNICODE_BREAK_CONDITIONAL_JAPANESE_STARTER] = 0x7B, [G_UNICODE_BREAK_HEBREW_LETTER] = 0x7B,
+    [G_UNICODE_BREAK_REGIONAL_INDICATOR] = 0x7B, [G_UNICODE_BREAK_EMOJI_BASE] = 0x7B, [G_UNICODE_BREAK_EMOJI_MODIFIER] = 0x7B,
+    [G_UNICODE_BREAK_ZERO_WIDTH_JOINER] = 0x7B,
+  },
+  [G_UNICODE_BREAK_POSTFIX] = {
+    [G_UNICODE_BREAK_MANDATORY] = 0xB1, [G_UNICODE_BREAK_CARRIAGE_RETURN] = 0xB1, [G_UNICODE_BREAK_LINE_FEED] = 0xB1,
+    [G_UNICODE_BREAK_COMBINING_MARK] = 0x7B, [G_UNICODE_BREAK_SURROGATE] = 0x7B, [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = 0xAD,
+    [G_UNICODE_BREAK_INSEPARABLE] = 0x7B, [G_UNICODE_BREAK_NON_BREAKING_GLUE] = 0x7B, [G_UNICODE_BREAK_CONTINGENT] = 0x7B,
+    [G_UNICODE_BREAK_SPACE] = 0xAD, [G_UNICODE_BREAK_AFTER] = 0x7B, [G_UNICODE_BREAK_BEFORE] = 0x7B,
+    [G_UNICODE_BREAK_BEFORE_AND_AFTER] = 0x7B, [G_UNICODE_BREAK_HYPHEN] = 0x7B, [G_UNICODE_BREAK_NON_STARTER] = 0x7B,
+    [G_UNICODE_BREAK_OPEN_PUNCTUATION] = 0x7B, [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = 0x91, [G_UNICODE_BREAK_QUOTATION] = 0x7B,
+    [G_UNICODE_BREAK_EXCLAMATION] = 0x8D, [G_UNICODE_BREAK_IDEOGRAPHIC] = 0x7B, [G_UNICODE_BREAK_NUMERIC] = 0x7B,
+    [G_UNICODE_BREAK_INFIX_SEPARATOR] = 0x91, [G_UNICODE_BREAK_SYMBOL] = 0x91, [G_UNICODE_BREAK_ALPHABETIC] = 0x7B,
+    [G_UNICODE_BREAK_PREFIX] = 0x7B, [G_UNICODE_BREAK_POSTFIX] = 0x7B, [G_UNICODE_BREAK_COMPLEX_CONTEXT] = 0x7B,
+    [G_UNICODE_BREAK_AMBIGUOUS] = 0x7B, [G_UNICODE_BREAK_UNKNOWN] = 0x7B, [G_UNICODE_BREAK_NEXT_LINE] = 0xB1,
+    [G_UNICODE_BREAK_WORD_JOINER] = 0x9D, [G_UNICODE_BREAK_HANGUL_L_JAMO] = 0x7B, [G_UNICODE_BREAK_HANGUL_V_JAMO] = 0x7B,
+    [G_UNICODE_BREAK_HANGUL_T_JAMO] = 0x7B, [G_UNICODE_BREAK_HANGUL_LV_SYLLABLE] = 0x7B, [G_UNICODE_BREAK_HANGUL_LVT_SYLLABLE] = 0x7B,
+    [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = 0x91, [G_UNICODE_BREAK_CONDITIONAL_JAPANESE_STARTER] = 0x7B, [G_UNICODE_BREAK_HEBREW_LETTER] = 0x7B,
+    [G_UNICODE_BREAK_REGIONAL_INDICATOR] = 0x7B, [G_UNICODE_BREAK_EMOJI_BASE] = 0x7B, [G_UNICODE_BREAK_EMOJI_MODIFIER] = 0x7B,
+    [G_UNICODE_BREAK_ZERO_WIDTH_JOINER] = 0x7B,
+  },
+  [G_UNICODE_BREAK_COMPLEX_CONTEXT] = {
+    [G_UNICODE_BREAK_MANDATORY] = 0xB1, [G_UNICODE_BREAK_CARRIAGE_RETURN] = 0xB1, [G_UNICODE_BREAK_LINE_FEED] = 0xB1,
+    [G_UNICODE_BREAK_COMBINING_MARK] = 0x7B, [G_UNICODE_BREAK_SURROGATE] = 0x7B, [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = 0xAD,
+    [G_UNICODE_BREAK_INSEPARABLE] = 0x7B, [G_UNICODE_BREAK_NON_BREAKING_GLUE] = 0x7B, [G_UNICODE_BREAK_CONTINGENT] = 0x7B,
+    [G_UNICODE_BREAK_SPACE] = 0xAD, [G_UNICODE_BREAK_AFTER] = 0x7B, [G_UNICODE_BREAK_BEFORE] = 0x7B,
+    [G_UNICODE_BREAK_BEFORE_AND_AFTER] = 0x7B, [G_UNICODE_BREAK_HYPHEN] = 0x7B, [G_UNICODE_BREAK_NON_STARTER] = 0x7B,
+    [G_UNICODE_BREAK_OPEN_PUNCTUATION] = 0x7B, [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = 0x91, [G_UNICODE_BREAK_QUOTATION] = 0x7B,
+    [G_UNICODE_BREAK_EXCLAMATION] = 0x8D, [G_UNICODE_BREAK_IDEOGRAPHIC] = 0x7B, [G_UNICODE_BREAK_NUMERIC] = 0x7B,
+    [G_UNICODE_BREAK_INFIX_SEPARATOR] = 0x91, [G_UNICODE_BREAK_SYMBOL] = 0x91, [G_UNICODE_BREAK_ALPHABETIC] = 0x7B,
+    [G_UNICODE_BREAK_PREFIX] = 0x7B, [G_UNICODE_BREAK_POSTFIX] = 0x7B, [G_UNICODE_BREAK_COMPLEX_CONTEXT] = 0x7B,
+    [G_UNICODE_BREAK_AMBIGUOUS] = 0x7B, [G_UNICODE_BREAK_UNKNOWN] = 0x7B, [G_UNICODE_BREAK_NEXT_LINE] = 0xB1,
+    [G_UNICODE_BREAK_WORD_JOINER] = 0x9D, [G_UNICODE_BREAK_HANGUL_L_JAMO] = 0x7B, [G_UNICODE_BREAK_HANGUL_V_JAMO] = 0x7B,
+    [G_UNICODE_BREAK_HANGUL_T_JAMO] = 0x7B, [G_UNICODE_BREAK_HANGUL_LV_SYLLABLE] = 0x7B, [G_UNICODE_BREAK_HANGUL_LVT_SYLLABLE] = 0x7B,
+    [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = 0x91, [G_UNICODE_BREAK_CONDITIONAL_JAPANESE_STARTER] = 0x7B, [G_UNICODE_BREAK_HEBREW_LETTER] = 0x7B,
+    [G_UNICODE_BREAK_REGIONAL_INDICATOR] = 0x7B, [G_UNICODE_BREAK_EMOJI_BASE] = 0x7B, [G_UNICODE_BREAK_EMOJI_MODIFIER] = 0x7B,
+    [G_UNICODE_BREAK_ZERO_WIDTH_JOINER] = 0x7B,
+  },
+  [G_UNICODE_BREAK_AMBIGUOUS] = {
+    [G_UNICODE_BREAK_MANDATORY] = 0xB1, [G_UNICODE_BREAK_CARRIAGE_RETURN] = 0xB1, [G_UNICODE_BREAK_LINE_FEED] = 0xB1,
+    [G_UNICODE_BREAK_COMBINING_MARK] = 0x7B, [G_UNICODE_BREAK_SURROGATE] = 0x7B, [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = 0xAD,
+    [G_UNICODE_BREAK_INSEPARABLE] = 0x7B, [G_UNICODE_BREAK_NON_BREAKING_GLUE] = 0x7B, [G_UNICODE_BREAK_CONTINGENT] = 0x7B,
+    [G_UNICODE_BREAK_SPACE] = 0xAD, [G_UNICODE_BREAK_AFTER] = 0x7B, [G_UNICODE_BREAK_BEFORE] = 0x7B,
+    [G_UNICODE_BREAK_BEFORE_AND_AFTER] = 0x7B, [G_UNICODE_BREAK_HYPHEN] = 0x7B, [G_UNICODE_BREAK_NON_STARTER] = 0x7B,
+    [G_UNICODE_BREAK_OPEN_PUNCTUATION] = 0x7B, [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = 0x91, [G_UNICODE_BREAK_QUOTATION] = 0x7B,
+    [G_UNICODE_BREAK_EXCLAMATION] = 0x8D, [G_UNICODE_BREAK_IDEOGRAPHIC] = 0x7B, [G_UNICODE_BREAK_NUMERIC] = 0x7B,
+    [G_UNICODE_BREAK_INFIX_SEPARATOR] = 0x91, [G_UNICODE_BREAK_SYMBOL] = 0x91, [G_UNICODE_BREAK_ALPHABETIC] = 0x7B,
+    [G_UNICODE_BREAK_PREFIX] = 0x7B, [G_UNICODE_BREAK_POSTFIX] = 0x7B, [G_UNICODE_BREAK_COMPLEX_CONTEXT] = 0x7B,
+    [G_UNICODE_BREAK_AMBIGUOUS] = 0x7B, [G_UNICODE_BREAK_UNKNOWN] = 0x7B, [G_UNICODE_BREAK_NEXT_LINE] = 0xB1,
+    [G_UNICODE_BREAK_WORD_JOINER] = 0x9D, [G_UNICODE_BREAK_HANGUL_L_JAMO] = 0x7B, [G_UNICODE_BREAK_HANGUL_V_JAMO] = 0x7B,
+    [G_UNICODE_BREAK_HANGUL_T_JAMO] = 0x7B, [G_UNICODE_BREAK_HANGUL_LV_SYLLABLE] = 0x7B, [G_UNICODE_BREAK_HANGUL_LVT_SYLLABLE] = 0x7B,
+    [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = 0x91, [G_UNICODE_BREAK_CONDITIONAL_JAPANESE_STARTER] = 0x7B, [G_UNICODE_BREAK_HEBREW_LETTER] = 0x7B,
+    [G_UNICODE_BREAK_REGIONAL_INDICATOR] = 0x7B, [G_UNICODE_BREAK_EMOJI_BASE] = 0x7B, [G_UNICODE_BREAK_EMOJI_MODIFIER] = 0x7B,
+    [G_UNICODE_BREAK_ZERO_WIDTH_JOINER] = 0x7B,
+  },
+  [G_UNICODE_BREAK_UNKNOWN] = {
+    [G_UNICODE_BREAK_MANDATORY] = 0xB1, [G_UNICODE_BREAK_CARRIAGE_RETURN] = 0xB1, [G_UNICODE_BREAK_LINE_FEED] = 0xB1,
+    [G_UNICODE_BREAK_COMBINING_MARK] = 0x7B, [G_UNICODE_BREAK_SURROGATE] = 0x7B, [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = 0xAD,
+    [G_UNICODE_BREAK_INSEPARABLE] = 0x7B, [G_UNICODE_BREAK_NON_BREAKING_GLUE] = 0x7B, [G_UNICODE_BREAK_CONTINGENT] = 0x7B,
+    [G_UNICODE_BREAK_SPACE] = 0xAD, [G_UNICODE_BREAK_AFTER] = 0x7B, [G_UNICODE_BREAK_BEFORE] = 0x7B,
+    [G_UNICODE_BREAK_BEFORE_AND_AFTER] = 0x7B, [G_UNICODE_BREAK_HYPHEN] = 0x7B, [G_UNICODE_BREAK_NON_STARTER] = 0x7B,
+    [G_UNICODE_BREAK_OPEN_PUNCTUATION] = 0x7B, [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = 0x91, [G_UNICODE_BREAK_QUOTATION] = 0x7B,
+    [G_UNICODE_BREAK_EXCLAMATION] = 0x8D, [G_UNICODE_BREAK_IDEOGRAPHIC] = 0x7B, [G_UNICODE_BREAK_NUMERIC] = 0x7B,
+    [G_UNICODE_BREAK_INFIX_SEPARATOR] = 0x91, [G_UNICODE_BREAK_SYMBOL] = 0x91, [G_UNICODE_BREAK_ALPHABETIC] = 0x7B,
+    [G_UNICODE_BREAK_PREFIX] = 0x7B, [G_UNICODE_BREAK_POSTFIX] = 0x7B, [G_UNICODE_BREAK_COMPLEX_CONTEXT] = 0x7B,
+    [G_UNICODE_BREAK_AMBIGUOUS] = 0x7B, [G_UNICODE_BREAK_UNKNOWN] = 0x7B, [G_UNICODE_BREAK_NEXT_LINE] = 0xB1,
+    [G_UNICODE_BREAK_WORD_JOINER] = 0x9D, [G_UNICODE_BREAK_HANGUL_L_JAMO] = 0x7B, [G_UNICODE_BREAK_HANGUL_V_JAMO] = 0x7B,
+    [G_UNICODE_BREAK_HANGUL_T_JAMO] = 0x7B, [G_UNICODE_BREAK_HANGUL_LV_SYLLABLE] = 0x7B, [G_UNICODE_BREAK_HANGUL_LVT_SYLLABLE] = 0x7B,
+    [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = 0x91, [G_UNICODE_BREAK_CONDITIONAL_JAPANESE_STARTER] = 0x7B, [G_UNICODE_BREAK_HEBREW_LETTER] = 0x7B,
+    [G_UNICODE_BREAK_REGIONAL_INDICATOR] = 0x7B, [G_UNICODE_BREAK_EMOJI_BASE] = 0x7B, [G_UNICODE_BREAK_EMOJI_MODIFIER] = 0x7B,
+    [G_UNICODE_BREAK_ZERO_WIDTH_JOINER] = 0x7B,
+  },
+  [G_UNICODE_BREAK_NEXT_LINE] = {
+    [G_UNICODE_BREAK_MANDATORY] = 0xB1, [G_UNICODE_BREAK_CARRIAGE_RETURN] = 0xB1, [G_UNICODE_BREAK_LINE_FEED] = 0xB1,
+    [G_UNICODE_BREAK_COMBINING_MARK] = 0x7B, [G_UNICODE_BREAK_SURROGATE] = 0x7B, [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = 0xAD,
+    [G_UNICODE_BREAK_INSEPARABLE] = 0x7B, [G_UNICODE_BREAK_NON_BREAKING_GLUE] = 0x7B, [G_UNICODE_BREAK_CONTINGENT] = 0x7B,
+    [G_UNICODE_BREAK_SPACE] = 0xAD, [G_UNICODE_BREAK_AFTER] = 0x7B, [G_UNICODE_BREAK_BEFORE] = 0x7B,
+    [G_UNICODE_BREAK_BEFORE_AND_AFTER] = 0x7B, [G_UNICODE_BREAK_HYPHEN] = 0x7B, [G_UNICODE_BREAK_NON_STARTER] = 0x7B,
+    [G_UNICODE_BREAK_OPEN_PUNCTUATION] = 0x7B, [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = 0x91, [G_UNICODE_BREAK_QUOTATION] = 0x7B,
+    [G_UNICODE_BREAK_EXCLAMATION] = 0x8D, [G_UNICODE_BREAK_IDEOGRAPHIC] = 0x7B, [G_UNICODE_BREAK_NUMERIC] = 0x7B,
+    [G_UNICODE_BREAK_INFIX_SEPARATOR] = 0x91, [G_UNICODE_BREAK_SYMBOL] = 0x91, [G_UNICODE_BREAK_ALPHABETIC] = 0x7B,
+    [G_UNICODE_BREAK_PREFIX] = 0x7B, [G_UNICODE_BREAK_POSTFIX] = 0x7B, [G_UNICODE_BREAK_COMPLEX_CONTEXT] = 0x7B,
+    [G_UNICODE_BREAK_AMBIGUOUS] = 0x7B, [G_UNICODE_BREAK_UNKNOWN] = 0x7B, [G_UNICODE_BREAK_NEXT_LINE] = 0xB1,
+    [G_UNICODE_BREAK_WORD_JOINER] = 0x9D, [G_UNICODE_BREAK_HANGUL_L_JAMO] = 0x7B, [G_UNICODE_BREAK_HANGUL_V_JAMO] = 0x7B,
+    [G_UNICODE_BREAK_HANGUL_T_JAMO] = 0x7B, [G_UNICODE_BREAK_HANGUL_LV_SYLLABLE] = 0x7B, [G_UNICODE_BREAK_HANGUL_LVT_SYLLABLE] = 0x7B,
+    [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = 0x91, [G_UNICODE_BREAK_CONDITIONAL_JAPANESE_STARTER] = 0x7B, [G_UNICODE_BREAK_HEBREW_LETTER] = 0x7B,
+    [G_UNICODE_BREAK_REGIONAL_INDICATOR] = 0x7B, [G_UNICODE_BREAK_EMOJI_BASE] = 0x7B, [G_UNICODE_BREAK_EMOJI_MODIFIER] = 0x7B,
+    [G_UNICODE_BREAK_ZERO_WIDTH_JOINER] = 0x7B,
+  },
+  [G_UNICODE_BREAK_WORD_JOINER] = {
+    [G_UNICODE_BREAK_MANDATORY] = 0xB1, [G_UNICODE_BREAK_CARRIAGE_RETURN] = 0xB1, [G_UNICODE_BREAK_LINE_FEED] = 0xB1,
+    [G_UNICODE_BREAK_COMBINING_MARK] = 0x7B, [G_UNICODE_BREAK_SURROGATE] = 0x7B, [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = 0xAD,
+    [G_UNICODE_BREAK_INSEPARABLE] = 0x7B, [G_UNICODE_BREAK_NON_BREAKING_GLUE] = 0x7B, [G_UNICODE_BREAK_CONTINGENT] = 0x7B,
+    [G_UNICODE_BREAK_SPACE] = 0xAD, [G_UNICODE_BREAK_AFTER] = 0x7B, [G_UNICODE_BREAK_BEFORE] = 0x7B,
+    [G_UNICODE_BREAK_BEFORE_AND_AFTER] = 0x7B, [G_UNICODE_BREAK_HYPHEN] = 0x7B, [G_UNICODE_BREAK_NON_STARTER] = 0x7B,
+    [G_UNICODE_BREAK_OPEN_PUNCTUATION] = 0x7B, [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = 0x91, [G_UNICODE_BREAK_QUOTATION] = 0x7B,
+    [G_UNICODE_BREAK_EXCLAMATION] = 0x8D, [G_UNICODE_BREAK_IDEOGRAPHIC] = 0x7B, [G_UNICODE_BREAK_NUMERIC] = 0x7B,
+    [G_UNICODE_BREAK_INFIX_SEPARATOR] = 0x91, [G_UNICODE_BREAK_SYMBOL] = 0x91, [G_UNICODE_BREAK_ALPHABETIC] = 0x7B,
+    [G_UNICODE_BREAK_PREFIX] = 0x7B, [G_UNICODE_BREAK_POSTFIX] = 0x7B, [G_UNICODE_BREAK_COMPLEX_CONTEXT] = 0x7B,
+    [G_UNICODE_BREAK_AMBIGUOUS] = 0x7B, [G_UNICODE_BREAK_UNKNOWN] = 0x7B, [G_UNICODE_BREAK_NEXT_LINE] = 0xB1,
+    [G_UNICODE_BREAK_WORD_JOINER] = 0x9D, [G_UNICODE_BREAK_HANGUL_L_JAMO] = 0x7B, [G_UNICODE_BREAK_HANGUL_V_JAMO] = 0x7B,
+    [G_UNICODE_BREAK_HANGUL_T_JAMO] = 0x7B, [G_UNICODE_BREAK_HANGUL_LV_SYLLABLE] = 0x7B, [G_UNICODE_BREAK_HANGUL_LVT_SYLLABLE] = 0x7B,
+    [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = 0x91, [G_UNICODE_BREAK_CONDITIONAL_JAPANESE_STARTER] = 0x7B, [G_UNICODE_BREAK_HEBREW_LETTER] = 0x7B,
+    [G_UNICODE_BREAK_REGIONAL_INDICATOR] = 0x7B, [G_UNICODE_BREAK_EMOJI_BASE] = 0x7B, [G_UNICODE_BREAK_EMOJI_MODIFIER] = 0x7B,
+    [G_UNICODE_BREAK_ZERO_WIDTH_JOINER] = 0x7B,
+  },
+  [G_UNICODE_BREAK_HANGUL_L_JAMO] = {
+    [G_UNICODE_BREAK_MANDATORY] = 0xB1, [G_UNICODE_BREAK_CARRIAGE_RETURN] = 0xB1, [G_UNICODE_BREAK_LINE_FEED] = 0xB1,
+    [G_UNICODE_BREAK_COMBINING_MARK] = 0x7B, [G_UNICODE_BREAK_SURROGATE] = 0x7B, [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = 0xAD,
+    [G_UNICODE_BREAK_INSEPARABLE] = 0x7B, [G_UNICODE_BREAK_NON_BREAKING_GLUE] = 0x7B, [G_UNICODE_BREAK_CONTINGENT] = 0x7B,
+    [G_UNICODE_BREAK_SPACE] = 0xAD, [G_UNICODE_BREAK_AFTER] = 0x7B, [G_UNICODE_BREAK_BEFORE] = 0x7B,
+    [G_UNICODE_BREAK_BEFORE_AND_AFTER] = 0x7B, [G_UNICODE_BREAK_HYPHEN] = 0x7B, [G_UNICODE_BREAK_NON_STARTER] = 0x7B,
+    [G_UNICODE_BREAK_OPEN_PUNCTUATION] = 0x7B, [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = 0x91, [G_UNICODE_BREAK_QUOTATION] = 0x7B,
+    [G_UNICODE_BREAK_EXCLAMATION] = 0x8D, [G_UNICODE_BREAK_IDEOGRAPHIC] = 0x7B, [G_UNICODE_BREAK_NUMERIC] = 0x7B,
+    [G_UNICODE_BREAK_INFIX_SEPARATOR] = 0x91, [G_UNICODE_BREAK_SYMBOL] = 0x91, [G_UNICODE_BREAK_ALPHABETIC] = 0x7B,
+    [G_UNICODE_BREAK_PREFIX] = 0x7B, [G_UNICODE_BREAK_POSTFIX] = 0x7B, [G_UNICODE_BREAK_COMPLEX_CONTEXT] = 0x7B,
+    [G_UNICODE_BREAK_AMBIGUOUS] = 0x7B, [G_UNICODE_BREAK_UNKNOWN] = 0x7B, [G_UNICODE_BREAK_NEXT_LINE] = 0xB1,
+    [G_UNICODE_BREAK_WORD_JOINER] = 0x9D, [G_UNICODE_BREAK_HANGUL_L_JAMO] = 0x7B, [G_UNICODE_BREAK_HANGUL_V_JAMO] = 0x7B,
+    [G_UNICODE_BREAK_HANGUL_T_JAMO] = 0x7B, [G_UNICODE_BREAK_HANGUL_LV_SYLLABLE] = 0x7B, [G_UNICODE_BREAK_HANGUL_LVT_SYLLABLE] = 0x7B,
+    [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = 0x91, [G_UNICODE_BREAK_CONDITIONAL_JAPANESE_STARTER] = 0x7B, [G_UNICODE_BREAK_HEBREW_LETTER] = 0x7B,
+    [G_UNICODE_BREAK_REGIONAL_INDICATOR] = 0x7B, [G_UNICODE_BREAK_EMOJI_BASE] = 0x7B, [G_UNICODE_BREAK_EMOJI_MODIFIER] = 0x7B,
+    [G_UNICODE_BREAK_ZERO_WIDTH_JOINER] = 0x7B,
+  },
+  [G_UNICODE_BREAK_HANGUL_V_JAMO] = {
+    [G_UNICODE_BREAK_MANDATORY] = 0xB1, [G_UNICODE_BREAK_CARRIAGE_RETURN] = 0xB1, [G_UNICODE_BREAK_LINE_FEED] = 0xB1,
+    [G_UNICODE_BREAK_COMBINING_MARK] = 0x7B, [G_UNICODE_BREAK_SURROGATE] = 0x7B, [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = 0xAD,
+    [G_UNICODE_BREAK_INSEPARABLE] = 0x7B, [G_UNICODE_BREAK_NON_BREAKING_GLUE] = 0x7B, [G_UNICODE_BREAK_CONTINGENT] = 0x7B,
+    [G_UNICODE_BREAK_SPACE] = 0xAD, [G_UNICODE_BREAK_AFTER] = 0x7B, [G_UNICODE_BREAK_BEFORE] = 0x7B,
+    [G_UNICODE_BREAK_BEFORE_AND_AFTER] = 0x7B, [G_UNICODE_BREAK_HYPHEN] = 0x7B, [G_UNICODE_BREAK_NON_STARTER] = 0x7B,
+    [G_UNICODE_BREAK_OPEN_PUNCTUATION] = 0x7B, [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = 0x91, [G_UNICODE_BREAK_QUOTATION] = 0x7B,
+    [G_UNICODE_BREAK_EXCLAMATION] = 0x8D, [G_UNICODE_BREAK_IDEOGRAPHIC] = 0x7B, [G_UNICODE_BREAK_NUMERIC] = 0x7B,
+    [G_UNICODE_BREAK_INFIX_SEPARATOR] = 0x91, [G_UNICODE_BREAK_SYMBOL] = 0x91, [G_UNICODE_BREAK_ALPHABETIC] = 0x7B,
+    [G_UNICODE_BREAK_PREFIX] = 0x7B, [G_UNICODE_BREAK_POSTFIX] = 0x7B, [G_UNICODE_BREAK_COMPLEX_CONTEXT] = 0x7B,
+    [G_UNICODE_BREAK_AMBIGUOUS] = 0x7B, [G_UNICODE_BREAK_UNKNOWN] = 0x7B, [G_UNICODE_BREAK_NEXT_LINE] = 0xB1,
+    [G_UNICODE_BREAK_WORD_JOINER] = 0x9D, [G_UNICODE_BREAK_HANGUL_L_JAMO] = 0x7B, [G_UNICODE_BREAK_HANGUL_V_JAMO] = 0x7B,
+    [G_UNICODE_BREAK_HANGUL_T_JAMO] = 0x7B, [G_UNICODE_BREAK_HANGUL_LV_SYLLABLE] = 0x7B, [G_UNICODE_BREAK_HANGUL_LVT_SYLLABLE] = 0x7B,
+    [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = 0x91, [G_UNICODE_BREAK_CONDITIONAL_JAPANESE_STARTER] = 0x7B, [G_UNICODE_BREAK_HEBREW_LETTER] = 0x7B,
+    [G_UNICODE_BREAK_REGIONAL_INDICATOR] = 0x7B, [G_UNICODE_BREAK_EMOJI_BASE] = 0x7B, [G_UNICODE_BREAK_EMOJI_MODIFIER] = 0x7B,
+    [G_UNICODE_BREAK_ZERO_WIDTH_JOINER] = 0x7B,
+  },
+  [G_UNICODE_BREAK_HANGUL_T_JAMO] = {
+    [G_UNICODE_BREAK_MANDATORY] = 0xB1, [G_UNICODE_BREAK_CARRIAGE_RETURN] = 0xB1, [G_UNICODE_BREAK_LINE_FEED] = 0xB1,
+    [G_UNICODE_BREAK_COMBINING_MARK] = 0x7B, [G_UNICODE_BREAK_SURROGATE] = 0x7B, [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = 0xAD,
+    [G_UNICODE_BREAK_INSEPARABLE] = 0x7B, [G_UNICODE_BREAK_NON_BREAKING_GLUE] = 0x7B, [G_UNICODE_BREAK_CONTINGENT] = 0x7B,
+    [G_UNICODE_BREAK_SPACE] = 0xAD, [G_UNICODE_BREAK_AFTER] = 0x7B, [G_UNICODE_BREAK_BEFORE] = 0x7B,
+    [G_UNICODE_BREAK_BEFORE_AND_AFTER] = 0x7B, [G_UNICODE_BREAK_HYPHEN] = 0x7B, [G_UNICODE_BREAK_NON_STARTER] = 0x7B,
+    [G_UNICODE_BREAK_OPEN_PUNCTUATION] = 0x7B, [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = 0x91, [G_UNICODE_BREAK_QUOTATION] = 0x7B,
+    [G_UNICODE_BREAK_EXCLAMATION] = 0x8D, [G_UNICODE_BREAK_IDEOGRAPHIC] = 0x7B, [G_UNICODE_BREAK_NUMERIC] = 0x7B,
+    [G_UNICODE_BREAK_INFIX_SEPARATOR] = 0x91, [G_UNICODE_BREAK_SYMBOL] = 0x91, [G_UNICODE_BREAK_ALPHABETIC] = 0x7B,
+    [G_UNICODE_BREAK_PREFIX] = 0x7B, [G_UNICODE_BREAK_POSTFIX] = 0x7B, [G_UNICODE_BREAK_COMPLEX_CONTEXT] = 0x7B,
+    [G_UNICODE_BREAK_AMBIGUOUS] = 0x7B, [G_UNICODE_BREAK_UNKNOWN] = 0x7B, [G_UNICODE_BREAK_NEXT_LINE] = 0xB1,
+    [G_UNICODE_BREAK_WORD_JOINER] = 0x9D, [G_UNICODE_BREAK_HANGUL_L_JAMO] = 0x7B, [G_UNICODE_BREAK_HANGUL_V_JAMO] = 0x7B,
+    [G_UNICODE_BREAK_HANGUL_T_JAMO] = 0x7B, [G_UNICODE_BREAK_HANGUL_LV_SYLLABLE] = 0x7B, [G_UNICODE_BREAK_HANGUL_LVT_SYLLABLE] = 0x7B,
+    [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = 0x91, [G_UNICODE_BREAK_CONDITIONAL_JAPANESE_STARTER] = 0x7B, [G_UNICODE_BREAK_HEBREW_LETTER] = 0x7B,
+    [G_UNICODE_BREAK_REGIONAL_INDICATOR] = 0x7B, [G_UNICODE_BREAK_EMOJI_BASE] = 0x7B, [G_UNICODE_BREAK_EMOJI_MODIFIER] = 0x7B,
+    [G_UNICODE_BREAK_ZERO_WIDTH_JOINER] = 0x7B,
+  },
+  [G_UNICODE_BREAK_HANGUL_LV_SYLLABLE] = {
+    [G_UNICODE_BREAK_MANDATORY] = 0xB1, [G_UNICODE_BREAK_CARRIAGE_RETURN] = 0xB1, [G_UNICODE_BREAK_LINE_FEED] = 0xB1,
+    [G_UNICODE_BREAK_COMBINING_MARK] = 0x7B, [G_UNICODE_BREAK_SURROGATE] = 0x7B, [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = 0xAD,
+    [G_UNICODE_BREAK_INSEPARABLE] = 0x7B, [G_UNICODE_BREAK_NON_BREAKING_GLUE] = 0x7B, [G_UNICODE_BREAK_CONTINGENT] = 0x7B,
+    [G_UNICODE_BREAK_SPACE] = 0xAD, [G_UNICODE_BREAK_AFTER] = 0x7B, [G_UNICODE_BREAK_BEFORE] = 0x7B,
+    [G_UNICODE_BREAK_BEFORE_AND_AFTER] = 0x7B, [G_UNICODE_BREAK_HYPHEN] = 0x7B, [G_UNICODE_BREAK_NON_STARTER] = 0x7B,
+    [G_UNICODE_BREAK_OPEN_PUNCTUATION] = 0x7B, [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = 0x91, [G_UNICODE_BREAK_QUOTATION] = 0x7B,
+    [G_UNICODE_BREAK_EXCLAMATION] = 0x8D, [G_UNICODE_BREAK_IDEOGRAPHIC] = 0x7B, [G_UNICODE_BREAK_NUMERIC] = 0x7B,
+    [G_UNICODE_BREAK_INFIX_SEPARATOR] = 0x91, [G_UNICODE_BREAK_SYMBOL] = 0x91, [G_UNICODE_BREAK_ALPHABETIC] = 0x7B,
+    [G_UNICODE_BREAK_PREFIX] = 0x7B, [G_UNICODE_BREAK_POSTFIX] = 0x7B, [G_UNICODE_BREAK_COMPLEX_CONTEXT] = 0x7B,
+    [G_UNICODE_BREAK_AMBIGUOUS] = 0x7B, [G_UNICODE_BREAK_UNKNOWN] = 0x7B, [G_UNICODE_BREAK_NEXT_LINE] = 0xB1,
+    [G_UNICODE_BREAK_WORD_JOINER] = 0x9D, [G_UNICODE_BREAK_HANGUL_L_JAMO] = 0x7B, [G_UNICODE_BREAK_HANGUL_V_JAMO] = 0x7B,
+    [G_UNICODE_BREAK_HANGUL_T_JAMO] = 0x7B, [G_UNICODE_BREAK_HANGUL_LV_SYLLABLE] = 0x7B, [G_UNICODE_BREAK_HANGUL_LVT_SYLLABLE] = 0x7B,
+    [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = 0x91, [G_UNICODE_BREAK_CONDITIONAL_JAPANESE_STARTER] = 0x7B, [G_UNICODE_BREAK_HEBREW_LETTER] = 0x7B,
+    [G_UNICODE_BREAK_REGIONAL_INDICATOR] = 0x7B, [G_UNICODE_BREAK_EMOJI_BASE] = 0x7B, [G_UNICODE_BREAK_EMOJI_MODIFIER] = 0x7B,
+    [G_UNICODE_BREAK_ZERO_WIDTH_JOINER] = 0x7B,
+  },
+  [G_UNICODE_BREAK_HANGUL_LVT_SYLLABLE] = {
+    [G_UNICODE_BREAK_MANDATORY] = 0xB1, [G_UNICODE_BREAK_CARRIAGE_RETURN] = 0xB1, [G_UNICODE_BREAK_LINE_FEED] = 0xB1,
+    [G_UNICODE_BREAK_COMBINING_MARK] = 0x7B, [G_UNICODE_BREAK_SURROGATE] = 0x7B, [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = 0xAD,
+    [G_UNICODE_BREAK_INSEPARABLE] = 0x7B, [G_UNICODE_BREAK_NON_BREAKING_GLUE] = 0x7B, [G_UNICODE_BREAK_CONTINGENT] = 0x7B,
+    [G_UNICODE_BREAK_SPACE] = 0xAD, [G_UNICODE_BREAK_AFTER] = 0x7B, [G_UNICODE_BREAK_BEFORE] = 0x7B,
+    [G_UNICODE_BREAK_BEFORE_AND_AFTER] = 0x7B, [G_UNICODE_BREAK_HYPHEN] = 0x7B, [G_UNICODE_BREAK_NON_STARTER] = 0x7B,
+    [G_UNICODE_BREAK_OPEN_PUNCTUATION] = 0x7B, [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = 0x91, [G_UNICODE_BREAK_QUOTATION] = 0x7B,
+    [G_UNICODE_BREAK_EXCLAMATION] = 0x8D, [G_UNICODE_BREAK_IDEOGRAPHIC] = 0x7B, [G_UNICODE_BREAK_NUMERIC] = 0x7B,
+    [G_UNICODE_BREAK_INFIX_SEPARATOR] = 0x91, [G_UNICODE_BREAK_SYMBOL] = 0x91, [G_UNICODE_BREAK_ALPHABETIC] = 0x7B,
+    [G_UNICODE_BREAK_PREFIX] = 0x7B, [G_UNICODE_BREAK_POSTFIX] = 0x7B, [G_UNICODE_BREAK_COMPLEX_CONTEXT] = 0x7B,
+    [G_UNICODE_BREAK_AMBIGUOUS] = 0x7B, [G_UNICODE_BREAK_UNKNOWN] = 0x7B, [G_UNICODE_BREAK_NEXT_LINE] = 0xB1,
+    [G_UNICODE_BREAK_WORD_JOINER] = 0x9D, [G_UNICODE_BREAK_HANGUL_L_JAMO] = 0x7B, [G_UNICODE_BREAK_HANGUL_V_JAMO] = 0x7B,
+    [G_UNICODE_BREAK_HANGUL_T_JAMO] = 0x7B, [G_UNICODE_BREAK_HANGUL_LV_SYLLABLE] = 0x7B, [G_UNICODE_BREAK_HANGUL_LVT_SYLLABLE] = 0x7B,
+    [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = 0x91, [G_UNICODE_BREAK_CONDITIONAL_JAPANESE_STARTER] = 0x7B, [G_UNICODE_BREAK_HEBREW_LETTER] = 0x7B,
+    [G_UNICODE_BREAK_REGIONAL_INDICATOR] = 0x7B, [G_UNICODE_BREAK_EMOJI_BASE] = 0x7B, [G_UNICODE_BREAK_EMOJI_MODIFIER] = 0x7B,
+    [G_UNICODE_BREAK_ZERO_WIDTH_JOINER] = 0x7B,
+  },
+  [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = {
+    [G_UNICODE_BREAK_MANDATORY] = 0xB1, [G_UNICODE_BREAK_CARRIAGE_RETURN] = 0xB1, [G_UNICODE_BREAK_LINE_FEED] = 0xB1,
+    [G_UNICODE_BREAK_COMBINING_MARK] = 0x7B, [G_UNICODE_BREAK_SURROGATE] = 0x7B, [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = 0xAD,
+    [G_UNICODE_BREAK_INSEPARABLE] = 0x7B, [G_UNICODE_BREAK_NON_BREAKING_GLUE] = 0x7B, [G_UNICODE_BREAK_CONTINGENT] = 0x7B,
+    [G_UNICODE_BREAK_SPACE] = 0xAD, [G_UNICODE_BREAK_AFTER] = 0x7B, [G_UNICODE_BREAK_BEFORE] = 0x7B,
+    [G_UNICODE_BREAK_BEFORE_AND_AFTER] = 0x7B, [G_UNICODE_BREAK_HYPHEN] = 0x7B, [G_UNICODE_BREAK_NON_STARTER] = 0x81,
+    [G_UNICODE_BREAK_OPEN_PUNCTUATION] = 0x7B, [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = 0x91, [G_UNICODE_BREAK_QUOTATION] = 0x7B,
+    [G_UNICODE_BREAK_EXCLAMATION] = 0x8D, [G_UNICODE_BREAK_IDEOGRAPHIC] = 0x7B, [G_UNICODE_BREAK_NUMERIC] = 0x7B,
+    [G_UNICODE_BREAK_INFIX_SEPARATOR] = 0x91, [G_UNICODE_BREAK_SYMBOL] = 0x91, [G_UNICODE_BREAK_ALPHABETIC] = 0x7B,
+    [G_UNICODE_BREAK_PREFIX] = 0x7B, [G_UNICODE_BREAK_POSTFIX] = 0x7B, [G_UNICODE_BREAK_COMPLEX_CONTEXT] = 0x7B,
+    [G_UNICODE_BREAK_AMBIGUOUS] = 0x7B, [G_UNICODE_BREAK_UNKNOWN] = 0x7B, [G_UNICODE_BREAK_NEXT_LINE] = 0xB1,
+    [G_UNICODE_BREAK_WORD_JOINER] = 0x9D, [G_UNICODE_BREAK_HANGUL_L_JAMO] = 0x7B, [G_UNICODE_BREAK_HANGUL_V_JAMO] = 0x7B,
+    [G_UNICODE_BREAK_HANGUL_T_JAMO] = 0x7B, [G_UNICODE_BREAK_HANGUL_LV_SYLLABLE] = 0x7B, [G_UNICODE_BREAK_HANGUL_LVT_SYLLABLE] = 0x7B,
+    [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = 0x91, [G_UNICODE_BREAK_CONDITIONAL_JAPANESE_STARTER] = 0x7B, [G_UNICODE_BREAK_HEBREW_LETTER] = 0x7B,
+    [G_UNICODE_BREAK_REGIONAL_INDICATOR] = 0x7B, [G_UNICODE_BREAK_EMOJI_BASE] = 0x7B, [G_UNICODE_BREAK_EMOJI_MODIFIER] = 0x7B,
+    [G_UNICODE_BREAK_ZERO_WIDTH_JOINER] = 0x7B,
+  },
+  [G_UNICODE_BREAK_CONDITIONAL_JAPANESE_STARTER] = {
+    [G_UNICODE_BREAK_MANDATORY] = 0xB1, [G_UNICODE_BREAK_CARRIAGE_RETURN] = 0xB1, [G_UNICODE_BREAK_LINE_FEED] = 0xB1,
+    [G_UNICODE_BREAK_COMBINING_MARK] = 0x7B, [G_UNICODE_BREAK_SURROGATE] = 0x7B, [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = 0xAD,
+    [G_UNICODE_BREAK_INSEPARABLE] = 0x7B, [G_UNICODE_BREAK_NON_BREAKING_GLUE] = 0x7B, [G_UNICODE_BREAK_CONTINGENT] = 0x7B,
+    [G_UNICODE_BREAK_SPACE] = 0xAD, [G_UNICODE_BREAK_AFTER] = 0x7B, [G_UNICODE_BREAK_BEFORE] = 0x7B,
+    [G_UNICODE_BREAK_BEFORE_AND_AFTER] = 0x7B, [G_UNICODE_BREAK_HYPHEN] = 0x7B, [G_UNICODE_BREAK_NON_STARTER] = 0x7B,
+    [G_UNICODE_BREAK_OPEN_PUNCTUATION] = 0x7B, [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = 0x91, [G_UNICODE_BREAK_QUOTATION] = 0x7B,
+    [G_UNICODE_BREAK_EXCLAMATION] = 0x8D, [G_UNICODE_BREAK_IDEOGRAPHIC] = 0x7B, [G_UNICODE_BREAK_NUMERIC] = 0x7B,
+    [G_UNICODE_BREAK_INFIX_SEPARATOR] = 0x91, [G_UNICODE_BREAK_SYMBOL] = 0x91, [G_UNICODE_BREAK_ALPHABETIC] = 0x7B,
+    [G_UNICODE_BREAK_PREFIX] = 0x7B, [G_UNICODE_BREAK_POSTFIX] = 0x7B, [G_UNICODE_BREAK_COMPLEX_CONTEXT] = 0x7B,
+    [G_UNICODE_BREAK_AMBIGUOUS] = 0x7B, [G_UNICODE_BREAK_UNKNOWN] = 0x7B, [G_UNICODE_BREAK_NEXT_LINE] = 0xB1,
+    [G_UNICODE_BREAK_WORD_JOINER] = 0x9D, [G_UNICODE_BREAK_HANGUL_L_JAMO] = 0x7B, [G_UNICODE_BREAK_HANGUL_V_JAMO] = 0x7B,
+    [G_UNICODE_BREAK_HANGUL_T_JAMO] = 0x7B, [G_UNICODE_BREAK_HANGUL_LV_SYLLABLE] = 0x7B, [G_UNICODE_BREAK_HANGUL_LVT_SYLLABLE] = 0x7B,
+    [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = 0x91, [G_UNICODE_BREAK_CONDITIONAL_JAPANESE_STARTER] = 0x7B, [G_UNICODE_BREAK_HEBREW_LETTER] = 0x7B,
+    [G_UNICODE_BREAK_REGIONAL_INDICATOR] = 0x7B, [G_UNICODE_BREAK_EMOJI_BASE] = 0x7B, [G_UNICODE_BREAK_EMOJI_MODIFIER] = 0x7B,
+    [G_UNICODE_BREAK_ZERO_WIDTH_JOINER] = 0x7B,
+  },
+  [G_UNICODE_BREAK_HEBREW_LETTER] = {
+    [G_UNICODE_BREAK_MANDATORY] = 0xB1, [G_UNICODE_BREAK_CARRIAGE_RETURN] = 0xB1, [G_UNICODE_BREAK_LINE_FEED] = 0xB1,
+    [G_UNICODE_BREAK_COMBINING_MARK] = 0x7B, [G_UNICODE_BREAK_SURROGATE] = 0x7B, [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = 0xAD,
+    [G_UNICODE_BREAK_INSEPARABLE] = 0x7B, [G_UNICODE_BREAK_NON_BREAKING_GLUE] = 0x7B, [G_UNICODE_BREAK_CONTINGENT] = 0x7B,
+    [G_UNICODE_BREAK_SPACE] = 0xAD, [G_UNICODE_BREAK_AFTER] = 0x7B, [G_UNICODE_BREAK_BEFORE] = 0x7B,
+    [G_UNICODE_BREAK_BEFORE_AND_AFTER] = 0x7B, [G_UNICODE_BREAK_HYPHEN] = 0x7B, [G_UNICODE_BREAK_NON_STARTER] = 0x7B,
+    [G_UNICODE_BREAK_OPEN_PUNCTUATION] = 0x7B, [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = 0x91, [G_UNICODE_BREAK_QUOTATION] = 0x7B,
+    [G_UNICODE_BREAK_EXCLAMATION] = 0x8D, [G_UNICODE_BREAK_IDEOGRAPHIC] = 0x7B, [G_UNICODE_BREAK_NUMERIC] = 0x7B,
+    [G_UNICODE_BREAK_INFIX_SEPARATOR] = 0x91, [G_UNICODE_BREAK_SYMBOL] = 0x91, [G_UNICODE_BREAK_ALPHABETIC] = 0x7B,
+    [G_UNICODE_BREAK_PREFIX] = 0x7B, [G_UNICODE_BREAK_POSTFIX] = 0x7B, [G_UNICODE_BREAK_COMPLEX_CONTEXT] = 0x7B,
+    [G_UNICODE_BREAK_AMBIGUOUS] = 0x7B, [G_UNICODE_BREAK_UNKNOWN] = 0x7B, [G_UNICODE_BREAK_NEXT_LINE] = 0xB1,
+    [G_UNICODE_BREAK_WORD_JOINER] = 0x9D, [G_UNICODE_BREAK_HANGUL_L_JAMO] = 0x7B, [G_UNICODE_BREAK_HANGUL_V_JAMO] = 0x7B,
+    [G_UNICODE_BREAK_HANGUL_T_JAMO] = 0x7B, [G_UNICODE_BREAK_HANGUL_LV_SYLLABLE] = 0x7B, [G_UNICODE_BREAK_HANGUL_LVT_SYLLABLE] = 0x7B,
+    [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = 0x91, [G_UNICODE_BREAK_CONDITIONAL_JAPANESE_STARTER] = 0x7B, [G_UNICODE_BREAK_HEBREW_LETTER] = 0x7B,
+    [G_UNICODE_BREAK_REGIONAL_INDICATOR] = 0x7B, [G_UNICODE_BREAK_EMOJI_BASE] = 0x7B, [G_UNICODE_BREAK_EMOJI_MODIFIER] = 0x7B,
+    [G_UNICODE_BREAK_ZERO_WIDTH_JOINER] = 0x7B,
+  },
+  [G_UNICODE_BREAK_REGIONAL_INDICATOR] = {
+    [G_UNICODE_BREAK_MANDATORY] = 0xB1, [G_UNICODE_BREAK_CARRIAGE_RETURN] = 0xB1, [G_UNICODE_BREAK_LINE_FEED] = 0xB1,
+    [G_UNICODE_BREAK_COMBINING_MARK] = 0x7B, [G_UNICODE_BREAK_SURROGATE] = 0x7B, [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = 0xAD,
+    [G_UNICODE_BREAK_INSEPARABLE] = 0x7B, [G_UNICODE_BREAK_NON_BREAKING_GLUE] = 0x7B, [G_UNICODE_BREAK_CONTINGENT] = 0x7B,
+    [G_UNICODE_BREAK_SPACE] = 0xAD, [G_UNICODE_BREAK_AFTER] = 0x7B, [G_UNICODE_BREAK_BEFORE] = 0x7B,
+    [G_UNICODE_BREAK_BEFORE_AND_AFTER] = 0x7B, [G_UNICODE_BREAK_HYPHEN] = 0x7B, [G_UNICODE_BREAK_NON_STARTER] = 0x7B,
+    [G_UNICODE_BREAK_OPEN_PUNCTUATION] = 0x7B, [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = 0x91, [G_UNICODE_BREAK_QUOTATION] = 0x7B,
+    [G_UNICODE_BREAK_EXCLAMATION] = 0x8D, [G_UNICODE_BREAK_IDEOGRAPHIC] = 0x7B, [G_UNICODE_BREAK_NUMERIC] = 0x7B,
+    [G_UNICODE_BREAK_INFIX_SEPARATOR] = 0x91, [G_UNICODE_BREAK_SYMBOL] = 0x91, [G_UNICODE_BREAK_ALPHABETIC] = 0x7B,
+    [G_UNICODE_BREAK_PREFIX] = 0x7B, [G_UNICODE_BREAK_POSTFIX] = 0x7B, [G_UNICODE_BREAK_COMPLEX_CONTEXT] = 0x7B,
+    [G_UNICODE_BREAK_AMBIGUOUS] = 0x7B, [G_UNICODE_BREAK_UNKNOWN] = 0x7B, [G_UNICODE_BREAK_NEXT_LINE] = 0xB1,
+    [G_UNICODE_BREAK_WORD_JOINER] = 0x9D, [G_UNICODE_BREAK_HANGUL_L_JAMO] = 0x7B, [G_UNICODE_BREAK_HANGUL_V_JAMO] = 0x7B,
+    [G_UNICODE_BREAK_HANGUL_T_JAMO] = 0x7B, [G_UNICODE_BREAK_HANGUL_LV_SYLLABLE] = 0x7B, [G_UNICODE_BREAK_HANGUL_LVT_SYLLABLE] = 0x7B,
+    [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = 0x91, [G_UNICODE_BREAK_CONDITIONAL_JAPANESE_STARTER] = 0x7B, [G_UNICODE_BREAK_HEBREW_LETTER] = 0x7B,
+    [G_UNICODE_BREAK_REGIONAL_INDICATOR] = 0x7B, [G_UNICODE_BREAK_EMOJI_BASE] = 0x7B, [G_UNICODE_BREAK_EMOJI_MODIFIER] = 0x7B,
+    [G_UNICODE_BREAK_ZERO_WIDTH_JOINER] = 0x7B,
+  },
+  [G_UNICODE_BREAK_EMOJI_BASE] = {
+    [G_UNICODE_BREAK_MANDATORY] = 0xB1, [G_UNICODE_BREAK_CARRIAGE_RETURN] = 0xB1, [G_UNICODE_BREAK_LINE_FEED] = 0xB1,
+    [G_UNICODE_BREAK_COMBINING_MARK] = 0x7B, [G_UNICODE_BREAK_SURROGATE] = 0x7B, [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = 0xAD,
+    [G_UNICODE_BREAK_INSEPARABLE] = 0x7B, [G_UNICODE_BREAK_NON_BREAKING_GLUE] = 0x7B, [G_UNICODE_BREAK_CONTINGENT] = 0x7B,
+    [G_UNICODE_BREAK_SPACE] = 0xAD, [G_UNICODE_BREAK_AFTER] = 0x7B, [G_UNICODE_BREAK_BEFORE] = 0x7B,
+    [G_UNICODE_BREAK_BEFORE_AND_AFTER] = 0x7B, [G_UNICODE_BREAK_HYPHEN] = 0x7B, [G_UNICODE_BREAK_NON_STARTER] = 0x7B,
+    [G_UNICODE_BREAK_OPEN_PUNCTUATION] = 0x7B, [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = 0x91, [G_UNICODE_BREAK_QUOTATION] = 0x7B,
+    [G_UNICODE_BREAK_EXCLAMATION] = 0x8D, [G_UNICODE_BREAK_IDEOGRAPHIC] = 0x7B, [G_UNICODE_BREAK_NUMERIC] = 0x7B,
+    [G_UNICODE_BREAK_INFIX_SEPARATOR] = 0x91, [G_UNICODE_BREAK_SYMBOL] = 0x91, [G_UNICODE_BREAK_ALPHABETIC] = 0x7B,
+    [G_UNICODE_BREAK_PREFIX] = 0x7B, [G_UNICODE_BREAK_POSTFIX] = 0x7B, [G_UNICODE_BREAK_COMPLEX_CONTEXT] = 0x7B,
+    [G_UNICODE_BREAK_AMBIGUOUS] = 0x7B, [G_UNICODE_BREAK_UNKNOWN] = 0x7B, [G_UNICODE_BREAK_NEXT_LINE] = 0xB1,
+    [G_UNICODE_BREAK_WORD_JOINER] = 0x9D, [G_UNICODE_BREAK_HANGUL_L_JAMO] = 0x7B, [G_UNICODE_BREAK_HANGUL_V_JAMO] = 0x7B,
+    [G_UNICODE_BREAK_HANGUL_T_JAMO] = 0x7B, [G_UNICODE_BREAK_HANGUL_LV_SYLLABLE] = 0x7B, [G_UNICODE_BREAK_HANGUL_LVT_SYLLABLE] = 0x7B,
+    [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = 0x91, [G_UNICODE_BREAK_CONDITIONAL_JAPANESE_STARTER] = 0x7B, [G_UNICODE_BREAK_HEBREW_LETTER] = 0x7B,
+    [G_UNICODE_BREAK_REGIONAL_INDICATOR] = 0x7B, [G_UNICODE_BREAK_EMOJI_BASE] = 0x7B, [G_UNICODE_BREAK_EMOJI_MODIFIER] = 0x7B,
+    [G_UNICODE_BREAK_ZERO_WIDTH_JOINER] = 0x7B,
+  },
+  [G_UNICODE_BREAK_EMOJI_MODIFIER] = {
+    [G_UNICODE_BREAK_MANDATORY] = 0xB1, [G_UNICODE_BREAK_CARRIAGE_RETURN] = 0xB1, [G_UNICODE_BREAK_LINE_FEED] = 0xB1,
+    [G_UNICODE_BREAK_COMBINING_MARK] = 0x7B, [G_UNICODE_BREAK_SURROGATE] = 0x7B, [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = 0xAD,
+    [G_UNICODE_BREAK_INSEPARABLE] = 0x7B, [G_UNICODE_BREAK_NON_BREAKING_GLUE] = 0x7B, [G_UNICODE_BREAK_CONTINGENT] = 0x7B,
+    [G_UNICODE_BREAK_SPACE] = 0xAD, [G_UNICODE_BREAK_AFTER] = 0x7B, [G_UNICODE_BREAK_BEFORE] = 0x7B,
+    [G_UNICODE_BREAK_BEFORE_AND_AFTER] = 0x7B, [G_UNICODE_BREAK_HYPHEN] = 0x7B, [G_UNICODE_BREAK_NON_STARTER] = 0x7B,
+    [G_UNICODE_BREAK_OPEN_PUNCTUATION] = 0x7B, [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = 0x91, [G_UNICODE_BREAK_QUOTATION] = 0x7B,
+    [G_UNICODE_BREAK_EXCLAMATION] = 0x8D, [G_UNICODE_BREAK_IDEOGRAPHIC] = 0x7B, [G_UNICODE_BREAK_NUMERIC] = 0x7B,
+    [G_UNICODE_BREAK_INFIX_SEPARATOR] = 0x91, [G_UNICODE_BREAK_SYMBOL] = 0x91, [G_UNICODE_BREAK_ALPHABETIC] = 0x7B,
+    [G_UNICODE_BREAK_PREFIX] = 0x7B, [G_UNICODE_BREAK_POSTFIX] = 0x7B, [G_UNICODE_BREAK_COMPLEX_CONTEXT] = 0x7B,
+    [G_UNICODE_BREAK_AMBIGUOUS] = 0x7B, [G_UNICODE_BREAK_UNKNOWN] = 0x7B, [G_UNICODE_BREAK_NEXT_LINE] = 0xB1,
+    [G_UNICODE_BREAK_WORD_JOINER] = 0x9D, [G_UNICODE_BREAK_HANGUL_L_JAMO] = 0x7B, [G_UNICODE_BREAK_HANGUL_V_JAMO] = 0x7B,
+    [G_UNICODE_BREAK_HANGUL_T_JAMO] = 0x7B, [G_UNICODE_BREAK_HANGUL_LV_SYLLABLE] = 0x7B, [G_UNICODE_BREAK_HANGUL_LVT_SYLLABLE] = 0x7B,
+    [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = 0x91, [G_UNICODE_BREAK_CONDITIONAL_JAPANESE_STARTER] = 0x7B, [G_UNICODE_BREAK_HEBREW_LETTER] = 0x7B,
+    [G_UNICODE_BREAK_REGIONAL_INDICATOR] = 0x7B, [G_UNICODE_BREAK_EMOJI_BASE] = 0x7B, [G_UNICODE_BREAK_EMOJI_MODIFIER] = 0x7B,
+    [G_UNICODE_BREAK_ZERO_WIDTH_JOINER] = 0x7B,
+  },
+  [G_UNICODE_BREAK_ZERO_WIDTH_JOINER] = {
+    [G_UNICODE_BREAK_MANDATORY] = 0xB1, [G_UNICODE_BREAK_CARRIAGE_RETURN] = 0xB1, [G_UNICODE_BREAK_LINE_FEED] = 0xB1,
+    [G_UNICODE_BREAK_COMBINING_MARK] = 0x7B, [G_UNICODE_BREAK_SURROGATE] = 0x7B, [G_UNICODE_BREAK_ZERO_WIDTH_SPACE] = 0xAD,
+    [G_UNICODE_BREAK_INSEPARABLE] = 0x7B, [G_UNICODE_BREAK_NON_BREAKING_GLUE] = 0x7B, [G_UNICODE_BREAK_CONTINGENT] = 0x7B,
+    [G_UNICODE_BREAK_SPACE] = 0xAD, [G_UNICODE_BREAK_AFTER] = 0x7B, [G_UNICODE_BREAK_BEFORE] = 0x7B,
+    [G_UNICODE_BREAK_BEFORE_AND_AFTER] = 0x7B, [G_UNICODE_BREAK_HYPHEN] = 0x7B, [G_UNICODE_BREAK_NON_STARTER] = 0x7B,
+    [G_UNICODE_BREAK_OPEN_PUNCTUATION] = 0x7B, [G_UNICODE_BREAK_CLOSE_PUNCTUATION] = 0x91, [G_UNICODE_BREAK_QUOTATION] = 0x7B,
+    [G_UNICODE_BREAK_EXCLAMATION] = 0x8D, [G_UNICODE_BREAK_IDEOGRAPHIC] = 0x7B, [G_UNICODE_BREAK_NUMERIC] = 0x7B,
+    [G_UNICODE_BREAK_INFIX_SEPARATOR] = 0x91, [G_UNICODE_BREAK_SYMBOL] = 0x91, [G_UNICODE_BREAK_ALPHABETIC] = 0x7B,
+    [G_UNICODE_BREAK_PREFIX] = 0x7B, [G_UNICODE_BREAK_POSTFIX] = 0x7B, [G_UNICODE_BREAK_COMPLEX_CONTEXT] = 0x7B,
+    [G_UNICODE_BREAK_AMBIGUOUS] = 0x7B, [G_UNICODE_BREAK_UNKNOWN] = 0x7B, [G_UNICODE_BREAK_NEXT_LINE] = 0xB1,
+    [G_UNICODE_BREAK_WORD_JOINER] = 0x9D, [G_UNICODE_BREAK_HANGUL_L_JAMO] = 0x7B, [G_UNICODE_BREAK_HANGUL_V_JAMO] = 0x7B,
+    [G_UNICODE_BREAK_HANGUL_T_JAMO] = 0x7B, [G_UNICODE_BREAK_HANGUL_LV_SYLLABLE] = 0x7B, [G_UNICODE_BREAK_HANGUL_LVT_SYLLABLE] = 0x7B,
+    [G_UNICODE_BREAK_CLOSE_PARANTHESIS] = 0x91, [G_UNICODE_BREAK_CONDITIONAL_JAPANESE_STARTER] = 0x7B, [G_UNICODE_BREAK_HEBREW_LETTER] = 0x7B,
+    [G_UNICODE_BREAK_REGIONAL_INDICATOR] = 0x7B, [G_UNICODE_BREAK_EMOJI_BASE] = 0x7B, [G_UNICODE_BREAK_EMOJI_MODIFIER] = 0x7B,
+    [G_UNICODE_BREAK_ZERO_WIDTH_JOINER] = 0x7B,
+  },
+};
+
+#endif /* PANGO_LINE_BREAK_TABLE_H */
+
+/* == End of generated table == */
@@ -25,6 +25,7 @@
 #include <errno.h>
 
 #include "vogue-attributes.h"
+#include "vogue-break.h"
 #include "vogue-font.h"
 #include "vogue-enum-types.h"
 #include "vogue-impl-utils.h"
@@ -228,13 +229,22 @@ typedef struct _MarkupData MarkupData;
 
 struct _MarkupData
 {
-  VogueAttrList *attr_list;
   GString *text;
   GSList *tag_stack;
   gsize index;
-  GSList *to_apply;
+  GPtrArray *to_apply;		/* attributes of closed tags, latest closed last */
+  GPtrArray *accel_attrs;	/* underlines for accelerators, in order */
   gunichar accel_marker;
   gunichar accel_char;
+  guint want_attr_list : 1;
+
+  /* Streaming mode; text holds everything from text_start on */
+  VogueMarkupParagraphFunc paragraph_func;
+  gpointer paragraph_data;
+  GDestroyNotify paragraph_destroy;
+  gsize text_start;
+  gsize paragraph_start;	/* end of the last emitted paragraph */
+  gsize scan_index;		/* no paragraph delimiters before this */
 };
 
 typedef struct _OpenTag OpenTag;
@@ -401,7 +411,7 @@ markup_data_open_tag (MarkupData   *md)
   OpenTag *ot;
   OpenTag *parent = NULL;
 
-  if (md->attr_list == NULL)
+  if (!md->want_attr_list)
     return NULL;
 
   if (md->tag_stack)
@@ -432,13 +442,36 @@ markup_data_open_tag (MarkupData   *md)
   return ot;
 }
 
+/* Returns the attribute for the relative font size set by @ot */
+static VogueAttribute *
+open_tag_scale_attr (OpenTag *ot)
+{
+  if (ot->has_base_font_size)
+    {
+      /* Create a font using the absolute point size
+       * as the base size to be scaled from
+       */
+      return vogue_attr_size_new (scale_factor (ot->scale_level,
+					        1.0) *
+				  ot->base_font_size);
+    }
+  else
+    {
+      /* Create a font using the current scale factor
+       * as the base size to be scaled from
+       */
+      return vogue_attr_scale_new (scale_factor (ot->scale_level,
+					         ot->base_scale_factor));
+    }
+}
+
 static void
 markup_data_close_tag (MarkupData *md)
 {
   OpenTag *ot;
   GSList *tmp_list;
 
-  if (md->attr_list == NULL)
+  if (!md->want_attr_list)
     return;
 
   /* pop the stack */
@@ -446,9 +479,9 @@ markup_data_close_tag (MarkupData *md)
   md->tag_stack = g_slist_delete_link (md->tag_stack,
 				       md->tag_stack);
 
-  /* Adjust end indexes, and push each attr onto the front of the
-   * to_apply list. This means that outermost tags are on the front of
-   * that list; if we apply the list in order, then the innermost
+  /* Adjust end indexes, and push each attr onto the end of the
+   * to_apply array. This means that outermost tags are at the end of
+   * that array; if we apply it from the end, then the innermost
    * tags will "win" which is correct.
    */
   tmp_list = ot->attrs;
@@ -459,7 +492,7 @@ markup_data_close_tag (MarkupData *md)
       a->start_index = ot->start_index;
       a->end_index = md->index;
 
-      md->to_apply = g_slist_prepend (md->to_apply, a);
+      g_ptr_array_add (md->to_apply, a);
 
       tmp_list = g_slist_next (tmp_list);
     }
@@ -469,34 +502,242 @@ markup_data_close_tag (MarkupData *md)
       /* We affected relative font size; create an appropriate
        * attribute and reverse our effects on the current level
        */
-      VogueAttribute *a;
+      VogueAttribute *a = open_tag_scale_attr (ot);
+
+      a->start_index = ot->start_index;
+      a->end_index = md->index;
+
+      g_ptr_array_add (md->to_apply, a);
+    }
+
+  g_slist_free (ot->attrs);
+  g_slice_free (OpenTag, ot);
+}
+
+/* Moves the attributes of @array that overlap [@start, @end) to
+ * @attrs. Attributes that extend past @end are copied and stay in
+ * @array for the next paragraph.
+ */
+static void
+take_paragraph_attrs (GPtrArray *array,
+		      gboolean   reverse,
+		      gsize      start,
+		      gsize      end,
+		      GPtrArray *attrs)
+{
+  guint i, j;
+
+  for (i = 0; i < array->len; i++)
+    {
+      guint index = reverse ? array->len - 1 - i : i;
+      VogueAttribute *a = g_ptr_array_index (array, index);
+
+      if (a->start_index >= end || a->end_index <= start)
+	continue;
+
+      if (a->end_index <= end)
+	g_ptr_array_index (array, index) = NULL;
+      else
+	a = vogue_attribute_copy (a);
+
+      g_ptr_array_add (attrs, a);
+    }
 
-      if (ot->has_base_font_size)
+  /* Compact the array, dropping empty attributes left behind */
+  for (i = 0, j = 0; i < array->len; i++)
+    {
+      VogueAttribute *a = g_ptr_array_index (array, i);
+
+      if (a == NULL)
+	continue;
+
+      if (a->end_index > end || a->start_index >= end)
+	g_ptr_array_index (array, j++) = a;
+      else
+	vogue_attribute_destroy (a);
+    }
+  g_ptr_array_set_size (array, j);
+}
+
+static int
+compare_start_index (gconstpointer a,
+		     gconstpointer b)
+{
+  const VogueAttribute *attr1 = *(const VogueAttribute **) a;
+  const VogueAttribute *attr2 = *(const VogueAttribute **) b;
+
+  if (attr1->start_index < attr2->start_index)
+    return -1;
+  else if (attr1->start_index > attr2->start_index)
+    return 1;
+  else
+    return 0;
+}
+
+/* Adds copies of the attributes of the tags that are still open and
+ * started before @end to @attrs, ending at @end. These tags will be
+ * closed after all the others, the outermost last, so in the order of
+ * markup_data_finish() their attributes come before those of closed
+ * tags, the outermost first.
+ */
+static void
+copy_open_tag_attrs (MarkupData *md,
+		     gsize       end,
+		     GPtrArray  *attrs)
+{
+  GSList *stack, *l, *tmp_list;
+
+  stack = g_slist_reverse (g_slist_copy (md->tag_stack));
+
+  for (l = stack; l; l = l->next)
+    {
+      OpenTag *ot = l->data;
+      guint first = attrs->len;
+      guint i, j;
+
+      if (ot->start_index >= end)
+	continue;
+
+      /* Same order as markup_data_close_tag(), reversed */
+      for (tmp_list = ot->attrs; tmp_list; tmp_list = tmp_list->next)
+	g_ptr_array_add (attrs, vogue_attribute_copy (tmp_list->data));
+      if (ot->scale_level_delta != 0)
+	g_ptr_array_add (attrs, open_tag_scale_attr (ot));
+
+      for (i = first, j = attrs->len; i + 1 < j; i++, j--)
 	{
-	  /* Create a font using the absolute point size
-	   * as the base size to be scaled from
-	   */
-	  a = vogue_attr_size_new (scale_factor (ot->scale_level,
-						 1.0) *
-				   ot->base_font_size);
+	  gpointer tmp = g_ptr_array_index (attrs, i);
+
+	  g_ptr_array_index (attrs, i) = g_ptr_array_index (attrs, j - 1);
+	  g_ptr_array_index (attrs, j - 1) = tmp;
 	}
-      else
+
+      for (i = first; i < attrs->len; i++)
 	{
-	  /* Create a font using the current scale factor
-	   * as the base size to be scaled from
-	   */
-	  a = vogue_attr_scale_new (scale_factor (ot->scale_level,
-						  ot->base_scale_factor));
+	  VogueAttribute *a = g_ptr_array_index (attrs, i);
+
+	  a->start_index = ot->start_index;
+	  a->end_index = end;
 	}
+    }
 
-      a->start_index = ot->start_index;
-      a->end_index = md->index;
+  g_slist_free (stack);
+}
+
+/* Hands the text from paragraph_start up to @end to the paragraph func.
+ *
+ * Since this runs as soon as a paragraph is complete, the attributes
+ * of closed tags that are left over all end in or after the current
+ * paragraph, so the work here is proportional to the attributes that
+ * apply to the paragraph.
+ */
+static void
+markup_data_emit_paragraph (MarkupData *md,
+			    gsize       end)
+{
+  GPtrArray *attrs;
+  VogueAttrList *list;
+  gsize start = md->paragraph_start;
+  guint i;
+
+  /* Same order as in markup_data_finish(). Attributes are sorted
+   * before they are clipped to the paragraph, so that those that
+   * started in earlier paragraphs keep their relative order.
+   */
+  attrs = g_ptr_array_new ();
+  take_paragraph_attrs (md->accel_attrs, FALSE, start, end, attrs);
+  copy_open_tag_attrs (md, end, attrs);
+  take_paragraph_attrs (md->to_apply, TRUE, start, end, attrs);
+  g_ptr_array_sort (attrs, compare_start_index);
+
+  for (i = 0; i < attrs->len; i++)
+    {
+      VogueAttribute *a = g_ptr_array_index (attrs, i);
 
-      md->to_apply = g_slist_prepend (md->to_apply, a);
+      a->start_index = MAX (a->start_index, start) - start;
+      a->end_index = MIN (a->end_index, end) - start;
     }
 
-  g_slist_free (ot->attrs);
-  g_slice_free (OpenTag, ot);
+  list = vogue_attr_list_new_from_sorted ((VogueAttribute **) attrs->pdata, attrs->len, TRUE);
+  g_ptr_array_free (attrs, TRUE);
+
+  md->paragraph_func (md->text->str + (start - md->text_start), end - start,
+		      list, md->paragraph_data);
+  vogue_attr_list_unref (list);
+
+  md->paragraph_start = end;
+}
+
+/* In streaming mode, emits all paragraphs whose text is complete.
+ * Tags that are still open apply up to the end of each paragraph.
+ * With @at_end, the rest of the text is emitted too.
+ */
+static void
+markup_data_flush_paragraphs (MarkupData *md,
+			      gboolean    at_end)
+{
+  if (md->paragraph_func == NULL)
+    return;
+
+  while (md->scan_index < md->index)
+    {
+      const char *p = md->text->str + (md->scan_index - md->text_start);
+      int length = md->index - md->scan_index;
+      int delimiter, next;
+
+      vogue_find_paragraph_boundary (p, length, &delimiter, &next);
+
+      if (delimiter == length)
+	{
+	  /* The start of a paragraph separator may be at the end */
+	  if (length > 2)
+	    md->scan_index = md->index - 2;
+	  break;
+	}
+
+      if (next == length && p[delimiter] == '\r' && !at_end)
+	{
+	  /* Wait for a \n that may follow */
+	  md->scan_index += delimiter;
+	  break;
+	}
+
+      md->scan_index += next;
+      markup_data_emit_paragraph (md, md->scan_index);
+    }
+
+  if (at_end)
+    {
+      if (md->paragraph_start < md->index)
+	markup_data_emit_paragraph (md, md->index);
+
+      /* Only empty attributes at the very end can be left */
+      g_ptr_array_foreach (md->to_apply, (GFunc) vogue_attribute_destroy, NULL);
+      g_ptr_array_set_size (md->to_apply, 0);
+      g_ptr_array_foreach (md->accel_attrs, (GFunc) vogue_attribute_destroy, NULL);
+      g_ptr_array_set_size (md->accel_attrs, 0);
+    }
+
+  /* Drop the emitted text all at once */
+  if (md->paragraph_start > md->text_start)
+    {
+      g_string_erase (md->text, 0, md->paragraph_start - md->text_start);
+      md->text_start = md->paragraph_start;
+    }
+}
+
+/* The fast parser has no context; its errors are never shown,
+ * since it leaves erroneous markup to GMarkup.
+ */
+static void
+get_position (GMarkupParseContext *context,
+	      int                 *line_number,
+	      int                 *char_number)
+{
+  if (context)
+    g_markup_parse_context_get_position (context, line_number, char_number);
+  else
+    *line_number = *char_number = 0;
 }
 
 static void
@@ -557,8 +798,7 @@ start_element_handler  (GMarkupParseContext *context,
     {
       gint line_number, char_number;
 
-      g_markup_parse_context_get_position (context,
-					   &line_number, &char_number);
+      get_position (context, &line_number, &char_number);
 
       g_set_error (error,
 		   G_MARKUP_ERROR,
@@ -591,17 +831,40 @@ end_element_handler    (GMarkupParseContext *context G_GNUC_UNUSED,
 			GError             **error G_GNUC_UNUSED)
 {
   markup_data_close_tag (user_data);
+  markup_data_flush_paragraphs (user_data, FALSE);
 }
 
 static void
-text_handler           (GMarkupParseContext *context G_GNUC_UNUSED,
-			const gchar         *text,
-			gsize                text_len,
-			gpointer             user_data,
-			GError             **error G_GNUC_UNUSED)
+markup_data_add_accel_underline (MarkupData *md,
+				 gsize       start_index,
+				 gsize       end_index)
 {
-  MarkupData *md = user_data;
+  VogueAttribute *attr;
+
+  if (md->accel_attrs->len > 0)
+    {
+      attr = g_ptr_array_index (md->accel_attrs, md->accel_attrs->len - 1);
+
+      /* Merge adjacent underlines, as vogue_attr_list_change() would */
+      if (attr->end_index == start_index)
+	{
+	  attr->end_index = end_index;
+	  return;
+	}
+    }
+
+  attr = vogue_attr_underline_new (PANGO_UNDERLINE_LOW);
+  attr->start_index = start_index;
+  attr->end_index = end_index;
+
+  g_ptr_array_add (md->accel_attrs, attr);
+}
 
+static void
+markup_data_append_text (MarkupData *md,
+			 const char *text,
+			 gsize       text_len)
+{
   if (md->accel_marker == 0)
     {
       /* Just append all the text */
@@ -625,63 +888,112 @@ text_handler           (GMarkupParseContext *context G_GNUC_UNUSED,
       p = text;
       end = text + text_len;
 
-      while (p != end)
+      if (md->accel_marker < 0x80)
 	{
-	  gunichar c;
-
-	  c = g_utf8_get_char (p);
+	  /* An ASCII marker can't be part of another character,
+	   * so we can jump from one marker to the next.
+	   */
+	  const gchar *marker;
 
-	  if (range_end)
+	  while ((marker = memchr (p, md->accel_marker, end - p)) != NULL)
 	    {
-	      if (c == md->accel_marker)
+	      p = marker + 1;
+
+	      if (p == end)
+		{
+		  range_end = marker;
+		  break;
+		}
+
+	      if (*p == (gchar) md->accel_marker)
 		{
-		  /* escaped accel marker; move range_end
-		   * past the accel marker that came before,
-		   * append the whole thing
+		  /* escaped accel marker; append up to and including
+		   * the first one, skip the second one
 		   */
-		  range_end = g_utf8_next_char (range_end);
 		  g_string_append_len (md->text,
 				       range_start,
-				       range_end - range_start);
-		  md->index += range_end - range_start;
+				       p - range_start);
+		  md->index += p - range_start;
 
-		  /* set next range_start, skipping accel marker */
-		  range_start = g_utf8_next_char (p);
+		  range_start = p + 1;
+		  p++;
 		}
 	      else
 		{
-		  /* Don't append the accel marker (leave range_end
-		   * alone); set the accel char to c; record location for
-		   * underline attribute
-		   */
 		  if (md->accel_char == 0)
-		    md->accel_char = c;
+		    md->accel_char = g_utf8_get_char (p);
 
 		  g_string_append_len (md->text,
 				       range_start,
-				       range_end - range_start);
-		  md->index += range_end - range_start;
+				       marker - range_start);
+		  md->index += marker - range_start;
 
-		  /* The underline should go underneath the char
-		   * we're setting as the next range_start
-		   */
 		  uline_index = md->index;
 		  uline_len = g_utf8_next_char (p) - p;
 
-		  /* set next range_start to include this char */
 		  range_start = p;
+		  p = g_utf8_next_char (p);
 		}
-
-	      /* reset range_end */
-	      range_end = NULL;
-	    }
-	  else if (c == md->accel_marker)
-	    {
-	      range_end = p;
 	    }
-
-	  p = g_utf8_next_char (p);
 	}
+      else
+	while (p != end)
+	  {
+	    gunichar c;
+
+	    c = g_utf8_get_char (p);
+
+	    if (range_end)
+	      {
+		if (c == md->accel_marker)
+		  {
+		    /* escaped accel marker; move range_end
+		     * past the accel marker that came before,
+		     * append the whole thing
+		     */
+		    range_end = g_utf8_next_char (range_end);
+		    g_string_append_len (md->text,
+					 range_start,
+					 range_end - range_start);
+		    md->index += range_end - range_start;
+
+		    /* set next range_start, skipping accel marker */
+		    range_start = g_utf8_next_char (p);
+		  }
+		else
+		  {
+		    /* Don't append the accel marker (leave range_end
+		     * alone); set the accel char to c; record location for
+		     * underline attribute
+		     */
+		    if (md->accel_char == 0)
+		      md->accel_char = c;
+
+		    g_string_append_len (md->text,
+					 range_start,
+					 range_end - range_start);
+		    md->index += range_end - range_start;
+
+		    /* The underline should go underneath the char
+		     * we're setting as the next range_start
+		     */
+		    uline_index = md->index;
+		    uline_len = g_utf8_next_char (p) - p;
+
+		    /* set next range_start to include this char */
+		    range_start = p;
+		  }
+
+		/* reset range_end */
+		range_end = NULL;
+	      }
+	    else if (c == md->accel_marker)
+	      {
+		range_end = p;
+	      }
+
+	    p = g_utf8_next_char (p);
+	  }
 
       if (range_end)
 	{
@@ -698,21 +1010,25 @@ text_handler           (GMarkupParseContext *context G_GNUC_UNUSED,
 	  md->index += end - range_start;
 	}
 
-      if (md->attr_list != NULL && uline_index >= 0)
+      if (md->want_attr_list && uline_index >= 0)
 	{
 	  /* Add the underline indicating the accelerator */
-	  VogueAttribute *attr;
-
-	  attr = vogue_attr_underline_new (PANGO_UNDERLINE_LOW);
-
-	  attr->start_index = uline_index;
-	  attr->end_index = uline_index + uline_len;
-
-	  vogue_attr_list_change (md->attr_list, attr);
+	  markup_data_add_accel_underline (md, uline_index, uline_index + uline_len);
 	}
     }
 }
 
+static void
+text_handler           (GMarkupParseContext *context G_GNUC_UNUSED,
+			const gchar         *text,
+			gsize                text_len,
+			gpointer             user_data,
+			GError             **error G_GNUC_UNUSED)
+{
+  markup_data_append_text (user_data, text, text_len);
+  markup_data_flush_paragraphs (user_data, FALSE);
+}
+
 static gboolean
 xml_isspace (char c)
 {
@@ -727,20 +1043,103 @@ static const GMarkupParser vogue_markup_parser = {
   NULL
 };
 
+static MarkupData *
+markup_data_new (char     accel_marker,
+		 gboolean want_attr_list,
+		 gsize    text_size)
+{
+  MarkupData *md;
+
+  md = g_slice_new (MarkupData);
+
+  /* Don't bother collecting attributes if they weren't
+   * requested; might be useful e.g. if you just want to
+   * validate some markup.
+   */
+  md->want_attr_list = want_attr_list;
+
+  md->text = g_string_sized_new (text_size);
+
+  md->accel_marker = accel_marker;
+  md->accel_char = 0;
+
+  md->index = 0;
+  md->tag_stack = NULL;
+  md->to_apply = g_ptr_array_new ();
+  md->accel_attrs = g_ptr_array_new ();
+
+  md->paragraph_func = NULL;
+  md->paragraph_data = NULL;
+  md->paragraph_destroy = NULL;
+  md->text_start = 0;
+  md->paragraph_start = 0;
+  md->scan_index = 0;
+
+  return md;
+}
+
 static void
 destroy_markup_data (MarkupData *md)
 {
   g_slist_free_full (md->tag_stack, (GDestroyNotify) open_tag_free);
-  g_slist_free_full (md->to_apply, (GDestroyNotify) vogue_attribute_destroy);
+  g_ptr_array_foreach (md->to_apply, (GFunc) vogue_attribute_destroy, NULL);
+  g_ptr_array_free (md->to_apply, TRUE);
+  g_ptr_array_foreach (md->accel_attrs, (GFunc) vogue_attribute_destroy, NULL);
+  g_ptr_array_free (md->accel_attrs, TRUE);
   if (md->text)
       g_string_free (md->text, TRUE);
 
-  if (md->attr_list)
-    vogue_attr_list_unref (md->attr_list);
+  if (md->paragraph_destroy)
+    md->paragraph_destroy (md->paragraph_data);
 
   g_slice_free (MarkupData, md);
 }
 
+/* Hands out the results once the markup has been parsed */
+static void
+markup_data_finish (MarkupData     *md,
+		    VogueAttrList **attr_list,
+		    char          **text,
+		    gunichar       *accel_char)
+{
+  g_assert (md->tag_stack == NULL);
+
+  if (attr_list)
+    {
+      VogueAttribute **attrs;
+      guint n_attrs, i;
+
+      /* The accelerator underlines go first. The to_apply array has
+       * the most-recently-closed tags last; we want to apply the
+       * least-recently-closed tag last. Inserting the attributes in
+       * this order one by one is the same as sorting them stably
+       * by start index, which vogue_attr_list_new_from_sorted() does.
+       */
+      n_attrs = md->accel_attrs->len + md->to_apply->len;
+      attrs = g_new (VogueAttribute *, n_attrs);
+
+      for (i = 0; i < md->accel_attrs->len; i++)
+	attrs[i] = g_ptr_array_index (md->accel_attrs, i);
+      for (i = 0; i < md->to_apply->len; i++)
+	attrs[md->accel_attrs->len + i] = g_ptr_array_index (md->to_apply, md->to_apply->len - 1 - i);
+
+      *attr_list = vogue_attr_list_new_from_sorted (attrs, n_attrs, TRUE);
+      g_free (attrs);
+
+      g_ptr_array_set_size (md->accel_attrs, 0);
+      g_ptr_array_set_size (md->to_apply, 0);
+    }
+
+  if (text)
+    {
+      *text = g_string_free (md->text, FALSE);
+      md->text = NULL;
+    }
+
+  if (accel_char)
+    *accel_char = md->accel_char;
+}
+
 static GMarkupParseContext *
 vogue_markup_parser_new_internal (char       accel_marker,
 				  GError   **error,
@@ -749,25 +1148,7 @@ vogue_markup_parser_new_internal (char       accel_marker,
   MarkupData *md;
   GMarkupParseContext *context;
 
-  md = g_slice_new (MarkupData);
-
-  /* Don't bother creating these if they weren't requested;
-   * might be useful e.g. if you just want to validate
-   * some markup.
-   */
-  if (want_attr_list)
-    md->attr_list = vogue_attr_list_new ();
-  else
-    md->attr_list = NULL;
-
-  md->text = g_string_new (NULL);
-
-  md->accel_marker = accel_marker;
-  md->accel_char = 0;
-
-  md->index = 0;
-  md->tag_stack = NULL;
-  md->to_apply = NULL;
+  md = markup_data_new (accel_marker, want_attr_list, 0);
 
   context = g_markup_parse_context_new (&vogue_markup_parser,
 					0, md,
@@ -786,62 +1167,406 @@ vogue_markup_parser_new_internal (char       accel_marker,
   return NULL;
 }
 
-/**
- * vogue_parse_markup:
- * @markup_text: markup to parse (see <link linkend="VogueMarkupFormat">markup format</link>)
- * @length: length of @markup_text, or -1 if nul-terminated
- * @accel_marker: character that precedes an accelerator, or 0 for none
- * @attr_list: (out) (allow-none): address of return location for a #VogueAttrList, or %NULL
- * @text: (out) (allow-none): address of return location for text with tags stripped, or %NULL
- * @accel_char: (out) (allow-none): address of return location for accelerator char, or %NULL
- * @error: address of return location for errors, or %NULL
- *
- * Parses marked-up text (see
- * <link linkend="VogueMarkupFormat">markup format</link>) to create
- * a plain-text string and an attribute list.
- *
- * If @accel_marker is nonzero, the given character will mark the
- * character following it as an accelerator. For example, @accel_marker
- * might be an ampersand or underscore. All characters marked
- * as an accelerator will receive a %PANGO_UNDERLINE_LOW attribute,
- * and the first character so marked will be returned in @accel_char.
- * Two @accel_marker characters following each other produce a single
- * literal @accel_marker character.
- *
- * To parse a stream of vogue markup incrementally, use vogue_markup_parser_new().
- *
- * If any error happens, none of the output arguments are touched except
- * for @error.
- *
- * Return value: %FALSE if @error is set, otherwise %TRUE
- **/
-gboolean
-vogue_parse_markup (const char                 *markup_text,
-		    int                         length,
-		    gunichar                    accel_marker,
-		    VogueAttrList             **attr_list,
-		    char                      **text,
-		    gunichar                   *accel_char,
-		    GError                    **error)
+/* What follows is a scanner for the subset of XML that Vogue markup
+ * uses. It produces the same text and attributes as going through
+ * GMarkupParseContext, but without copying every piece of text and
+ * dispatching callbacks for it. It gives up on anything it does not
+ * handle in exactly the same way, including all errors; the markup is
+ * then parsed again with GMarkup, which produces the usual result or
+ * error message.
+ */
+
+typedef struct
 {
-  GMarkupParseContext *context = NULL;
-  gboolean ret = FALSE;
-  const char *p;
-  const char *end;
+  const char *name;
+  gsize len;
+} ScanElement;
 
-  g_return_val_if_fail (markup_text != NULL, FALSE);
+static inline gboolean
+scan_is_name_start_char (char c)
+{
+  return g_ascii_isalpha (c) || c == '_' || c == ':';
+}
 
-  if (length < 0)
-    length = strlen (markup_text);
+static inline gboolean
+scan_is_name_char (char c)
+{
+  return g_ascii_isalnum (c) || c == '.' || c == '-' || c == '_' || c == ':';
+}
 
-  p = markup_text;
-  end = markup_text + length;
-  while (p != end && xml_isspace (*p))
-    ++p;
+/* Returns the end of the name at @p, or %NULL if there is none */
+static const char *
+scan_name (const char *p,
+	   const char *end)
+{
+  if (p == end || !scan_is_name_start_char (*p))
+    return NULL;
 
-  context = vogue_markup_parser_new_internal (accel_marker,
-                                              error,
-                                              (attr_list != NULL));
+  for (p++; p != end && scan_is_name_char (*p); p++)
+    ;
+
+  return p;
+}
+
+static const char *
+scan_skip_spaces (const char *p,
+		  const char *end)
+{
+  while (p != end && xml_isspace (*p))
+    p++;
+
+  return p;
+}
+
+/* Appends the text between @p and @end to @out, replacing entities.
+ * Returns %FALSE for entities that we leave to GMarkup.
+ */
+static gboolean
+scan_unescape (const char *p,
+	       const char *end,
+	       GString    *out)
+{
+  const char *amp;
+
+  while ((amp = memchr (p, '&', end - p)) != NULL)
+    {
+      const char *semi;
+      gsize len;
+
+      g_string_append_len (out, p, amp - p);
+      p = amp + 1;
+
+      /* The longest entity we handle is "#" and nine digits */
+      semi = memchr (p, ';', MIN (end - p, 11));
+      if (semi == NULL)
+	return FALSE;
+      len = semi - p;
+
+      if (len == 2 && memcmp (p, "lt", 2) == 0)
+	g_string_append_c (out, '<');
+      else if (len == 2 && memcmp (p, "gt", 2) == 0)
+	g_string_append_c (out, '>');
+      else if (len == 3 && memcmp (p, "amp", 3) == 0)
+	g_string_append_c (out, '&');
+      else if (len == 4 && memcmp (p, "quot", 4) == 0)
+	g_string_append_c (out, '"');
+      else if (len == 4 && memcmp (p, "apos", 4) == 0)
+	g_string_append_c (out, '\'');
+      else if (len > 1 && *p == '#')
+	{
+	  const char *q = p + 1;
+	  gunichar c = 0;
+	  int base = 10;
+
+	  if (*q == 'x')
+	    {
+	      base = 16;
+	      q++;
+	    }
+
+	  if (q == semi)
+	    return FALSE;
+
+	  for (; q != semi; q++)
+	    {
+	      int digit = base == 16 ? g_ascii_xdigit_value (*q) : g_ascii_digit_value (*q);
+
+	      if (digit < 0)
+		return FALSE;
+
+	      c = c * base + digit;
+	    }
+
+	  /* The characters that GMarkup allows */
+	  if (!((0 < c && c <= 0xd7ff) ||
+		(0xe000 <= c && c <= 0xfffd) ||
+		(0x10000 <= c && c <= 0x10ffff)))
+	    return FALSE;
+
+	  g_string_append_unichar (out, c);
+	}
+      else
+	return FALSE;
+
+      p = semi + 1;
+    }
+
+  g_string_append_len (out, p, end - p);
+
+  return TRUE;
+}
+
+/* Parses a start tag after the '<', and returns the position after
+ * its closing '>', or %NULL. The element name, followed by the names
+ * and values of its attributes, are stored nul-terminated in @strings,
+ * and their offsets in @offsets.
+ */
+static const char *
+scan_start_tag (const char *p,
+		const char *end,
+		GString    *strings,
+		GArray     *offsets,
+		gboolean   *empty)
+{
+  const char *name_end;
+
+  name_end = scan_name (p, end);
+  if (name_end == NULL)
+    return NULL;
+
+  g_string_truncate (strings, 0);
+  g_string_append_len (strings, p, name_end - p);
+  g_string_append_c (strings, '\0');
+  g_array_set_size (offsets, 0);
+
+  p = name_end;
+  while (TRUE)
+    {
+      const char *q;
+      const char *value;
+      const char *value_end;
+      gboolean escaped = FALSE;
+      gsize offset;
+
+      q = scan_skip_spaces (p, end);
+      if (q == end)
+	return NULL;
+
+      if (*q == '>')
+	{
+	  *empty = FALSE;
+	  return q + 1;
+	}
+
+      if (*q == '/')
+	{
+	  if (q + 1 == end || q[1] != '>')
+	    return NULL;
+
+	  *empty = TRUE;
+	  return q + 2;
+	}
+
+      /* Attributes need to be separated by whitespace */
+      if (q == p)
+	return NULL;
+
+      name_end = scan_name (q, end);
+      if (name_end == NULL)
+	return NULL;
+
+      offset = strings->len;
+      g_array_append_val (offsets, offset);
+      g_string_append_len (strings, q, name_end - q);
+      g_string_append_c (strings, '\0');
+
+      q = scan_skip_spaces (name_end, end);
+      if (q == end || *q != '=')
+	return NULL;
+
+      q = scan_skip_spaces (q + 1, end);
+      if (q == end || (*q != '"' && *q != '\''))
+	return NULL;
+
+      value = q + 1;
+      value_end = memchr (value, *q, end - value);
+      if (value_end == NULL)
+	return NULL;
+
+      /* GMarkup normalizes whitespace in attribute values */
+      for (q = value; q != value_end; q++)
+	{
+	  if (*q == '<' || *q == '\t' || *q == '\n')
+	    return NULL;
+	  else if (*q == '&')
+	    escaped = TRUE;
+	}
+
+      offset = strings->len;
+      g_array_append_val (offsets, offset);
+      if (escaped)
+	{
+	  if (!scan_unescape (value, value_end, strings))
+	    return NULL;
+	}
+      else
+	g_string_append_len (strings, value, value_end - value);
+      g_string_append_c (strings, '\0');
+
+      p = value_end + 1;
+    }
+}
+
+static gboolean
+scan_markup (MarkupData *md,
+	     const char *markup,
+	     gsize       length)
+{
+  static const char *no_attributes[] = { NULL };
+  const char *p = markup;
+  const char *end = markup + length;
+  GArray *elements;
+  GString *strings;
+  GArray *offsets;
+  GPtrArray *names;
+  GPtrArray *values;
+  gboolean ret = FALSE;
+
+  /* GMarkup normalizes line ends */
+  if (memchr (markup, '\r', length) != NULL ||
+      !g_utf8_validate (markup, length, NULL))
+    return FALSE;
+
+  elements = g_array_new (FALSE, FALSE, sizeof (ScanElement));
+  strings = g_string_new (NULL);
+  offsets = g_array_new (FALSE, FALSE, sizeof (gsize));
+  names = g_ptr_array_new ();
+  values = g_ptr_array_new ();
+
+  start_element_handler (NULL, "markup", no_attributes, no_attributes, md, NULL);
+
+  while (p != end)
+    {
+      const char *lt;
+      const char *text_end;
+
+      lt = memchr (p, '<', end - p);
+      text_end = lt ? lt : end;
+
+      if (text_end != p)
+	{
+	  if (memchr (p, '&', text_end - p) != NULL)
+	    {
+	      g_string_truncate (strings, 0);
+	      if (!scan_unescape (p, text_end, strings))
+		goto out;
+
+	      markup_data_append_text (md, strings->str, strings->len);
+	    }
+	  else
+	    markup_data_append_text (md, p, text_end - p);
+	}
+
+      if (lt == NULL)
+	break;
+
+      p = lt + 1;
+
+      if (p != end && *p == '/')
+	{
+	  const char *name = p + 1;
+	  const char *name_end;
+	  ScanElement *element;
+
+	  name_end = scan_name (name, end);
+	  if (name_end == NULL || elements->len == 0)
+	    goto out;
+
+	  element = &g_array_index (elements, ScanElement, elements->len - 1);
+	  if (element->len != (gsize) (name_end - name) ||
+	      memcmp (element->name, name, element->len) != 0)
+	    goto out;
+
+	  p = scan_skip_spaces (name_end, end);
+	  if (p == end || *p != '>')
+	    goto out;
+	  p++;
+
+	  g_array_set_size (elements, elements->len - 1);
+	  markup_data_close_tag (md);
+	}
+      else
+	{
+	  ScanElement element;
+	  GError *error = NULL;
+	  gboolean empty;
+	  guint i;
+
+	  element.name = p;
+	  p = scan_start_tag (p, end, strings, offsets, &empty);
+	  if (p == NULL)
+	    goto out;
+	  element.len = strlen (strings->str);
+
+	  g_ptr_array_set_size (names, 0);
+	  g_ptr_array_set_size (values, 0);
+	  for (i = 0; i < offsets->len; i += 2)
+	    {
+	      g_ptr_array_add (names, strings->str + g_array_index (offsets, gsize, i));
+	      g_ptr_array_add (values, strings->str + g_array_index (offsets, gsize, i + 1));
+	    }
+	  g_ptr_array_add (names, NULL);
+	  g_ptr_array_add (values, NULL);
+
+	  g_array_append_val (elements, element);
+
+	  start_element_handler (NULL, strings->str,
+				 (const char **) names->pdata,
+				 (const char **) values->pdata,
+				 md, &error);
+	  if (error)
+	    {
+	      g_error_free (error);
+	      goto out;
+	    }
+
+	  if (empty)
+	    {
+	      g_array_set_size (elements, elements->len - 1);
+	      markup_data_close_tag (md);
+	    }
+	}
+    }
+
+  if (elements->len != 0)
+    goto out;
+
+  markup_data_close_tag (md);
+  ret = TRUE;
+
+ out:
+  g_array_free (elements, TRUE);
+  g_string_free (strings, TRUE);
+  g_array_free (offsets, TRUE);
+  g_ptr_array_free (names, TRUE);
+  g_ptr_array_free (values, TRUE);
+
+  return ret;
+}
+
+static gboolean
+parse_markup_uncached (const char     *markup_text,
+		       int             length,
+		       gunichar        accel_marker,
+		       VogueAttrList **attr_list,
+		       char          **text,
+		       gunichar       *accel_char,
+		       GError        **error)
+{
+  GMarkupParseContext *context = NULL;
+  MarkupData *md;
+  gboolean ret = FALSE;
+  const char *p;
+  const char *end;
+
+  p = markup_text;
+  end = markup_text + length;
+  while (p != end && xml_isspace (*p))
+    ++p;
+
+  /* The text is never longer than the markup */
+  md = markup_data_new (accel_marker, (attr_list != NULL), length);
+  ret = scan_markup (md, markup_text, length);
+  if (ret)
+    markup_data_finish (md, attr_list, text, accel_char);
+  destroy_markup_data (md);
+
+  if (ret)
+    return TRUE;
+
+  context = vogue_markup_parser_new_internal (accel_marker,
+                                              error,
+                                              (attr_list != NULL));
   if (context == NULL)
     goto out;
 
@@ -866,6 +1591,324 @@ vogue_parse_markup (const char                 *markup_text,
   return ret;
 }
 
+/* Process-wide cache of parse results, most recently used first.
+ * The output of vogue_parse_markup() only depends on its input, so
+ * entries never go stale; when the cache is full, the least recently
+ * used entry is dropped. Callers get copies of the cached attribute
+ * list, which share its storage until they are modified.
+ */
+#define MARKUP_CACHE_DEFAULT_SIZE 128
+
+/* Longer markup is unlikely to be parsed again, and would pin
+ * a lot of memory.
+ */
+#define MARKUP_CACHE_MAX_LENGTH 4096
+
+typedef struct {
+  GList link;
+  guint hash;
+  char *markup;
+  gsize length;
+  gunichar accel_marker;
+  char *text;
+  VogueAttrList *attr_list;
+  gunichar accel_char;
+} MarkupCacheEntry;
+
+G_LOCK_DEFINE_STATIC (markup_cache);
+static GHashTable *markup_cache;
+static GQueue markup_cache_lru = G_QUEUE_INIT;
+static gint markup_cache_size = MARKUP_CACHE_DEFAULT_SIZE; /* atomic */
+
+static gint markup_cache_hits;       /* atomic */
+static gint markup_cache_misses;     /* atomic */
+static gint markup_cache_evictions;  /* atomic */
+
+static guint
+markup_cache_hash (const char *markup,
+                   gsize       length,
+                   gunichar    accel_marker)
+{
+  guint hash = 5381 + accel_marker;
+  gsize i;
+
+  for (i = 0; i < length; i++)
+    hash = hash * 33 + (guchar) markup[i];
+
+  return hash;
+}
+
+static guint
+markup_cache_entry_hash (gconstpointer key)
+{
+  return ((const MarkupCacheEntry *) key)->hash;
+}
+
+static gboolean
+markup_cache_entry_equal (gconstpointer a,
+                          gconstpointer b)
+{
+  const MarkupCacheEntry *ea = a;
+  const MarkupCacheEntry *eb = b;
+
+  return ea->hash == eb->hash &&
+         ea->length == eb->length &&
+         ea->accel_marker == eb->accel_marker &&
+         memcmp (ea->markup, eb->markup, ea->length) == 0;
+}
+
+static void
+markup_cache_entry_free (MarkupCacheEntry *entry)
+{
+  g_free (entry->markup);
+  g_free (entry->text);
+  vogue_attr_list_unref (entry->attr_list);
+  g_slice_free (MarkupCacheEntry, entry);
+}
+
+/* Called with the lock held */
+static void
+markup_cache_trim (guint size)
+{
+  while (markup_cache_lru.length > size)
+    {
+      MarkupCacheEntry *entry = g_queue_peek_tail (&markup_cache_lru);
+
+      g_queue_unlink (&markup_cache_lru, &entry->link);
+      g_hash_table_remove (markup_cache, entry);
+      markup_cache_entry_free (entry);
+      g_atomic_int_inc (&markup_cache_evictions);
+    }
+}
+
+static gboolean
+markup_cache_lookup (const char     *markup_text,
+                     gsize           length,
+                     gunichar        accel_marker,
+                     guint           hash,
+                     VogueAttrList **attr_list,
+                     char          **text,
+                     gunichar       *accel_char)
+{
+  MarkupCacheEntry key;
+  MarkupCacheEntry *entry = NULL;
+
+  key.hash = hash;
+  key.markup = (char *) markup_text;
+  key.length = length;
+  key.accel_marker = accel_marker;
+
+  G_LOCK (markup_cache);
+
+  if (markup_cache)
+    entry = g_hash_table_lookup (markup_cache, &key);
+
+  if (entry)
+    {
+      g_queue_unlink (&markup_cache_lru, &entry->link);
+      g_queue_push_head_link (&markup_cache_lru, &entry->link);
+
+      if (attr_list)
+        *attr_list = vogue_attr_list_copy (entry->attr_list);
+      if (text)
+        *text = g_strdup (entry->text);
+      if (accel_char)
+        *accel_char = entry->accel_char;
+    }
+
+  G_UNLOCK (markup_cache);
+
+  return entry != NULL;
+}
+
+static void
+markup_cache_insert (const char    *markup_text,
+                     gsize          length,
+                     gunichar       accel_marker,
+                     guint          hash,
+                     VogueAttrList *attr_list,
+                     const char    *text,
+                     gunichar       accel_char)
+{
+  MarkupCacheEntry *entry;
+
+  entry = g_slice_new (MarkupCacheEntry);
+  entry->link.data = entry;
+  entry->link.prev = NULL;
+  entry->link.next = NULL;
+  entry->hash = hash;
+  entry->markup = g_malloc (length + 1);
+  memcpy (entry->markup, markup_text, length);
+  entry->markup[length] = '\0';
+  entry->length = length;
+  entry->accel_marker = accel_marker;
+  entry->text = g_strdup (text);
+  entry->attr_list = vogue_attr_list_copy (attr_list);
+  entry->accel_char = accel_char;
+
+  G_LOCK (markup_cache);
+
+  if (markup_cache_size == 0)
+    goto out;
+
+  if (!markup_cache)
+    markup_cache = g_hash_table_new (markup_cache_entry_hash,
+                                     markup_cache_entry_equal);
+
+  /* Another thread may have parsed the same markup meanwhile */
+  if (g_hash_table_contains (markup_cache, entry))
+    goto out;
+
+  g_hash_table_add (markup_cache, entry);
+  g_queue_push_head_link (&markup_cache_lru, &entry->link);
+  markup_cache_trim (markup_cache_size);
+  entry = NULL;
+
+ out:
+  G_UNLOCK (markup_cache);
+
+  if (entry)
+    markup_cache_entry_free (entry);
+}
+
+/**
+ * vogue_markup_cache_set_max_entries:
+ * @max_entries: the number of parse results to keep, or 0
+ *
+ * Sets how many parse results vogue_parse_markup() keeps to reuse
+ * when it is given the same markup and accelerator marker again.
+ * Markup longer than a few kilobytes is never cached.
+ *
+ * Setting @max_entries to 0 disables the cache and frees all
+ * entries. The default is 128.
+ *
+ * Since: 1.46
+ */
+void
+vogue_markup_cache_set_max_entries (guint max_entries)
+{
+  G_LOCK (markup_cache);
+
+  g_atomic_int_set (&markup_cache_size, max_entries);
+  if (markup_cache)
+    markup_cache_trim (max_entries);
+
+  G_UNLOCK (markup_cache);
+}
+
+/**
+ * vogue_markup_cache_get_stats:
+ * @hits: (out) (optional): return location for the number of cache hits
+ * @misses: (out) (optional): return location for the number of cache misses
+ * @evictions: (out) (optional): return location for the number of evicted entries
+ *
+ * Gets the counters of the cache used by vogue_parse_markup().
+ * Markup that is too long to be cached is not counted.
+ *
+ * Since: 1.46
+ */
+void
+vogue_markup_cache_get_stats (guint *hits,
+                              guint *misses,
+                              guint *evictions)
+{
+  if (hits)
+    *hits = g_atomic_int_get (&markup_cache_hits);
+  if (misses)
+    *misses = g_atomic_int_get (&markup_cache_misses);
+  if (evictions)
+    *evictions = g_atomic_int_get (&markup_cache_evictions);
+}
+
+/**
+ * vogue_parse_markup:
+ * @markup_text: markup to parse (see <link linkend="VogueMarkupFormat">markup format</link>)
+ * @length: length of @markup_text, or -1 if nul-terminated
+ * @accel_marker: character that precedes an accelerator, or 0 for none
+ * @attr_list: (out) (allow-none): address of return location for a #VogueAttrList, or %NULL
+ * @text: (out) (allow-none): address of return location for text with tags stripped, or %NULL
+ * @accel_char: (out) (allow-none): address of return location for accelerator char, or %NULL
+ * @error: address of return location for errors, or %NULL
+ *
+ * Parses marked-up text (see
+ * <link linkend="VogueMarkupFormat">markup format</link>) to create
+ * a plain-text string and an attribute list.
+ *
+ * If @accel_marker is nonzero, the given character will mark the
+ * character following it as an accelerator. For example, @accel_marker
+ * might be an ampersand or underscore. All characters marked
+ * as an accelerator will receive a %PANGO_UNDERLINE_LOW attribute,
+ * and the first character so marked will be returned in @accel_char.
+ * Two @accel_marker characters following each other produce a single
+ * literal @accel_marker character.
+ *
+ * To parse a stream of vogue markup incrementally, use vogue_markup_parser_new().
+ *
+ * Results are cached, so parsing the same markup again is cheap;
+ * see vogue_markup_cache_set_max_entries().
+ *
+ * If any error happens, none of the output arguments are touched except
+ * for @error.
+ *
+ * Return value: %FALSE if @error is set, otherwise %TRUE
+ **/
+gboolean
+vogue_parse_markup (const char                 *markup_text,
+		    int                         length,
+		    gunichar                    accel_marker,
+		    VogueAttrList             **attr_list,
+		    char                      **text,
+		    gunichar                   *accel_char,
+		    GError                    **error)
+{
+  VogueAttrList *list;
+  char *plain;
+  gunichar accel;
+  guint hash;
+
+  g_return_val_if_fail (markup_text != NULL, FALSE);
+
+  if (length < 0)
+    length = strlen (markup_text);
+
+  if (length > MARKUP_CACHE_MAX_LENGTH ||
+      g_atomic_int_get (&markup_cache_size) == 0)
+    return parse_markup_uncached (markup_text, length, accel_marker,
+                                  attr_list, text, accel_char, error);
+
+  hash = markup_cache_hash (markup_text, length, accel_marker);
+  if (markup_cache_lookup (markup_text, length, accel_marker, hash,
+                           attr_list, text, accel_char))
+    {
+      g_atomic_int_inc (&markup_cache_hits);
+      return TRUE;
+    }
+
+  g_atomic_int_inc (&markup_cache_misses);
+
+  if (!parse_markup_uncached (markup_text, length, accel_marker,
+                              &list, &plain, &accel, error))
+    return FALSE;
+
+  markup_cache_insert (markup_text, length, accel_marker, hash,
+                       list, plain, accel);
+
+  if (attr_list)
+    *attr_list = list;
+  else
+    vogue_attr_list_unref (list);
+
+  if (text)
+    *text = plain;
+  else
+    g_free (plain);
+
+  if (accel_char)
+    *accel_char = accel;
+
+  return TRUE;
+}
+
 /**
  * vogue_markup_parser_new:
  * @accel_marker: character that precedes an accelerator, or 0 for none
@@ -909,6 +1952,61 @@ vogue_markup_parser_new (gunichar               accel_marker)
   return context;
 }
 
+/**
+ * vogue_markup_parser_new_streaming:
+ * @accel_marker: character that precedes an accelerator, or 0 for none
+ * @func: function to call for each completed paragraph
+ * @user_data: data to pass to @func
+ * @destroy: (nullable): function to free @user_data when the parser
+ *   is freed, or %NULL
+ *
+ * Like vogue_markup_parser_new(), but instead of collecting all the
+ * text and attributes until vogue_markup_parser_finish(), the parser
+ * calls @func with each paragraph as soon as its text is complete.
+ * Tags that are still open at that point apply up to the end of the
+ * paragraph. This way, the start of a long document can be laid out
+ * while the rest is still being parsed, even if all of it is inside
+ * one tag.
+ *
+ * Paragraphs end after a newline, carriage return, carriage
+ * return-newline pair or Unicode paragraph separator, and include the
+ * delimiter, so that putting them together gives the same text as
+ * vogue_parse_markup(). The indices of the attributes that are passed
+ * to @func are relative to the start of the paragraph; attributes
+ * that span several paragraphs are split.
+ *
+ * vogue_markup_parser_finish() emits the last paragraph, and returns
+ * an empty text and attribute list. Paragraphs that were emitted
+ * before an error are not taken back.
+ *
+ * Return value: (transfer none): a #GMarkupParseContext that should be
+ * destroyed with g_markup_parse_context_free().
+ *
+ * Since: 1.46
+ **/
+GMarkupParseContext *
+vogue_markup_parser_new_streaming (gunichar                 accel_marker,
+                                   VogueMarkupParagraphFunc func,
+                                   gpointer                 user_data,
+                                   GDestroyNotify           destroy)
+{
+  GMarkupParseContext *context;
+  MarkupData *md;
+
+  g_return_val_if_fail (func != NULL, NULL);
+
+  context = vogue_markup_parser_new (accel_marker);
+  if (context == NULL)
+    return NULL;
+
+  md = g_markup_parse_context_get_user_data (context);
+  md->paragraph_func = func;
+  md->paragraph_data = user_data;
+  md->paragraph_destroy = destroy;
+
+  return context;
+}
+
 /**
  * vogue_markup_parser_finish:
  * @context: A valid parse context that was returned from vogue_markup_parser_new()
@@ -935,7 +2033,6 @@ vogue_markup_parser_finish (GMarkupParseContext   *context,
 {
   gboolean ret = FALSE;
   MarkupData *md = g_markup_parse_context_get_user_data (context);
-  GSList *tmp_list;
 
   if (!g_markup_parse_context_parse (context,
                                      "</markup>",
@@ -946,41 +2043,8 @@ vogue_markup_parser_finish (GMarkupParseContext   *context,
   if (!g_markup_parse_context_end_parse (context, error))
     goto out;
 
-  if (md->attr_list)
-    {
-      /* The apply list has the most-recently-closed tags first;
-       * we want to apply the least-recently-closed tag last.
-       */
-      tmp_list = md->to_apply;
-      while (tmp_list != NULL)
-	{
-	  VogueAttribute *attr = tmp_list->data;
-
-	  /* Innermost tags before outermost */
-	  vogue_attr_list_insert (md->attr_list, attr);
-
-	  tmp_list = g_slist_next (tmp_list);
-	}
-      g_slist_free (md->to_apply);
-      md->to_apply = NULL;
-    }
-
-  if (attr_list)
-    {
-      *attr_list = md->attr_list;
-      md->attr_list = NULL;
-    }
-
-  if (text)
-    {
-      *text = g_string_free (md->text, FALSE);
-      md->text = NULL;
-    }
-
-  if (accel_char)
-    *accel_char = md->accel_char;
-
-  g_assert (md->tag_stack == NULL);
+  markup_data_flush_paragraphs (md, TRUE);
+  markup_data_finish (md, attr_list, text, accel_char);
   ret = TRUE;
 
  out:
@@ -995,8 +2059,7 @@ set_bad_attribute (GError             **error,
 {
   gint line_number, char_number;
 
-  g_markup_parse_context_get_position (context,
-				       &line_number, &char_number);
+  get_position (context, &line_number, &char_number);
 
   g_set_error (error,
 	       G_MARKUP_ERROR,
@@ -1341,8 +2404,7 @@ span_parse_func     (MarkupData            *md G_GNUC_UNUSED,
   const char *insert_hyphens = NULL;
   const char *show = NULL;
 
-  g_markup_parse_context_get_position (context,
-				       &line_number, &char_number);
+  get_position (context, &line_number, &char_number);
 
 #define CHECK_DUPLICATE(var) G_STMT_START{                              \
 	  if ((var) != NULL) {                                          \
@@ -252,6 +252,16 @@
  */
 #define PANGO_VERSION_1_44       (G_ENCODE_VERSION (1, 44))
 
+/**
+ * PANGO_VERSION_1_46:
+ *
+ * A macro that evaluates to the 1.46 version of Vogue, in a format
+ * that can be used by the C pre-processor.
+ *
+ * Since: 1.46
+ */
+#define PANGO_VERSION_1_46       (G_ENCODE_VERSION (1, 46))
+
 /* evaluates to the current stable version; for development cycles,
  * this means the next stable target
  */
@@ -657,4 +667,18 @@
 # define PANGO_AVAILABLE_IN_1_44                _PANGO_EXTERN
 #endif
 
+#if PANGO_VERSION_MIN_REQUIRED >= PANGO_VERSION_1_46
+# define PANGO_DEPRECATED_IN_1_46               PANGO_DEPRECATED
+# define PANGO_DEPRECATED_IN_1_46_FOR(f)        PANGO_DEPRECATED_FOR(f)
+#else
+# define PANGO_DEPRECATED_IN_1_46               _PANGO_EXTERN
+# define PANGO_DEPRECATED_IN_1_46_FOR(f)        _PANGO_EXTERN
+#endif
+
+#if PANGO_VERSION_MAX_ALLOWED < PANGO_VERSION_1_46
+# define PANGO_AVAILABLE_IN_1_46                PANGO_UNAVAILABLE(1, 46)
+#else
+# define PANGO_AVAILABLE_IN_1_46                _PANGO_EXTERN
+#endif
+
 #endif /* __PANGO_VERSION_H__ */
@@ -60,16 +60,15 @@ _vogue_cairo_font_private_scaled_font_data_destroy (VogueCairoFontPrivateScaledF
     }
 }
 
-cairo_scaled_font_t *
-_vogue_cairo_font_private_get_scaled_font (VogueCairoFontPrivate *cf_priv)
+static cairo_scaled_font_t *
+_vogue_cairo_font_private_create_scaled_font (VogueCairoFontPrivate *cf_priv)
 {
   cairo_font_face_t *font_face;
+  cairo_scaled_font_t *scaled_font = NULL;
 
-  if (G_LIKELY (cf_priv->scaled_font))
+  if (cf_priv->scaled_font)
     return cf_priv->scaled_font;
 
-  /* need to create it */
-
   if (G_UNLIKELY (cf_priv->data == NULL))
     {
       /* we have tried to create and failed before */
@@ -80,18 +79,17 @@ _vogue_cairo_font_private_get_scaled_font (VogueCairoFontPrivate *cf_priv)
   if (G_UNLIKELY (font_face == NULL))
     goto done;
 
-  cf_priv->scaled_font = cairo_scaled_font_create (font_face,
-						   &cf_priv->data->font_matrix,
-						   &cf_priv->data->ctm,
-						   cf_priv->data->options);
+  scaled_font = cairo_scaled_font_create (font_face,
+					  &cf_priv->data->font_matrix,
+					  &cf_priv->data->ctm,
+					  cf_priv->data->options);
 
   cairo_font_face_destroy (font_face);
 
 done:
 
-  if (G_UNLIKELY (cf_priv->scaled_font == NULL || cairo_scaled_font_status (cf_priv->scaled_font) != CAIRO_STATUS_SUCCESS))
+  if (G_UNLIKELY (scaled_font == NULL || cairo_scaled_font_status (scaled_font) != CAIRO_STATUS_SUCCESS))
     {
-      cairo_scaled_font_t *scaled_font = cf_priv->scaled_font;
       VogueFont *font = PANGO_FONT (cf_priv->cfont);
       static GQuark warned_quark = 0; /* MT-safe */
       if (!warned_quark)
@@ -132,7 +130,28 @@ done:
   _vogue_cairo_font_private_scaled_font_data_destroy (cf_priv->data);
   cf_priv->data = NULL;
 
-  return cf_priv->scaled_font;
+  g_atomic_pointer_set (&cf_priv->scaled_font, scaled_font);
+
+  return scaled_font;
+}
+
+cairo_scaled_font_t *
+_vogue_cairo_font_private_get_scaled_font (VogueCairoFontPrivate *cf_priv)
+{
+  cairo_scaled_font_t *scaled_font;
+
+  scaled_font = g_atomic_pointer_get (&cf_priv->scaled_font);
+  if (G_LIKELY (scaled_font))
+    return scaled_font;
+
+  /* need to create it; fonts may be shaped from several threads,
+   * see vogue_shape_items()
+   */
+  g_mutex_lock (&cf_priv->mutex);
+  scaled_font = _vogue_cairo_font_private_create_scaled_font (cf_priv);
+  g_mutex_unlock (&cf_priv->mutex);
+
+  return scaled_font;
 }
 
 /**
@@ -396,8 +415,9 @@ _vogue_cairo_font_private_get_hex_box_info (VogueCairoFontPrivate *cf_priv)
   if (!cf_priv)
     return NULL;
 
-  if (cf_priv->hbi)
-    return cf_priv->hbi;
+  hbi = g_atomic_pointer_get (&cf_priv->hbi);
+  if (hbi)
+    return hbi;
 
   scaled_font = _vogue_cairo_font_private_get_scaled_font (cf_priv);
   if (G_UNLIKELY (scaled_font == NULL || cairo_scaled_font_status (scaled_font) != CAIRO_STATUS_SUCCESS))
@@ -571,7 +591,13 @@ _vogue_cairo_font_private_get_hex_box_info (VogueCairoFontPrivate *cf_priv)
        hbi->box_descent = HINT_Y (hbi->box_descent);
     }
 
-  cf_priv->hbi = hbi;
+  /* Another thread may have beaten us to it */
+  if (!g_atomic_pointer_compare_and_exchange (&cf_priv->hbi, NULL, hbi))
+    {
+      _vogue_cairo_font_hex_box_info_destroy (hbi);
+      hbi = g_atomic_pointer_get (&cf_priv->hbi);
+    }
+
   return hbi;
 }
 
@@ -635,6 +661,8 @@ _vogue_cairo_font_private_initialize (VogueCairoFontPrivate      *cf_priv,
   cf_priv->hbi = NULL;
   cf_priv->glyph_extents_cache = NULL;
   cf_priv->metrics_by_lang = NULL;
+
+  g_mutex_init (&cf_priv->mutex);
 }
 
 static void
@@ -663,6 +691,8 @@ _vogue_cairo_font_private_finalize (VogueCairoFontPrivate *cf_priv)
   g_slist_foreach (cf_priv->metrics_by_lang, (GFunc)free_metrics_info, NULL);
   g_slist_free (cf_priv->metrics_by_lang);
   cf_priv->metrics_by_lang = NULL;
+
+  g_mutex_clear (&cf_priv->mutex);
 }
 
 gboolean
@@ -773,9 +803,14 @@ _vogue_cairo_font_private_get_glyph_extents_missing (VogueCairoFontPrivate *cf_p
  * The cache is indexed by the lower N bits of the glyph (see
  * GLYPH_CACHE_NUM_ENTRIES).  For scripts with few glyphs,
  * this should provide pretty much instant lookups.
+ *
+ * Entries are read without locking. A writer holds cf_priv->mutex
+ * and keeps @seq odd while it changes the entry, so a reader that
+ * sees @seq odd or changed falls back to the locked path.
  */
 struct _VogueCairoFontGlyphExtentsCacheEntry
 {
+  guint          seq;
   VogueGlyph     glyph;
   int            width;
   VogueRectangle ink_rect;
@@ -786,10 +821,19 @@ _vogue_cairo_font_private_glyph_extents_cache_init (VogueCairoFontPrivate *cf_pr
 {
   cairo_scaled_font_t *scaled_font = _vogue_cairo_font_private_get_scaled_font (cf_priv);
   cairo_font_extents_t font_extents;
+  VogueCairoFontGlyphExtentsCacheEntry *cache;
 
   if (G_UNLIKELY (scaled_font == NULL || cairo_scaled_font_status (scaled_font) != CAIRO_STATUS_SUCCESS))
     return FALSE;
 
+  g_mutex_lock (&cf_priv->mutex);
+
+  if (cf_priv->glyph_extents_cache)
+    {
+      g_mutex_unlock (&cf_priv->mutex);
+      return TRUE;
+    }
+
   cairo_scaled_font_extents (scaled_font, &font_extents);
 
   cf_priv->font_extents.x = 0;
@@ -815,15 +859,21 @@ _vogue_cairo_font_private_glyph_extents_cache_init (VogueCairoFontPrivate *cf_pr
 	}
     }
 
-  cf_priv->glyph_extents_cache = g_new0 (VogueCairoFontGlyphExtentsCacheEntry, GLYPH_CACHE_NUM_ENTRIES);
+  cache = g_new0 (VogueCairoFontGlyphExtentsCacheEntry, GLYPH_CACHE_NUM_ENTRIES);
   /* Make sure all cache entries are invalid initially */
-  cf_priv->glyph_extents_cache[0].glyph = 1; /* glyph 1 cannot happen in bucket 0 */
+  cache[0].glyph = 1; /* glyph 1 cannot happen in bucket 0 */
+
+  /* Publish the cache only once font_extents is filled in */
+  g_atomic_pointer_set (&cf_priv->glyph_extents_cache, cache);
+
+  g_mutex_unlock (&cf_priv->mutex);
 
   return TRUE;
 }
 
 
-/* Fills in the glyph extents cache entry
+/* Fills in the glyph extents cache entry. Must be called with
+ * cf_priv->mutex held.
  */
 static void
 compute_glyph_extents (VogueCairoFontPrivate  *cf_priv,
@@ -840,30 +890,43 @@ compute_glyph_extents (VogueCairoFontPrivate  *cf_priv,
   cairo_scaled_font_glyph_extents (_vogue_cairo_font_private_get_scaled_font (cf_priv),
 				   &cairo_glyph, 1, &extents);
 
-  entry->glyph = glyph;
-  entry->width = vogue_units_from_double (extents.x_advance);
-  entry->ink_rect.x = vogue_units_from_double (extents.x_bearing);
-  entry->ink_rect.y = vogue_units_from_double (extents.y_bearing);
-  entry->ink_rect.width = vogue_units_from_double (extents.width);
-  entry->ink_rect.height = vogue_units_from_double (extents.height);
+  g_atomic_int_inc (&entry->seq);
+
+  g_atomic_int_set (&entry->glyph, glyph);
+  g_atomic_int_set (&entry->width, vogue_units_from_double (extents.x_advance));
+  g_atomic_int_set (&entry->ink_rect.x, vogue_units_from_double (extents.x_bearing));
+  g_atomic_int_set (&entry->ink_rect.y, vogue_units_from_double (extents.y_bearing));
+  g_atomic_int_set (&entry->ink_rect.width, vogue_units_from_double (extents.width));
+  g_atomic_int_set (&entry->ink_rect.height, vogue_units_from_double (extents.height));
+
+  g_atomic_int_inc (&entry->seq);
 }
 
-static VogueCairoFontGlyphExtentsCacheEntry *
-_vogue_cairo_font_private_get_glyph_extents_cache_entry (VogueCairoFontPrivate  *cf_priv,
-							 VogueGlyph              glyph)
+/* Reads @entry without locking. Returns %FALSE if it does not hold
+ * @glyph, or if a writer changed it while it was being read.
+ */
+static gboolean
+read_glyph_extents_cache_entry (VogueCairoFontGlyphExtentsCacheEntry *entry,
+				VogueGlyph                            glyph,
+				int                                  *width,
+				VogueRectangle                       *ink_rect)
 {
-  VogueCairoFontGlyphExtentsCacheEntry *entry;
-  guint idx;
+  guint seq;
 
-  idx = glyph & GLYPH_CACHE_MASK;
-  entry = cf_priv->glyph_extents_cache + idx;
+  seq = g_atomic_int_get (&entry->seq);
+  if (seq & 1)
+    return FALSE;
 
-  if (entry->glyph != glyph)
-    {
-      compute_glyph_extents (cf_priv, glyph, entry);
-    }
+  if ((VogueGlyph) g_atomic_int_get (&entry->glyph) != glyph)
+    return FALSE;
 
-  return entry;
+  *width = g_atomic_int_get (&entry->width);
+  ink_rect->x = g_atomic_int_get (&entry->ink_rect.x);
+  ink_rect->y = g_atomic_int_get (&entry->ink_rect.y);
+  ink_rect->width = g_atomic_int_get (&entry->ink_rect.width);
+  ink_rect->height = g_atomic_int_get (&entry->ink_rect.height);
+
+  return (guint) g_atomic_int_get (&entry->seq) == seq;
 }
 
 void
@@ -872,10 +935,13 @@ _vogue_cairo_font_private_get_glyph_extents (VogueCairoFontPrivate *cf_priv,
 					     VogueRectangle        *ink_rect,
 					     VogueRectangle        *logical_rect)
 {
+  VogueCairoFontGlyphExtentsCacheEntry *cache;
   VogueCairoFontGlyphExtentsCacheEntry *entry;
+  VogueRectangle entry_ink_rect;
+  int entry_width;
 
   if (!cf_priv ||
-      (cf_priv->glyph_extents_cache == NULL &&
+      (g_atomic_pointer_get (&cf_priv->glyph_extents_cache) == NULL &&
        !_vogue_cairo_font_private_glyph_extents_cache_init (cf_priv)))
     {
       /* Get generic unknown-glyph extents. */
@@ -897,13 +963,30 @@ _vogue_cairo_font_private_get_glyph_extents (VogueCairoFontPrivate *cf_priv,
       return;
     }
 
-  entry = _vogue_cairo_font_private_get_glyph_extents_cache_entry (cf_priv, glyph);
+  cache = g_atomic_pointer_get (&cf_priv->glyph_extents_cache);
+  entry = cache + (glyph & GLYPH_CACHE_MASK);
+
+  /* The cache entries are filled in lazily and may be shared between
+   * shaping threads; only a miss takes the lock.
+   */
+  if (G_UNLIKELY (!read_glyph_extents_cache_entry (entry, glyph, &entry_width, &entry_ink_rect)))
+    {
+      g_mutex_lock (&cf_priv->mutex);
+
+      if (entry->glyph != glyph)
+	compute_glyph_extents (cf_priv, glyph, entry);
+
+      entry_width = entry->width;
+      entry_ink_rect = entry->ink_rect;
+
+      g_mutex_unlock (&cf_priv->mutex);
+    }
 
   if (ink_rect)
-    *ink_rect = entry->ink_rect;
+    *ink_rect = entry_ink_rect;
   if (logical_rect)
     {
       *logical_rect = cf_priv->font_extents;
-      logical_rect->width = entry->width;
+      logical_rect->width = entry_width;
     }
 }
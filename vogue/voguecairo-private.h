@@ -88,6 +88,11 @@ struct _VogueCairoFontPrivate
   VogueCairoFontGlyphExtentsCacheEntry *glyph_extents_cache;
 
   GSList *metrics_by_lang;
+
+  /* Protects the lazy creation of scaled_font and
+   * glyph_extents_cache, and writes to the cache entries
+   */
+  GMutex mutex;
 };
 
 struct _VogueCairoFontIface
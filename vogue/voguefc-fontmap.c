@@ -365,7 +365,7 @@ struct _VogueFcFontsetKey {
   int pixelsize;
   double resolution;
   gpointer context_key;
-  char *variations;
+  const char *variations;	/* interned, owned by copies */
 };
 
 struct _VogueFcFontKey {
@@ -373,7 +373,7 @@ struct _VogueFcFontKey {
   FcPattern *pattern;
   VogueMatrix matrix;
   gpointer context_key;
-  char *variations;
+  const char *variations;	/* interned, owned by copies */
 };
 
 static void
@@ -391,7 +391,7 @@ vogue_fc_fontset_key_init (VogueFcFontsetKey          *key,
   key->pixelsize = get_scaled_size (fcfontmap, context, desc);
   key->resolution = vogue_fc_font_map_get_resolution (fcfontmap, context);
   key->language = language;
-  key->variations = g_strdup (vogue_font_description_get_variations (desc));
+  key->variations = vogue_font_description_get_variations_key (desc);
   key->desc = vogue_font_description_copy_static (desc);
   vogue_font_description_unset_fields (key->desc, PANGO_FONT_MASK_SIZE | PANGO_FONT_MASK_VARIATIONS);
 
@@ -408,8 +408,7 @@ vogue_fc_fontset_key_equal (const VogueFcFontsetKey *key_a,
   if (key_a->language == key_b->language &&
       key_a->pixelsize == key_b->pixelsize &&
       key_a->resolution == key_b->resolution &&
-      ((key_a->variations == NULL && key_b->variations == NULL) ||
-       (key_a->variations && key_b->variations && (strcmp (key_a->variations, key_b->variations) == 0))) &&
+      key_a->variations == key_b->variations &&
       vogue_font_description_equal (key_a->desc, key_b->desc) &&
       0 == memcmp (&key_a->matrix, &key_b->matrix, 4 * sizeof (double)))
     {
@@ -435,8 +434,7 @@ vogue_fc_fontset_key_hash (const VogueFcFontsetKey *key)
 
     hash ^= key->pixelsize;
 
-    if (key->variations)
-      hash ^= g_str_hash (key->variations);
+    hash ^= GPOINTER_TO_UINT (key->variations);
 
     if (key->context_key)
       hash ^= PANGO_FC_FONT_MAP_GET_CLASS (key->fontmap)->context_key_hash (key->fontmap,
@@ -451,7 +449,9 @@ static void
 vogue_fc_fontset_key_free (VogueFcFontsetKey *key)
 {
   vogue_font_description_free (key->desc);
-  g_free (key->variations);
+
+  if (key->variations)
+    g_ref_string_release ((char *) key->variations);
 
   if (key->context_key)
     PANGO_FC_FONT_MAP_GET_CLASS (key->fontmap)->context_key_free (key->fontmap,
@@ -471,7 +471,7 @@ vogue_fc_fontset_key_copy (const VogueFcFontsetKey *old)
   key->matrix = old->matrix;
   key->pixelsize = old->pixelsize;
   key->resolution = old->resolution;
-  key->variations = g_strdup (old->variations);
+  key->variations = old->variations ? g_ref_string_acquire ((char *) old->variations) : NULL;
 
   if (old->context_key)
     key->context_key = PANGO_FC_FONT_MAP_GET_CLASS (key->fontmap)->context_key_copy (key->fontmap,
@@ -588,8 +588,7 @@ vogue_fc_font_key_equal (const VogueFcFontKey *key_a,
 			 const VogueFcFontKey *key_b)
 {
   if (key_a->pattern == key_b->pattern &&
-      ((key_a->variations == NULL && key_b->variations == NULL) ||
-       (key_a->variations && key_b->variations && (strcmp (key_a->variations, key_b->variations) == 0))) &&
+      key_a->variations == key_b->variations &&
       0 == memcmp (&key_a->matrix, &key_b->matrix, 4 * sizeof (double)))
     {
       if (key_a->context_key && key_b->context_key)
@@ -611,8 +610,7 @@ vogue_fc_font_key_hash (const VogueFcFontKey *key)
     /* We do a bytewise hash on the doubles */
     hash = hash_bytes_fnv ((unsigned char *)(&key->matrix), sizeof (double) * 4, hash);
 
-    if (key->variations)
-      hash ^= g_str_hash (key->variations);
+    hash ^= GPOINTER_TO_UINT (key->variations);
 
     if (key->context_key)
       hash ^= PANGO_FC_FONT_MAP_GET_CLASS (key->fontmap)->context_key_hash (key->fontmap,
@@ -631,7 +629,8 @@ vogue_fc_font_key_free (VogueFcFontKey *key)
     PANGO_FC_FONT_MAP_GET_CLASS (key->fontmap)->context_key_free (key->fontmap,
 								  key->context_key);
 
-  g_free (key->variations);
+  if (key->variations)
+    g_ref_string_release ((char *) key->variations);
 
   g_slice_free (VogueFcFontKey, key);
 }
@@ -645,7 +644,7 @@ vogue_fc_font_key_copy (const VogueFcFontKey *old)
   FcPatternReference (old->pattern);
   key->pattern = old->pattern;
   key->matrix = old->matrix;
-  key->variations = g_strdup (old->variations);
+  key->variations = old->variations ? g_ref_string_acquire ((char *) old->variations) : NULL;
   if (old->context_key)
     key->context_key = PANGO_FC_FONT_MAP_GET_CLASS (key->fontmap)->context_key_copy (key->fontmap,
 										     old->context_key);
@@ -1856,7 +1855,6 @@ vogue_fc_font_map_load_fontset (VogueFontMap                 *fontmap,
   vogue_fc_fontset_cache (fontset, fcfontmap);
 
   vogue_font_description_free (key.desc);
-  g_free (key.variations);
 
   return g_object_ref (PANGO_FONTSET (fontset));
 }
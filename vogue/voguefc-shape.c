@@ -31,42 +31,29 @@
 
 #include <hb-glib.h>
 
-/* cache a single hb_buffer_t */
-static hb_buffer_t *cached_buffer = NULL; /* MT-safe */
-G_LOCK_DEFINE_STATIC (cached_buffer);
+/* cache one hb_buffer_t per thread, so that shaping
+ * from several threads at once does not contend on it */
+static GPrivate cached_buffer = G_PRIVATE_INIT ((GDestroyNotify) hb_buffer_destroy); /* MT-safe */
 
 static hb_buffer_t *
-acquire_buffer (gboolean *free_buffer)
+acquire_buffer (void)
 {
   hb_buffer_t *buffer;
 
-  if (G_LIKELY (G_TRYLOCK (cached_buffer)))
-    {
-      if (G_UNLIKELY (!cached_buffer))
-	cached_buffer = hb_buffer_create ();
-
-      buffer = cached_buffer;
-      *free_buffer = FALSE;
-    }
-  else
+  buffer = g_private_get (&cached_buffer);
+  if (G_UNLIKELY (!buffer))
     {
       buffer = hb_buffer_create ();
-      *free_buffer = TRUE;
+      g_private_set (&cached_buffer, buffer);
     }
 
   return buffer;
 }
 
 static void
-release_buffer (hb_buffer_t *buffer, gboolean free_buffer)
+release_buffer (hb_buffer_t *buffer)
 {
-  if (G_LIKELY (!free_buffer))
-    {
-      hb_buffer_reset (buffer);
-      G_UNLOCK (cached_buffer);
-    }
-  else
-    hb_buffer_destroy (buffer);
+  hb_buffer_reset (buffer);
 }
 
 static void
@@ -212,12 +199,7 @@ vogue_hb_font_get_glyph_h_advance (hb_font_t      *font,
   VogueHbShapeContext *context = (VogueHbShapeContext *) font_data;
 
   if (glyph & PANGO_GLYPH_UNKNOWN_FLAG)
-    {
-      VogueRectangle logical;
-
-      vogue_font_get_glyph_extents (context->font, glyph, NULL, &logical);
-      return logical.width;
-    }
+    return vogue_font_get_glyph_advance (context->font, glyph);
 
   return hb_font_get_glyph_h_advance (context->parent, glyph);
 }
@@ -272,20 +254,22 @@ vogue_font_get_hb_font_for_context (VogueFont           *font,
                                     VogueHbShapeContext *context)
 {
   hb_font_t *hb_font;
-  static hb_font_funcs_t *funcs;
+  static hb_font_funcs_t *funcs = NULL; /* MT-safe */
 
   hb_font = vogue_font_get_hb_font (font);
 
-  if (G_UNLIKELY (!funcs))
+  if (g_once_init_enter (&funcs))
     {
-      funcs = hb_font_funcs_create ();
+      hb_font_funcs_t *f = hb_font_funcs_create ();
+
+      hb_font_funcs_set_nominal_glyph_func (f, vogue_hb_font_get_nominal_glyph, NULL, NULL);
+      hb_font_funcs_set_glyph_h_advance_func (f, vogue_hb_font_get_glyph_h_advance, NULL, NULL);
+      hb_font_funcs_set_glyph_v_advance_func (f, vogue_hb_font_get_glyph_v_advance, NULL, NULL);
+      hb_font_funcs_set_glyph_extents_func (f, vogue_hb_font_get_glyph_extents, NULL, NULL);
 
-      hb_font_funcs_set_nominal_glyph_func (funcs, vogue_hb_font_get_nominal_glyph, NULL, NULL);
-      hb_font_funcs_set_glyph_h_advance_func (funcs, vogue_hb_font_get_glyph_h_advance, NULL, NULL);
-      hb_font_funcs_set_glyph_v_advance_func (funcs, vogue_hb_font_get_glyph_v_advance, NULL, NULL);
-      hb_font_funcs_set_glyph_extents_func (funcs, vogue_hb_font_get_glyph_extents, NULL, NULL);
+      hb_font_funcs_make_immutable (f);
 
-      hb_font_funcs_make_immutable (funcs);
+      g_once_init_leave (&funcs, f);
     }
 
   context->font = font;
@@ -314,6 +298,260 @@ find_show_flags (const VogueAnalysis *analysis)
   return flags;
 }
 
+/* Shape plan cache.
+ *
+ * hb_shape() only reuses shape plans when all user features are
+ * global, which the range-limited features we derive from attributes
+ * never are. So we keep a small MRU list of plans per hb_face_t
+ * ourselves. Compiling a plan only depends on the segment properties,
+ * the variation coordinates and, for each feature, its tag, value and
+ * whether it is global; the actual ranges are applied when the plan is
+ * executed. That is what the cache key consists of.
+ */
+
+#define PLAN_CACHE_SIZE 16
+
+typedef struct {
+  guint hash;
+  hb_segment_properties_t props;
+  hb_feature_t *features;
+  unsigned int num_features;
+  int *coords;
+  unsigned int num_coords;
+  hb_shape_plan_t *plan;
+} PlanCacheEntry;
+
+typedef struct {
+  GMutex mutex;
+  PlanCacheEntry entries[PLAN_CACHE_SIZE];
+  guint n_entries;
+} PlanCache;
+
+static hb_user_data_key_t plan_cache_key;
+
+static gint plan_cache_hits;       /* atomic */
+static gint plan_cache_misses;     /* atomic */
+static gint plan_cache_evictions;  /* atomic */
+
+static gboolean
+feature_is_global (const hb_feature_t *feature)
+{
+  return feature->start == HB_FEATURE_GLOBAL_START &&
+         feature->end == HB_FEATURE_GLOBAL_END;
+}
+
+static guint
+plan_key_hash (const hb_segment_properties_t *props,
+               const hb_feature_t            *features,
+               unsigned int                   num_features,
+               const int                     *coords,
+               unsigned int                   num_coords)
+{
+  guint hash = hb_segment_properties_hash (props);
+  unsigned int i;
+
+  for (i = 0; i < num_features; i++)
+    {
+      hash = hash * 31 + features[i].tag;
+      hash = hash * 31 + features[i].value;
+      hash = hash * 31 + feature_is_global (&features[i]);
+    }
+
+  for (i = 0; i < num_coords; i++)
+    hash = hash * 31 + coords[i];
+
+  return hash;
+}
+
+static gboolean
+plan_entry_matches (const PlanCacheEntry          *entry,
+                    guint                          hash,
+                    const hb_segment_properties_t *props,
+                    const hb_feature_t            *features,
+                    unsigned int                   num_features,
+                    const int                     *coords,
+                    unsigned int                   num_coords)
+{
+  unsigned int i;
+
+  if (entry->hash != hash ||
+      entry->num_features != num_features ||
+      entry->num_coords != num_coords ||
+      !hb_segment_properties_equal (&entry->props, props))
+    return FALSE;
+
+  for (i = 0; i < num_features; i++)
+    {
+      if (entry->features[i].tag != features[i].tag ||
+          entry->features[i].value != features[i].value ||
+          feature_is_global (&entry->features[i]) != feature_is_global (&features[i]))
+        return FALSE;
+    }
+
+  return num_coords == 0 || memcmp (entry->coords, coords, num_coords * sizeof (int)) == 0;
+}
+
+static void
+plan_entry_clear (PlanCacheEntry *entry)
+{
+  hb_shape_plan_destroy (entry->plan);
+  g_free (entry->features);
+  g_free (entry->coords);
+}
+
+static void
+plan_cache_free (gpointer data)
+{
+  PlanCache *cache = data;
+  guint i;
+
+  for (i = 0; i < cache->n_entries; i++)
+    plan_entry_clear (&cache->entries[i]);
+
+  g_mutex_clear (&cache->mutex);
+  g_free (cache);
+}
+
+static PlanCache *
+get_plan_cache (hb_face_t *face)
+{
+  PlanCache *cache;
+
+  cache = hb_face_get_user_data (face, &plan_cache_key);
+  if (G_LIKELY (cache))
+    return cache;
+
+  cache = g_new0 (PlanCache, 1);
+  g_mutex_init (&cache->mutex);
+
+  if (!hb_face_set_user_data (face, &plan_cache_key, cache, plan_cache_free, FALSE))
+    {
+      /* Either another thread won, or the face is the empty face */
+      plan_cache_free (cache);
+      cache = hb_face_get_user_data (face, &plan_cache_key);
+    }
+
+  return cache;
+}
+
+/* Returns a new reference to a shape plan for the given buffer and features */
+static hb_shape_plan_t *
+get_shape_plan (hb_font_t          *font,
+                hb_buffer_t        *buffer,
+                const hb_feature_t *features,
+                unsigned int        num_features)
+{
+  hb_face_t *face = hb_font_get_face (font);
+  hb_segment_properties_t props;
+  const int *coords;
+  unsigned int num_coords;
+  PlanCache *cache;
+  PlanCacheEntry entry;
+  hb_shape_plan_t *plan;
+  guint hash;
+  guint i;
+
+  hb_buffer_get_segment_properties (buffer, &props);
+  coords = hb_font_get_var_coords_normalized (font, &num_coords);
+  hash = plan_key_hash (&props, features, num_features, coords, num_coords);
+
+  cache = get_plan_cache (face);
+  if (G_UNLIKELY (!cache))
+    return hb_shape_plan_create2 (face, &props, features, num_features, coords, num_coords, NULL);
+
+  g_mutex_lock (&cache->mutex);
+  for (i = 0; i < cache->n_entries; i++)
+    {
+      if (plan_entry_matches (&cache->entries[i], hash, &props, features, num_features, coords, num_coords))
+        {
+          entry = cache->entries[i];
+
+          /* Move to front */
+          memmove (&cache->entries[1], &cache->entries[0], i * sizeof (PlanCacheEntry));
+          cache->entries[0] = entry;
+
+          plan = hb_shape_plan_reference (entry.plan);
+          g_mutex_unlock (&cache->mutex);
+
+          g_atomic_int_inc (&plan_cache_hits);
+
+          return plan;
+        }
+    }
+  g_mutex_unlock (&cache->mutex);
+
+  g_atomic_int_inc (&plan_cache_misses);
+
+  /* Compile the plan without holding the lock */
+  plan = hb_shape_plan_create2 (face, &props, features, num_features, coords, num_coords, NULL);
+
+  entry.hash = hash;
+  entry.props = props;
+  entry.features = g_memdup (features, num_features * sizeof (hb_feature_t));
+  entry.num_features = num_features;
+  entry.coords = g_memdup (coords, num_coords * sizeof (int));
+  entry.num_coords = num_coords;
+  entry.plan = hb_shape_plan_reference (plan);
+
+  g_mutex_lock (&cache->mutex);
+  if (cache->n_entries == PLAN_CACHE_SIZE)
+    {
+      plan_entry_clear (&cache->entries[PLAN_CACHE_SIZE - 1]);
+      cache->n_entries--;
+      g_atomic_int_inc (&plan_cache_evictions);
+    }
+  memmove (&cache->entries[1], &cache->entries[0], cache->n_entries * sizeof (PlanCacheEntry));
+  cache->entries[0] = entry;
+  cache->n_entries++;
+  g_mutex_unlock (&cache->mutex);
+
+  return plan;
+}
+
+/**
+ * vogue_shape_plan_cache_get_stats:
+ * @hits: (out) (optional): return location for the number of cache hits
+ * @misses: (out) (optional): return location for the number of cache misses
+ * @evictions: (out) (optional): return location for the number of evictions
+ *
+ * Returns the counters of the cache of HarfBuzz shape plans
+ * that vogue_shape() and related functions use, accumulated
+ * over all font faces since the start of the process.
+ *
+ * This is meant for benchmarks and diagnostics; a low hit
+ * rate means that text is shaped with many different
+ * combinations of script, language, features and variations.
+ *
+ * Since: 1.46
+ */
+void
+vogue_shape_plan_cache_get_stats (guint *hits,
+                                  guint *misses,
+                                  guint *evictions)
+{
+  if (hits)
+    *hits = g_atomic_int_get (&plan_cache_hits);
+  if (misses)
+    *misses = g_atomic_int_get (&plan_cache_misses);
+  if (evictions)
+    *evictions = g_atomic_int_get (&plan_cache_evictions);
+}
+
+/* VogueAnalysis stores the script in a guint8, so a 256-entry
+ * table covers every value that can reach us. Entries are filled
+ * in lazily; concurrent fills store the same value.
+ */
+static inline hb_script_t
+get_hb_script (guint8 script)
+{
+  static hb_script_t hb_scripts[256]; /* MT-safe */
+
+  if (G_UNLIKELY (hb_scripts[script] == HB_SCRIPT_INVALID))
+    hb_scripts[script] = hb_glib_script_to_script (script);
+
+  return hb_scripts[script];
+}
+
 void
 vogue_hb_shape (VogueFont           *font,
                 const char          *item_text,
@@ -327,8 +565,8 @@ vogue_hb_shape (VogueFont           *font,
   hb_buffer_flags_t hb_buffer_flags;
   hb_font_t *hb_font;
   hb_buffer_t *hb_buffer;
+  hb_shape_plan_t *hb_shape_plan;
   hb_direction_t hb_direction;
-  gboolean free_buffer;
   hb_glyph_info_t *hb_glyph;
   hb_glyph_position_t *hb_position;
   int last_cluster;
@@ -343,7 +581,7 @@ vogue_hb_shape (VogueFont           *font,
 
   context.show_flags = find_show_flags (analysis);
   hb_font = vogue_font_get_hb_font_for_context (font, &context);
-  hb_buffer = acquire_buffer (&free_buffer);
+  hb_buffer = acquire_buffer ();
 
   hb_direction = PANGO_GRAVITY_IS_VERTICAL (analysis->gravity) ? HB_DIRECTION_TTB : HB_DIRECTION_LTR;
   if (analysis->level % 2)
@@ -359,8 +597,8 @@ vogue_hb_shape (VogueFont           *font,
   /* setup buffer */
 
   hb_buffer_set_direction (hb_buffer, hb_direction);
-  hb_buffer_set_script (hb_buffer, hb_glib_script_to_script (analysis->script));
-  hb_buffer_set_language (hb_buffer, hb_language_from_string (vogue_language_to_string (analysis->language), -1));
+  hb_buffer_set_script (hb_buffer, get_hb_script (analysis->script));
+  hb_buffer_set_language (hb_buffer, vogue_language_get_hb_language (analysis->language));
   hb_buffer_set_cluster_level (hb_buffer, HB_BUFFER_CLUSTER_LEVEL_MONOTONE_CHARACTERS);
   hb_buffer_set_flags (hb_buffer, hb_buffer_flags);
   hb_buffer_set_invisible_glyph (hb_buffer, PANGO_GLYPH_EMPTY);
@@ -384,7 +622,9 @@ vogue_hb_shape (VogueFont           *font,
   vogue_font_get_features (font, features, G_N_ELEMENTS (features), &num_features);
   apply_extra_attributes (analysis->extra_attrs, features, G_N_ELEMENTS (features), &num_features);
 
-  hb_shape (hb_font, hb_buffer, features, num_features);
+  hb_shape_plan = get_shape_plan (hb_font, hb_buffer, features, num_features);
+  hb_shape_plan_execute (hb_shape_plan, hb_font, hb_buffer, features, num_features);
+  hb_shape_plan_destroy (hb_shape_plan);
 
   if (PANGO_GRAVITY_IS_IMPROPER (analysis->gravity))
     hb_buffer_reverse (hb_buffer);
@@ -423,6 +663,6 @@ vogue_hb_shape (VogueFont           *font,
 	hb_position++;
       }
 
-  release_buffer (hb_buffer, free_buffer);
+  release_buffer (hb_buffer);
   hb_font_destroy (hb_font);
 }
@@ -28,6 +28,8 @@
 
 G_BEGIN_DECLS
 
+hb_language_t vogue_language_get_hb_language (VogueLanguage *language);
+
 void vogue_hb_shape (VogueFont           *font,
                      const char          *item_text,
                      unsigned int         item_length,